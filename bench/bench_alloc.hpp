@@ -0,0 +1,25 @@
+/**
+ * @file bench_alloc.hpp
+ * @brief Allocation counters for benchmarks (see tests/alloc_tracker.hpp)
+ */
+
+#pragma once
+
+#include "alloc_tracker.hpp"
+#include <benchmark/benchmark.h>
+#include <cstdint>
+
+/**
+ * @brief Report the allocations counted by scope as "allocs" and "alloc_bytes" per item
+ *
+ * @param items_per_iteration Items processed per benchmark iteration
+ */
+inline void report_allocations(benchmark::State& state, const vss::types::test::AllocationScope& scope,
+                               int64_t items_per_iteration = 1) {
+    const auto stats = scope.stats();
+    const double items = static_cast<double>(state.iterations()) * static_cast<double>(items_per_iteration);
+    if (items > 0) {
+        state.counters["allocs"] = static_cast<double>(stats.allocations) / items;
+        state.counters["alloc_bytes"] = static_cast<double>(stats.bytes) / items;
+    }
+}
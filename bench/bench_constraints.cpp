@@ -0,0 +1,75 @@
+/**
+ * @file bench_constraints.cpp
+ * @brief Benchmarks for constraint checking
+ */
+
+#include <vss/types/constraints.hpp>
+#include <benchmark/benchmark.h>
+#include <random>
+#include <vector>
+
+using namespace vss::types;
+
+static void BM_CheckConstraintsPerValue(benchmark::State& state) {
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> dist(-300.0f, 300.0f);
+    std::vector<Value> samples(static_cast<size_t>(state.range(0)));
+    for (auto& s : samples) {
+        s = dist(rng);
+    }
+    ValueConstraints constraints;
+    constraints.min = -250.0;
+    constraints.max = 250.0;
+
+    for (auto _ : state) {
+        size_t bad = 0;
+        for (const auto& s : samples) {
+            bad += check_constraints(s, constraints).has_value();
+        }
+        benchmark::DoNotOptimize(bad);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_CheckConstraintsPerValue)->Arg(1024)->Arg(16384);
+
+static void BM_CheckRangeBatch(benchmark::State& state) {
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> dist(-300.0f, 300.0f);
+    std::vector<float> samples(static_cast<size_t>(state.range(0)));
+    for (auto& s : samples) {
+        s = dist(rng);
+    }
+    std::vector<uint8_t> valid(samples.size());
+    ValueConstraints constraints;
+    constraints.min = -250.0;
+    constraints.max = 250.0;
+    ConstraintChecker checker{constraints};
+
+    for (auto _ : state) {
+        size_t bad = checker.check_range(samples.data(), samples.size(), valid.data());
+        benchmark::DoNotOptimize(bad);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_CheckRangeBatch)->Arg(1024)->Arg(16384);
+
+static void BM_CheckAllowedStrings(benchmark::State& state) {
+    const std::vector<std::string> modes{"NORMAL", "SPORT", "ECONOMY", "SNOW", "RAIN"};
+    ValueConstraints constraints;
+    for (const auto& m : modes) {
+        constraints.allowed.push_back(m);
+    }
+    ConstraintChecker checker{constraints};
+
+    std::vector<std::string> samples(static_cast<size_t>(state.range(0)));
+    for (size_t i = 0; i < samples.size(); ++i) {
+        samples[i] = i % 7 == 0 ? "RACE" : modes[i % modes.size()];
+    }
+
+    for (auto _ : state) {
+        size_t bad = checker.check_strings(samples.data(), samples.size(), nullptr);
+        benchmark::DoNotOptimize(bad);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_CheckAllowedStrings)->Arg(1024)->Arg(16384);
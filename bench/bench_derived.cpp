@@ -0,0 +1,69 @@
+/**
+ * @file bench_derived.cpp
+ * @brief Benchmarks for incremental derived-signal evaluation
+ */
+
+#include <vss/types/derived.hpp>
+#include <benchmark/benchmark.h>
+
+using namespace vss::types;
+
+namespace {
+
+constexpr SignalId INPUTS = 1024;
+
+// Each input feeds a chain of `depth` nodes; every 64 chains are summed
+void make_graph(DerivedGraph& graph, SignalId depth) {
+    SignalId next = INPUTS;
+    std::vector<SignalId> group;
+    for (SignalId c = 0; c < INPUTS; ++c) {
+        SignalId prev = c;
+        for (SignalId d = 0; d < depth; ++d) {
+            graph.add_node(DerivedNode{next, {prev}, [](const DerivedInputs& in) {
+                return Value{in.number(0) * 0.5 + 1.0};
+            }});
+            prev = next++;
+        }
+        group.push_back(prev);
+        if (group.size() == 64) {
+            graph.add_node(DerivedNode{next++, group, [](const DerivedInputs& in) {
+                double sum = 0.0;
+                for (size_t i = 0; i < in.size(); ++i) {
+                    sum += in.number(i);
+                }
+                return Value{sum};
+            }});
+            group.clear();
+        }
+    }
+    graph.build();
+    graph.evaluate();
+}
+
+DynamicQualifiedValue sample(double v) {
+    return DynamicQualifiedValue{Value{v}, SignalQuality::VALID, std::chrono::system_clock::time_point{}};
+}
+
+} // namespace
+
+// Args: inputs changed per cycle, worker threads; 1024 chains of depth 4
+static void BM_DerivedEvaluate(benchmark::State& state) {
+    const auto changed = static_cast<SignalId>(state.range(0));
+    DerivedGraph graph(static_cast<size_t>(state.range(1)));
+    make_graph(graph, 4);
+
+    double v = 0.0;
+    size_t evaluated = 0;
+    for (auto _ : state) {
+        v += 1.0;
+        for (SignalId i = 0; i < changed; ++i) {
+            graph.update(i * (INPUTS / changed), sample(v));
+        }
+        evaluated += graph.evaluate();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(evaluated));
+    state.counters["nodes/cycle"] = static_cast<double>(evaluated) / static_cast<double>(state.iterations());
+}
+BENCHMARK(BM_DerivedEvaluate)
+    ->Args({1, 0})->Args({16, 0})->Args({1024, 0})
+    ->Args({16, 4})->Args({1024, 4});
@@ -0,0 +1,72 @@
+/**
+ * @file bench_downsample.cpp
+ * @brief Benchmarks for signal history downsampling
+ */
+
+#include <vss/types/downsample.hpp>
+#include <benchmark/benchmark.h>
+#include <random>
+
+using namespace vss::types;
+
+namespace {
+
+SignalSeries make_series(size_t count, unsigned seed = 42) {
+    SignalSeries series;
+    series.reserve(count);
+    std::mt19937 rng(seed);
+    std::normal_distribution<double> dist(80.0, 15.0);
+    for (size_t i = 0; i < count; ++i) {
+        auto ts = std::chrono::system_clock::time_point(std::chrono::milliseconds(i));
+        series.append(ts, dist(rng), i % 50 == 0 ? SignalQuality::INVALID : SignalQuality::VALID);
+    }
+    return series;
+}
+
+void run_method(benchmark::State& state, DownsampleMethod method) {
+    const auto series = make_series(static_cast<size_t>(state.range(0)));
+    DownsampleSpec spec;
+    spec.method = method;
+    spec.points = 1000;
+    spec.bucket_width = std::chrono::milliseconds(state.range(0) / 1000);
+
+    SignalSeries out;
+    for (auto _ : state) {
+        out.clear();
+        downsample(series.view(), spec, out);
+        benchmark::DoNotOptimize(out.values().data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // namespace
+
+static void BM_DownsampleLttb(benchmark::State& state) { run_method(state, DownsampleMethod::LTTB); }
+BENCHMARK(BM_DownsampleLttb)->Arg(100000)->Arg(1000000);
+
+static void BM_DownsampleMinMax(benchmark::State& state) { run_method(state, DownsampleMethod::MIN_MAX); }
+BENCHMARK(BM_DownsampleMinMax)->Arg(100000)->Arg(1000000);
+
+static void BM_DownsampleAverage(benchmark::State& state) { run_method(state, DownsampleMethod::AVERAGE); }
+BENCHMARK(BM_DownsampleAverage)->Arg(100000)->Arg(1000000);
+
+// Args: threads
+static void BM_DownsampleMany(benchmark::State& state) {
+    std::vector<SignalSeries> histories;
+    std::vector<SeriesView> views;
+    for (unsigned s = 0; s < 64; ++s) {
+        histories.push_back(make_series(20000, s));
+    }
+    for (const auto& h : histories) {
+        views.push_back(h.view());
+    }
+    DownsampleSpec spec;
+    spec.points = 500;
+
+    for (auto _ : state) {
+        auto results = downsample_many(views, spec, static_cast<size_t>(state.range(0)));
+        benchmark::DoNotOptimize(results.data());
+    }
+    state.SetItemsProcessed(state.iterations() * 64 * 20000);
+}
+BENCHMARK(BM_DownsampleMany)->Arg(1)->Arg(4)->UseRealTime();
@@ -0,0 +1,62 @@
+/**
+ * @file bench_expression.cpp
+ * @brief Benchmarks for compiled expression evaluation
+ */
+
+#include <vss/types/expression.hpp>
+#include <benchmark/benchmark.h>
+#include <random>
+
+using namespace vss::types;
+
+namespace {
+
+const char* RULE = "Vehicle.Speed > 100 && Vehicle.Cabin.Door.Row1.Left.IsOpen";
+
+SignalCatalog make_catalog() {
+    SignalCatalog catalog;
+    catalog.add_signal("Vehicle.Speed", NodeType::SENSOR, ValueType::FLOAT);
+    catalog.add_signal("Vehicle.Cabin.Door.Row1.Left.IsOpen", NodeType::SENSOR, ValueType::BOOL);
+    return catalog;
+}
+
+} // namespace
+
+static void BM_ExpressionEvaluate(benchmark::State& state) {
+    const auto catalog = make_catalog();
+    const auto rule = Expression::compile(RULE, catalog);
+    const auto ts = std::chrono::system_clock::time_point{};
+    DynamicQualifiedValue speed{Value{120.0f}, SignalQuality::VALID, ts};
+    DynamicQualifiedValue door{Value{true}, SignalQuality::VALID, ts};
+    const DynamicQualifiedValue* inputs[] = {&speed, &door};
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(rule->matches(inputs));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ExpressionEvaluate);
+
+// Args: rows
+static void BM_ExpressionBatch(benchmark::State& state) {
+    const auto catalog = make_catalog();
+    const auto rule = Expression::compile(RULE, catalog);
+    const size_t rows = static_cast<size_t>(state.range(0));
+
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<double> speed(0.0, 200.0);
+    SignalSeries speeds, doors;
+    for (size_t r = 0; r < rows; ++r) {
+        const auto ts = std::chrono::system_clock::time_point(std::chrono::milliseconds(r));
+        speeds.append(ts, speed(rng));
+        doors.append(ts, (rng() & 1) ? 1.0 : 0.0);
+    }
+    const std::vector<SeriesView> columns{speeds.view(), doors.view()};
+    std::vector<uint8_t> hits;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(rule->evaluate_batch(columns, hits));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ExpressionBatch)->Arg(4096)->Arg(1 << 20);
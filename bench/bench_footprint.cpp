@@ -0,0 +1,53 @@
+/**
+ * @file bench_footprint.cpp
+ * @brief Benchmarks for memory-footprint accounting
+ */
+
+#include <vss/types/footprint.hpp>
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace vss::types;
+
+namespace {
+
+std::shared_ptr<StructValue> make_waypoint(int64_t i) {
+    auto p = std::make_shared<StructValue>("Waypoint");
+    p->set_field("Latitude", 48.0 + static_cast<double>(i) * 1e-4);
+    p->set_field("Longitude", 11.0);
+    p->set_field("Label", std::string("Stop number ") + std::to_string(i) + " on the route");
+    return p;
+}
+
+} // namespace
+
+static void BM_MemoryUsageStructArray(benchmark::State& state) {
+    std::vector<std::shared_ptr<StructValue>> points;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        points.push_back(make_waypoint(i));
+    }
+    const Value value{std::move(points)};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(memory_usage(value));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_MemoryUsageStructArray)->Arg(16)->Arg(1024);
+
+static void BM_MemoryReport(benchmark::State& state) {
+    StructRegistry registry;
+    for (int64_t s = 0; s < state.range(0); ++s) {
+        StructDefinition definition("Struct" + std::to_string(s));
+        for (int f = 0; f < 8; ++f) {
+            definition.add_field(FieldDefinition("Field" + std::to_string(f), ValueType::FLOAT));
+        }
+        registry.register_struct(definition);
+    }
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(memory_report(registry));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_MemoryReport)->Arg(64);
@@ -0,0 +1,62 @@
+/**
+ * @file bench_history.cpp
+ * @brief Benchmarks for as-of queries
+ */
+
+#include <vss/types/history.hpp>
+#include <benchmark/benchmark.h>
+#include <random>
+
+using namespace vss::types;
+
+namespace {
+
+HistoryStore make_history(size_t signals, size_t samples) {
+    HistoryStore history;
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> step(1, 20);
+    for (SignalId id = 0; id < signals; ++id) {
+        int64_t t = 0;
+        for (size_t i = 0; i < samples; ++i) {
+            t += step(rng);
+            history.record(id, DynamicQualifiedValue{Value{double(i)}, SignalQuality::VALID,
+                                                     std::chrono::system_clock::time_point(std::chrono::milliseconds(t))});
+        }
+    }
+    return history;
+}
+
+} // namespace
+
+static void BM_HistoryAsOf(benchmark::State& state) {
+    const auto history = make_history(1, static_cast<size_t>(state.range(0)));
+    std::mt19937 rng(1);
+    std::uniform_int_distribution<int64_t> when(0, state.range(0) * 10);
+
+    for (auto _ : state) {
+        auto v = history.as_of(0, std::chrono::system_clock::time_point(std::chrono::milliseconds(when(rng))));
+        benchmark::DoNotOptimize(v);
+    }
+}
+BENCHMARK(BM_HistoryAsOf)->Arg(1000)->Arg(1000000);
+
+// Args: query times; 64 signals x 100k samples
+static void BM_HistoryAsOfJoin(benchmark::State& state) {
+    const auto history = make_history(64, 100000);
+    std::vector<SignalId> signals;
+    for (SignalId id = 0; id < 64; ++id) {
+        signals.push_back(id);
+    }
+    std::vector<std::chrono::system_clock::time_point> times;
+    const int64_t span = 100000 * 10;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        times.push_back(std::chrono::system_clock::time_point(std::chrono::milliseconds(i * span / state.range(0))));
+    }
+
+    for (auto _ : state) {
+        auto table = history.as_of_join(signals, times);
+        benchmark::DoNotOptimize(table.cells.data());
+    }
+    state.SetItemsProcessed(state.iterations() * 64 * state.range(0));
+}
+BENCHMARK(BM_HistoryAsOfJoin)->Arg(1000)->Arg(100000);
@@ -0,0 +1,89 @@
+/**
+ * @file bench_instrumentation.cpp
+ * @brief Benchmarks for the instrumented hot paths
+ *
+ * Run once from a default build and once with
+ * -DVSS_TYPES_ENABLE_INSTRUMENTATION=ON to see the cost of counting; the
+ * "instrumented" counter tells the two apart.
+ */
+
+#include <vss/types/instrumentation.hpp>
+#include <vss/types/struct.hpp>
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <vector>
+
+using namespace vss::types;
+
+namespace {
+
+Value make_route(size_t waypoints) {
+    std::vector<std::shared_ptr<StructValue>> points;
+    for (size_t i = 0; i < waypoints; ++i) {
+        auto point = std::make_shared<StructValue>("Waypoint");
+        point->set_field("Latitude", 48.0 + static_cast<double>(i) * 1e-4);
+        point->set_field("Longitude", 11.0 + static_cast<double>(i) * 1e-4);
+        point->set_field("Speed", 50.0f);
+        points.push_back(std::move(point));
+    }
+    auto route = std::make_shared<StructValue>("Route");
+    route->set_field("Waypoints", std::move(points));
+    route->set_field("Name", std::string("Commute"));
+    return Value{route};
+}
+
+void set_instrumented(benchmark::State& state) {
+    state.counters["instrumented"] = instrumentation_enabled() ? 1 : 0;
+}
+
+} // namespace
+
+static void BM_ConvertValueTypeNarrowing(benchmark::State& state) {
+    std::vector<Value> values;
+    for (int i = 0; i < 1024; ++i) {
+        values.emplace_back(int32_t(i % 200));     // Some fit INT8, some do not
+    }
+    for (auto _ : state) {
+        for (const auto& v : values) {
+            benchmark::DoNotOptimize(convert_value_type(v, ValueType::INT8));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(values.size()));
+    set_instrumented(state);
+}
+BENCHMARK(BM_ConvertValueTypeNarrowing);
+
+static void BM_ValuesEqualStruct(benchmark::State& state) {
+    const Value a = make_route(static_cast<size_t>(state.range(0)));
+    const Value b = make_route(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(values_equal(a, b));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    set_instrumented(state);
+}
+BENCHMARK(BM_ValuesEqualStruct)->Arg(16)->Arg(256);
+
+static void BM_ValidateStruct(benchmark::State& state) {
+    StructRegistry registry;
+    FieldDefinition speed("Speed", ValueType::FLOAT);
+    speed.constraints.min = 0.0;
+    speed.constraints.max = 300.0;
+    StructDefinition waypoint("Waypoint");
+    waypoint.add_field(FieldDefinition("Latitude", ValueType::DOUBLE))
+            .add_field(FieldDefinition("Longitude", ValueType::DOUBLE))
+            .add_field(speed);
+    registry.register_struct(waypoint);
+
+    StructValue value("Waypoint");
+    value.set_field("Latitude", 48.1);
+    value.set_field("Longitude", 11.5);
+    value.set_field("Speed", 50.0f);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(validate_struct(value, registry));
+    }
+    state.SetItemsProcessed(state.iterations());
+    set_instrumented(state);
+}
+BENCHMARK(BM_ValidateStruct);
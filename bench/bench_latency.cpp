@@ -0,0 +1,99 @@
+/**
+ * @file bench_latency.cpp
+ * @brief Benchmarks for latency histograms and stage instrumentation
+ *
+ * Measures the cost of one recorded sample (plain histogram, sharded
+ * recorder, contended recorder) and the overhead a stage recorder adds to
+ * ConstraintChecker::apply().
+ */
+
+#include <vss/types/latency.hpp>
+#include <vss/types/constraints.hpp>
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <random>
+#include <vector>
+
+using namespace vss::types;
+
+namespace {
+
+std::vector<std::chrono::nanoseconds> make_latencies(size_t count) {
+    std::mt19937 rng(42);
+    std::lognormal_distribution<double> dist(10.0, 1.5);    // Median ~22 us, long tail
+    std::vector<std::chrono::nanoseconds> latencies(count);
+    for (auto& l : latencies) {
+        l = std::chrono::nanoseconds(static_cast<int64_t>(dist(rng)));
+    }
+    return latencies;
+}
+
+LatencyRecorder& shared_recorder() {
+    static LatencyRecorder recorder;
+    return recorder;
+}
+
+} // namespace
+
+static void BM_LatencyHistogramRecord(benchmark::State& state) {
+    const auto latencies = make_latencies(4096);
+    LatencyHistogram histogram;
+    for (auto _ : state) {
+        for (auto l : latencies) {
+            histogram.record(l);
+        }
+    }
+    benchmark::DoNotOptimize(histogram.count());
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(latencies.size()));
+}
+BENCHMARK(BM_LatencyHistogramRecord);
+
+static void BM_LatencyRecorderRecord(benchmark::State& state) {
+    const auto latencies = make_latencies(4096);
+    LatencyRecorder& recorder = shared_recorder();
+    for (auto _ : state) {
+        for (auto l : latencies) {
+            recorder.record(l);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(latencies.size()));
+}
+BENCHMARK(BM_LatencyRecorderRecord)->Threads(1)->Threads(4);
+
+static void BM_LatencyRecorderSnapshot(benchmark::State& state) {
+    LatencyRecorder recorder;
+    for (auto l : make_latencies(100000)) {
+        recorder.record(l);
+    }
+    for (auto _ : state) {
+        auto summary = recorder.snapshot().summary();
+        benchmark::DoNotOptimize(summary);
+    }
+}
+BENCHMARK(BM_LatencyRecorderSnapshot);
+
+// Arg 0: no recorder installed, Arg 1: VALIDATION recorder installed
+static void BM_ValidationStageOverhead(benchmark::State& state) {
+    std::vector<DynamicQualifiedValue> slots;
+    const auto ts = std::chrono::system_clock::now();
+    for (int i = 0; i < 1024; ++i) {
+        slots.emplace_back(Value{static_cast<float>(i % 300)}, SignalQuality::VALID, ts);
+    }
+    ValueConstraints constraints;
+    constraints.min = 0.0;
+    constraints.max = 250.0;
+    ConstraintChecker checker{constraints};
+
+    LatencyRecorder recorder;
+    LatencyRecorder* previous = set_stage_recorder(PipelineStage::VALIDATION,
+                                                   state.range(0) ? &recorder : nullptr);
+    for (auto _ : state) {
+        for (auto& slot : slots) {
+            slot.quality = SignalQuality::VALID;
+        }
+        benchmark::DoNotOptimize(checker.apply(slots.data(), slots.size()));
+    }
+    set_stage_recorder(PipelineStage::VALIDATION, previous);
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(slots.size()));
+}
+BENCHMARK(BM_ValidationStageOverhead)->Arg(0)->Arg(1);
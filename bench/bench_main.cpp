@@ -0,0 +1,384 @@
+/**
+ * @file bench_main.cpp
+ * @brief Benchmark entry point with a baseline comparison mode
+ *
+ * Accepts all Google Benchmark flags, plus:
+ *
+ *   --baseline=FILE              Compare CPU time per iteration against a
+ *                                JSON file written earlier with
+ *                                --benchmark_out=FILE --benchmark_out_format=json
+ *   --regression_threshold=PCT   Slowdown reported as a regression (default 10)
+ *   --hw_counters                Report hardware counters per item for the
+ *                                benchmarks that use PerfScope (Linux only,
+ *                                see perf_counters.hpp)
+ *
+ * In baseline mode, a table of the benchmarks present in both runs is
+ * printed after the normal output, and the exit code is 1 if any of them
+ * regressed. When a name occurs several times (--benchmark_repetitions),
+ * the fastest run on each side is compared.
+ *
+ * Example:
+ * @code{.sh}
+ * vss-types-bench --benchmark_out=base.json --benchmark_out_format=json
+ * # ... change the code, rebuild ...
+ * vss-types-bench --baseline=base.json --benchmark_filter=BM_Convert
+ * @endcode
+ */
+
+#include "perf_counters.hpp"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+// ============================================================================
+// Minimal JSON reader for Google Benchmark output
+// ============================================================================
+
+// Reads the flat objects of the top-level "benchmarks" array; nested
+// values are skipped. Only as much JSON as the benchmark writer emits.
+class BaselineReader {
+public:
+    explicit BaselineReader(std::string text) : text_(std::move(text)) {}
+
+    // name -> fastest CPU time in ns, or nullopt on a parse error
+    std::optional<std::map<std::string, double>> read() {
+        std::map<std::string, double> times;
+        skip_ws();
+        if (!consume('{')) {
+            return std::nullopt;
+        }
+        while (true) {
+            skip_ws();
+            if (consume('}')) {
+                return times;
+            }
+            auto key = parse_string();
+            skip_ws();
+            if (!key || !consume(':')) {
+                return std::nullopt;
+            }
+            skip_ws();
+            if (*key == "benchmarks") {
+                if (!read_benchmarks(times)) {
+                    return std::nullopt;
+                }
+            } else if (!skip_value()) {
+                return std::nullopt;
+            }
+            skip_ws();
+            consume(',');
+        }
+    }
+
+private:
+    bool read_benchmarks(std::map<std::string, double>& times) {
+        if (!consume('[')) {
+            return false;
+        }
+        while (true) {
+            skip_ws();
+            if (consume(']')) {
+                return true;
+            }
+            if (!consume('{')) {
+                return false;
+            }
+            std::map<std::string, std::string> fields;
+            while (true) {
+                skip_ws();
+                if (consume('}')) {
+                    break;
+                }
+                auto key = parse_string();
+                skip_ws();
+                if (!key || !consume(':')) {
+                    return false;
+                }
+                skip_ws();
+                if (peek() == '"') {
+                    auto value = parse_string();
+                    if (!value) {
+                        return false;
+                    }
+                    fields[*key] = *value;
+                } else {
+                    const size_t start = pos_;
+                    if (!skip_value()) {
+                        return false;
+                    }
+                    fields[*key] = text_.substr(start, pos_ - start);
+                }
+                skip_ws();
+                consume(',');
+            }
+            add_run(fields, times);
+            skip_ws();
+            consume(',');
+        }
+    }
+
+    static void add_run(const std::map<std::string, std::string>& fields, std::map<std::string, double>& times) {
+        auto name = fields.find("name");
+        auto cpu = fields.find("cpu_time");
+        auto run_type = fields.find("run_type");
+        if (name == fields.end() || cpu == fields.end() ||
+            (run_type != fields.end() && run_type->second != "iteration")) {
+            return;
+        }
+        auto unit = fields.find("time_unit");
+        const double ns = std::strtod(cpu->second.c_str(), nullptr) *
+                          to_ns(unit == fields.end() ? "ns" : unit->second);
+        auto [it, inserted] = times.emplace(name->second, ns);
+        if (!inserted) {
+            it->second = std::min(it->second, ns);
+        }
+    }
+
+    static double to_ns(const std::string& unit) {
+        if (unit == "us") return 1e3;
+        if (unit == "ms") return 1e6;
+        if (unit == "s") return 1e9;
+        return 1.0;
+    }
+
+    char peek() const { return pos_ < text_.size() ? text_[pos_] : '\0'; }
+
+    bool consume(char c) {
+        if (peek() != c) {
+            return false;
+        }
+        ++pos_;
+        return true;
+    }
+
+    void skip_ws() {
+        while (pos_ < text_.size() && std::isspace(static_cast<unsigned char>(text_[pos_]))) {
+            ++pos_;
+        }
+    }
+
+    std::optional<std::string> parse_string() {
+        if (!consume('"')) {
+            return std::nullopt;
+        }
+        std::string out;
+        while (pos_ < text_.size()) {
+            char c = text_[pos_++];
+            if (c == '"') {
+                return out;
+            }
+            if (c == '\\' && pos_ < text_.size()) {
+                c = text_[pos_++];
+                switch (c) {
+                    case 'n': out += '\n'; break;
+                    case 't': out += '\t'; break;
+                    case 'u': pos_ = std::min(pos_ + 4, text_.size()); out += '?'; break;
+                    default: out += c; break;
+                }
+            } else {
+                out += c;
+            }
+        }
+        return std::nullopt;
+    }
+
+    bool skip_value() {
+        const char c = peek();
+        if (c == '"') {
+            return parse_string().has_value();
+        }
+        if (c == '{' || c == '[') {
+            const char close = c == '{' ? '}' : ']';
+            ++pos_;
+            while (true) {
+                skip_ws();
+                if (consume(close)) {
+                    return true;
+                }
+                if (c == '{') {
+                    skip_ws();
+                    if (!parse_string() || (skip_ws(), !consume(':'))) {
+                        return false;
+                    }
+                    skip_ws();
+                }
+                if (!skip_value()) {
+                    return false;
+                }
+                skip_ws();
+                consume(',');
+            }
+        }
+        // Number, true, false, null
+        const size_t start = pos_;
+        while (pos_ < text_.size() && (std::isalnum(static_cast<unsigned char>(text_[pos_])) ||
+                                       std::strchr("+-.", text_[pos_]))) {
+            ++pos_;
+        }
+        return pos_ > start;
+    }
+
+    std::string text_;
+    size_t pos_ = 0;
+};
+
+// ============================================================================
+// Reporter that records CPU times next to the console output
+// ============================================================================
+
+class RecordingReporter : public benchmark::ConsoleReporter {
+public:
+    void ReportRuns(const std::vector<Run>& runs) override {
+        ConsoleReporter::ReportRuns(runs);
+        for (const auto& run : runs) {
+            if (run.run_type != Run::RT_Iteration || run.iterations == 0) {
+                continue;
+            }
+            const double ns = run.GetAdjustedCPUTime() * 1e9 / benchmark::GetTimeUnitMultiplier(run.time_unit);
+            auto [it, inserted] = times.emplace(run.benchmark_name(), ns);
+            if (!inserted) {
+                it->second = std::min(it->second, ns);
+            }
+        }
+    }
+
+    std::map<std::string, double> times;
+};
+
+std::string format_ns(double ns) {
+    char buf[32];
+    if (ns >= 1e6) {
+        std::snprintf(buf, sizeof(buf), "%.2f ms", ns / 1e6);
+    } else if (ns >= 1e3) {
+        std::snprintf(buf, sizeof(buf), "%.2f us", ns / 1e3);
+    } else {
+        std::snprintf(buf, sizeof(buf), "%.1f ns", ns);
+    }
+    return buf;
+}
+
+// Prints the comparison; returns the number of regressions
+size_t compare(const std::map<std::string, double>& baseline, const std::map<std::string, double>& current,
+               double threshold_pct) {
+    size_t width = 9;
+    for (const auto& [name, _] : current) {
+        if (baseline.count(name)) {
+            width = std::max(width, name.size());
+        }
+    }
+
+    std::printf("\nComparison against baseline (CPU time, threshold %.1f%%)\n", threshold_pct);
+    std::printf("%-*s %12s %12s %9s\n", static_cast<int>(width), "Benchmark", "Baseline", "Current", "Change");
+    size_t regressions = 0, improvements = 0, unchanged = 0, added = 0;
+    for (const auto& [name, ns] : current) {
+        auto it = baseline.find(name);
+        if (it == baseline.end() || it->second <= 0.0) {
+            ++added;
+            continue;
+        }
+        const double change = (ns - it->second) / it->second * 100.0;
+        const char* verdict = "";
+        if (change > threshold_pct) {
+            verdict = "  REGRESSION";
+            ++regressions;
+        } else if (change < -threshold_pct) {
+            verdict = "  improved";
+            ++improvements;
+        } else {
+            ++unchanged;
+        }
+        std::printf("%-*s %12s %12s %+8.1f%%%s\n", static_cast<int>(width), name.c_str(),
+                    format_ns(it->second).c_str(), format_ns(ns).c_str(), change, verdict);
+    }
+    std::printf("%zu regressed, %zu improved, %zu unchanged, %zu not in baseline\n",
+                regressions, improvements, unchanged, added);
+    return regressions;
+}
+
+// Removes "--name=value" from argv and returns the value
+std::optional<std::string> take_flag(int& argc, char** argv, const char* name) {
+    const std::string prefix = std::string("--") + name + "=";
+    std::optional<std::string> value;
+    int out = 1;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strncmp(argv[i], prefix.c_str(), prefix.size()) == 0) {
+            value = std::string(argv[i] + prefix.size());
+        } else {
+            argv[out++] = argv[i];
+        }
+    }
+    argc = out;
+    return value;
+}
+
+// Removes "--name" (or "--name=true") from argv and returns whether it was present
+bool take_switch(int& argc, char** argv, const char* name) {
+    const std::string flag = std::string("--") + name;
+    bool present = false;
+    int out = 1;
+    for (int i = 1; i < argc; ++i) {
+        if (flag == argv[i] || flag + "=true" == argv[i]) {
+            present = true;
+        } else {
+            argv[out++] = argv[i];
+        }
+    }
+    argc = out;
+    return present;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const auto baseline_path = take_flag(argc, argv, "baseline");
+    const auto threshold_arg = take_flag(argc, argv, "regression_threshold");
+    const double threshold = threshold_arg ? std::strtod(threshold_arg->c_str(), nullptr) : 10.0;
+
+    if (take_switch(argc, argv, "hw_counters")) {
+        PerfCounters& counters = PerfCounters::instance();
+        if (!counters.open()) {
+            std::fprintf(stderr, "Hardware counters unavailable, continuing without them: %s\n",
+                         counters.error().c_str());
+        } else if (!counters.error().empty()) {
+            std::fprintf(stderr, "Hardware counters: %s\n", counters.error().c_str());
+        }
+    }
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+
+    if (!baseline_path) {
+        benchmark::RunSpecifiedBenchmarks();
+        benchmark::Shutdown();
+        return 0;
+    }
+
+    std::ifstream in(*baseline_path);
+    std::stringstream text;
+    if (in) {
+        text << in.rdbuf();
+    }
+    auto baseline = BaselineReader(text.str()).read();
+    if (!baseline) {
+        std::fprintf(stderr, "Cannot read benchmark baseline '%s'\n", baseline_path->c_str());
+        return 2;
+    }
+
+    RecordingReporter reporter;
+    benchmark::RunSpecifiedBenchmarks(&reporter);
+    benchmark::Shutdown();
+    return compare(*baseline, reporter.times, threshold) > 0 ? 1 : 0;
+}
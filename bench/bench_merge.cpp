@@ -0,0 +1,52 @@
+/**
+ * @file bench_merge.cpp
+ * @brief Benchmarks for the k-way update merge
+ */
+
+#include <vss/types/merge.hpp>
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <random>
+
+using namespace vss::types;
+
+// Args: sources, updates per source
+static void BM_MergeSources(benchmark::State& state) {
+    const size_t k = static_cast<size_t>(state.range(0));
+    const size_t per_source = static_cast<size_t>(state.range(1));
+
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> step(1, 1000);
+    std::vector<std::vector<SignalUpdate>> data(k);
+    for (size_t s = 0; s < k; ++s) {
+        int64_t t = 0;
+        data[s].reserve(per_source);
+        for (size_t i = 0; i < per_source; ++i) {
+            t += step(rng);
+            data[s].emplace_back(static_cast<SignalId>(s),
+                                 DynamicQualifiedValue{Value{double(i)}, SignalQuality::VALID,
+                                                       std::chrono::system_clock::time_point(std::chrono::microseconds(t))});
+        }
+    }
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::vector<std::unique_ptr<VectorUpdateSource>> sources;
+        std::vector<UpdateSource*> pointers;
+        for (const auto& d : data) {
+            sources.push_back(std::make_unique<VectorUpdateSource>(d));
+            pointers.push_back(sources.back().get());
+        }
+        state.ResumeTiming();
+
+        UpdateMerger merger(pointers);
+        SignalUpdate update;
+        size_t count = 0;
+        while (merger.next(update)) {
+            ++count;
+        }
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(k * per_source));
+}
+BENCHMARK(BM_MergeSources)->Args({16, 10000})->Args({4096, 100});
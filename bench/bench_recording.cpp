@@ -0,0 +1,68 @@
+/**
+ * @file bench_recording.cpp
+ * @brief Benchmarks for writing and scanning recordings
+ */
+
+#include <vss/types/recording.hpp>
+#include <benchmark/benchmark.h>
+#include <cstdio>
+#include <filesystem>
+
+using namespace vss::types;
+
+namespace {
+
+std::string bench_path() {
+    return (std::filesystem::temp_directory_path() / "vss_bench.vssrec").string();
+}
+
+void write_recording(const std::string& path, size_t count) {
+    RecordingWriter writer;
+    writer.open(path);
+    for (size_t i = 0; i < count; ++i) {
+        writer.write(static_cast<SignalId>(i % 256),
+                     DynamicQualifiedValue{Value{double(i)}, SignalQuality::VALID,
+                                           std::chrono::system_clock::time_point(std::chrono::microseconds(i * 100))});
+    }
+    writer.close();
+}
+
+} // namespace
+
+static void BM_RecordingWrite(benchmark::State& state) {
+    const auto path = bench_path();
+    for (auto _ : state) {
+        write_recording(path, 1000000);
+    }
+    std::filesystem::remove(path);
+    state.SetItemsProcessed(state.iterations() * 1000000);
+}
+BENCHMARK(BM_RecordingWrite)->Unit(benchmark::kMillisecond);
+
+// Args: 0 = full scan, 1 = one signal, 2 = 1% time range
+static void BM_RecordingScan(benchmark::State& state) {
+    const auto path = bench_path();
+    write_recording(path, 1000000);
+    RecordingReader reader;
+    reader.open(path);
+
+    SignalSet one;
+    one.insert(42);
+    RecordQuery query;
+    if (state.range(0) == 1) {
+        query.signals = &one;
+    } else if (state.range(0) == 2) {
+        query.begin = std::chrono::system_clock::time_point(std::chrono::seconds(50));
+        query.end = std::chrono::system_clock::time_point(std::chrono::seconds(51));
+    }
+
+    for (auto _ : state) {
+        double sum = 0.0;
+        reader.scan(query, [&](const RecordView& r) { sum += r.scalar<double>().value_or(0.0); });
+        benchmark::DoNotOptimize(sum);
+    }
+    reader.close();
+    std::filesystem::remove(path);
+    state.SetItemsProcessed(state.iterations() * 1000000);
+}
+BENCHMARK(BM_RecordingScan)->Arg(0)->Arg(1)->Arg(2)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,90 @@
+/**
+ * @file bench_reorder.cpp
+ * @brief Throughput and latency benchmarks for the reorder buffer
+ */
+
+#include <vss/types/reorder.hpp>
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <random>
+
+using namespace vss::types;
+
+namespace {
+
+/**
+ * @brief Updates 1ms apart, delivered with up to `jitter_ms` of delay
+ */
+std::vector<SignalUpdate> jittered(size_t count, int jitter_ms) {
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> jitter(0, jitter_ms);
+    std::vector<std::pair<int64_t, size_t>> order;
+    for (size_t i = 0; i < count; ++i) {
+        order.emplace_back(static_cast<int64_t>(i) + jitter(rng), i);
+    }
+    std::sort(order.begin(), order.end());
+
+    std::vector<SignalUpdate> updates;
+    updates.reserve(count);
+    for (const auto& entry : order) {
+        updates.emplace_back(static_cast<SignalId>(entry.second % 64),
+                             DynamicQualifiedValue{Value{double(entry.second)}, SignalQuality::VALID,
+                                                   std::chrono::system_clock::time_point(
+                                                       std::chrono::milliseconds(entry.second))});
+    }
+    return updates;
+}
+
+} // namespace
+
+// Args: jitter (ms), watermark delay (ms)
+static void BM_ReorderThroughput(benchmark::State& state) {
+    const auto updates = jittered(100000, static_cast<int>(state.range(0)));
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto input = updates;
+        state.ResumeTiming();
+
+        ReorderBuffer reorder(std::chrono::milliseconds(state.range(1)), 4096);
+        double sink = 0.0;
+        reorder.set_release_handler([&](SignalUpdate&& u) { sink += std::get<double>(u.value.value); });
+        for (auto& u : input) {
+            reorder.push(std::move(u));
+        }
+        reorder.flush();
+        benchmark::DoNotOptimize(sink);
+    }
+    state.SetItemsProcessed(state.iterations() * 100000);
+}
+BENCHMARK(BM_ReorderThroughput)->Args({10, 10})->Args({500, 500});
+
+// Per-push processing latency (push plus the releases it triggers), as percentiles
+static void BM_ReorderPushLatency(benchmark::State& state) {
+    const size_t count = 100000;
+    const auto updates = jittered(count, 50);
+    std::vector<int64_t> latencies(count);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto input = updates;
+        state.ResumeTiming();
+
+        ReorderBuffer reorder(std::chrono::milliseconds(50), 4096);
+        size_t released = 0;
+        reorder.set_release_handler([&](SignalUpdate&&) { ++released; });
+        for (size_t i = 0; i < count; ++i) {
+            auto begin = std::chrono::steady_clock::now();
+            reorder.push(std::move(input[i]));
+            latencies[i] = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - begin).count();
+        }
+        benchmark::DoNotOptimize(released);
+    }
+
+    std::sort(latencies.begin(), latencies.end());
+    state.counters["p50_ns"] = static_cast<double>(latencies[count / 2]);
+    state.counters["p99_ns"] = static_cast<double>(latencies[count * 99 / 100]);
+    state.counters["max_ns"] = static_cast<double>(latencies.back());
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(count));
+}
+BENCHMARK(BM_ReorderPushLatency);
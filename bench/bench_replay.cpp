@@ -0,0 +1,46 @@
+/**
+ * @file bench_replay.cpp
+ * @brief Benchmarks for unthrottled replay
+ */
+
+#include <vss/types/replay.hpp>
+#include <benchmark/benchmark.h>
+#include <filesystem>
+
+using namespace vss::types;
+
+static void BM_ReplayRecording(benchmark::State& state) {
+    const auto path = (std::filesystem::temp_directory_path() / "vss_bench_replay.vssrec").string();
+    {
+        RecordingWriter writer;
+        writer.open(path);
+        for (size_t i = 0; i < 1000000; ++i) {
+            writer.write(static_cast<SignalId>(i % 256),
+                         DynamicQualifiedValue{Value{float(i)}, SignalQuality::VALID,
+                                               std::chrono::system_clock::time_point(std::chrono::microseconds(i * 100))});
+        }
+    }
+    RecordingReader reader;
+    reader.open(path);
+
+    ReplayOptions options;
+    options.speed = 0;
+    ReplayEngine replay(options);
+    double sum = 0.0;
+    replay.add_consumer([&](const std::vector<SignalUpdate>& batch) {
+        for (const auto& u : batch) {
+            sum += std::get<float>(u.value.value);
+        }
+    });
+
+    double rate = 0.0;
+    for (auto _ : state) {
+        rate = replay.run(reader).events_per_second();
+    }
+    benchmark::DoNotOptimize(sum);
+    state.counters["events_per_s"] = rate;
+    state.SetItemsProcessed(state.iterations() * 1000000);
+    reader.close();
+    std::filesystem::remove(path);
+}
+BENCHMARK(BM_ReplayRecording)->Unit(benchmark::kMillisecond);
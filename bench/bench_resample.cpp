@@ -0,0 +1,44 @@
+/**
+ * @file bench_resample.cpp
+ * @brief Benchmarks for multi-signal resampling
+ */
+
+#include <vss/types/resample.hpp>
+#include <benchmark/benchmark.h>
+#include <random>
+
+using namespace vss::types;
+
+// Args: signals
+static void BM_Resample(benchmark::State& state) {
+    const size_t signals = static_cast<size_t>(state.range(0));
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> jitter(1, 20);
+    std::normal_distribution<double> dist(0.0, 1.0);
+
+    std::vector<SignalSeries> histories(signals);
+    std::vector<SeriesView> views;
+    size_t total = 0;
+    for (auto& h : histories) {
+        int64_t t = 0;
+        while (t < 60000) {
+            h.append(std::chrono::system_clock::time_point(std::chrono::milliseconds(t)), dist(rng));
+            t += jitter(rng);
+        }
+        total += h.size();
+        views.push_back(h.view());
+    }
+
+    ResampleSpec spec;
+    spec.end = std::chrono::system_clock::time_point(std::chrono::seconds(60));
+    spec.period = std::chrono::milliseconds(10);
+    spec.mode = InterpolationMode::LINEAR;
+    spec.max_staleness = std::chrono::milliseconds(50);
+
+    for (auto _ : state) {
+        auto table = resample(views, spec);
+        benchmark::DoNotOptimize(table.values.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(total));
+}
+BENCHMARK(BM_Resample)->Arg(8)->Arg(64);
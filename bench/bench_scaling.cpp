@@ -0,0 +1,99 @@
+/**
+ * @file bench_scaling.cpp
+ * @brief Benchmarks for batch linear scaling
+ *
+ * Compares scaling one Value at a time (variant dispatch per sample) with
+ * the batch kernels in scaling.hpp.
+ */
+
+#include <vss/types/scaling.hpp>
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+using namespace vss::types;
+
+namespace {
+
+std::vector<uint16_t> make_raw(size_t count) {
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> dist(0, 0xFFFF);
+    std::vector<uint16_t> raw(count);
+    for (auto& r : raw) {
+        r = static_cast<uint16_t>(dist(rng));
+    }
+    return raw;
+}
+
+const ScalingParams PARAMS{0.01, -40.0, -40.0, 500.0};
+
+} // namespace
+
+static void BM_ScalePerValue(benchmark::State& state) {
+    const auto raw = make_raw(static_cast<size_t>(state.range(0)));
+    std::vector<DynamicQualifiedValue> slots(raw.size());
+    const auto ts = std::chrono::system_clock::now();
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < raw.size(); ++i) {
+            Value sample{raw[i]};
+            double value = std::visit([](auto&& v) -> double {
+                using T = std::decay_t<decltype(v)>;
+                if constexpr (std::is_arithmetic_v<T>) {
+                    return static_cast<double>(v);
+                } else {
+                    return 0.0;
+                }
+            }, sample);
+            double physical = value * PARAMS.factor + PARAMS.offset;
+            bool ok = physical >= *PARAMS.min && physical <= *PARAMS.max;
+            slots[i].value = ok ? Value{static_cast<float>(physical)} : Value{std::monostate{}};
+            slots[i].quality = ok ? SignalQuality::VALID : SignalQuality::INVALID;
+            slots[i].timestamp = ts;
+        }
+        benchmark::DoNotOptimize(slots.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ScalePerValue)->Arg(64)->Arg(1024)->Arg(16384);
+
+static void BM_ScaleLinear(benchmark::State& state) {
+    const auto raw = make_raw(static_cast<size_t>(state.range(0)));
+    std::vector<float> out(raw.size());
+    std::vector<SignalQuality> quality(raw.size());
+
+    for (auto _ : state) {
+        size_t bad = scale_linear(raw.data(), raw.size(), PARAMS, out.data(), quality.data());
+        benchmark::DoNotOptimize(bad);
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ScaleLinear)->Arg(64)->Arg(1024)->Arg(16384);
+
+static void BM_ScaleIntoSlots(benchmark::State& state) {
+    const auto raw = make_raw(static_cast<size_t>(state.range(0)));
+    std::vector<DynamicQualifiedValue> slots(raw.size());
+    const auto ts = std::chrono::system_clock::now();
+
+    for (auto _ : state) {
+        size_t bad = scale_into_slots(raw.data(), raw.size(), PARAMS, ValueType::FLOAT, slots.data(), ts);
+        benchmark::DoNotOptimize(bad);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ScaleIntoSlots)->Arg(64)->Arg(1024)->Arg(16384);
+
+static void BM_ScaleArray(benchmark::State& state) {
+    const auto raw = make_raw(static_cast<size_t>(state.range(0)));
+    const Value raw_value{raw};
+
+    for (auto _ : state) {
+        Value scaled = scale_array(raw_value, PARAMS, ValueType::FLOAT_ARRAY);
+        benchmark::DoNotOptimize(scaled);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ScaleArray)->Arg(64)->Arg(1024)->Arg(16384);
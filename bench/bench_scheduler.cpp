@@ -0,0 +1,79 @@
+/**
+ * @file bench_scheduler.cpp
+ * @brief Tail latency of critical signals under saturation
+ */
+
+#include <vss/types/scheduler.hpp>
+#include <vss/types/stats.hpp>
+#include <benchmark/benchmark.h>
+
+using namespace vss::types;
+
+namespace {
+
+// Per cycle 64 infotainment updates and 1 brake update are offered, but
+// the consumer only takes 48: the backlog grows until the queues are
+// full, as on an overloaded gateway.
+constexpr int LOW_PER_CYCLE = 64;
+constexpr size_t DISPATCH_PER_CYCLE = 48;
+
+} // namespace
+
+// Arg: 0 = FIFO (all signals NORMAL), 1 = brake signal CRITICAL
+static void BM_SchedulerCriticalLatency(benchmark::State& state) {
+    SignalCatalog catalog;
+    const SignalId brake = *catalog.add_signal("Vehicle.Brake.IsEngaged", NodeType::SENSOR, ValueType::BOOL);
+    const SignalId title = *catalog.add_signal("Vehicle.Infotainment.Title", NodeType::SENSOR, ValueType::STRING);
+    if (state.range(0) != 0) {
+        catalog.set_priority(brake, PriorityClass::CRITICAL, std::chrono::milliseconds(1));
+        catalog.set_priority(title, PriorityClass::LOW);
+    } else {
+        catalog.set_priority(brake, PriorityClass::NORMAL, std::chrono::milliseconds(1));
+    }
+
+    UpdateScheduler scheduler(catalog);
+    QuantileSketch latency;
+    std::vector<SignalUpdate> out;
+    out.reserve(DISPATCH_PER_CYCLE);
+    const std::string text = "Now playing: a rather long song title";
+
+    for (auto _ : state) {
+        for (int i = 0; i < LOW_PER_CYCLE; ++i) {
+            scheduler.submit(SignalUpdate{title, DynamicQualifiedValue{Value{text}, SignalQuality::VALID,
+                                                                       vss::types::now()}});
+        }
+        scheduler.submit(SignalUpdate{brake, DynamicQualifiedValue{Value{true}, SignalQuality::VALID,
+                                                                   vss::types::now()}});
+
+        out.clear();
+        scheduler.dispatch(out, DISPATCH_PER_CYCLE);
+        const auto now = vss::types::now();
+        for (const auto& u : out) {
+            if (u.id == brake) {
+                latency.add(static_cast<double>((now - u.value.timestamp).count()));
+            }
+        }
+    }
+
+    const PriorityStats stats = scheduler.stats(scheduler.priority(brake));
+    state.counters["p50_ns"] = latency.quantile(0.5).value_or(0.0);
+    state.counters["p99_ns"] = latency.quantile(0.99).value_or(0.0);
+    state.counters["max_ns"] = static_cast<double>(stats.max_latency.count());
+    state.counters["brake_misses"] = static_cast<double>(stats.deadline_misses);
+    state.counters["brake_dropped"] = static_cast<double>(stats.dropped);
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(DISPATCH_PER_CYCLE));
+}
+BENCHMARK(BM_SchedulerCriticalLatency)->Arg(0)->Arg(1);
+
+static void BM_MpmcQueuePushPop(benchmark::State& state) {
+    MpmcQueue<SignalUpdate> queue(1024);
+    SignalUpdate u{1, DynamicQualifiedValue{Value{1.0}, SignalQuality::VALID, std::chrono::system_clock::time_point{}}};
+    SignalUpdate v;
+    for (auto _ : state) {
+        queue.try_push(u);
+        queue.try_pop(v);
+        benchmark::DoNotOptimize(v);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_MpmcQueuePushPop);
@@ -0,0 +1,63 @@
+/**
+ * @file bench_stats.cpp
+ * @brief Benchmarks for windowed statistics
+ */
+
+#include <vss/types/stats.hpp>
+#include <benchmark/benchmark.h>
+#include <random>
+
+using namespace vss::types;
+
+namespace {
+
+SignalSeries make_series(size_t count) {
+    SignalSeries series;
+    series.reserve(count);
+    std::mt19937 rng(42);
+    std::normal_distribution<double> dist(80.0, 15.0);
+    for (size_t i = 0; i < count; ++i) {
+        auto ts = std::chrono::system_clock::time_point(std::chrono::milliseconds(i));
+        series.append(ts, dist(rng), i % 50 == 0 ? SignalQuality::INVALID : SignalQuality::VALID);
+    }
+    return series;
+}
+
+} // namespace
+
+static void BM_WindowPerSample(benchmark::State& state) {
+    const auto series = make_series(static_cast<size_t>(state.range(0)));
+    const auto view = series.view();
+    const bool percentiles = state.range(1) != 0;
+
+    for (auto _ : state) {
+        WindowAggregator agg{WindowSpec::sliding(std::chrono::seconds(1), std::chrono::milliseconds(100),
+                                                 percentiles ? std::vector<double>{0.5, 0.99} : std::vector<double>{})};
+        double sink = 0.0;
+        agg.set_callback([&](const WindowResult& w) { sink += w.stats.mean; });
+        for (size_t i = 0; i < view.size; ++i) {
+            agg.add(view.timestamps[i], view.values[i], view.quality(i));
+        }
+        agg.flush();
+        benchmark::DoNotOptimize(sink);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_WindowPerSample)->Args({100000, 0})->Args({100000, 1});
+
+static void BM_WindowBatch(benchmark::State& state) {
+    const auto series = make_series(static_cast<size_t>(state.range(0)));
+    const bool percentiles = state.range(1) != 0;
+
+    for (auto _ : state) {
+        WindowAggregator agg{WindowSpec::sliding(std::chrono::seconds(1), std::chrono::milliseconds(100),
+                                                 percentiles ? std::vector<double>{0.5, 0.99} : std::vector<double>{})};
+        double sink = 0.0;
+        agg.set_callback([&](const WindowResult& w) { sink += w.stats.mean; });
+        agg.add_batch(series.view());
+        agg.flush();
+        benchmark::DoNotOptimize(sink);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_WindowBatch)->Args({100000, 0})->Args({100000, 1});
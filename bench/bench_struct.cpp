@@ -0,0 +1,149 @@
+/**
+ * @file bench_struct.cpp
+ * @brief Benchmarks for struct validation, default construction and field updates
+ */
+
+#include "bench_alloc.hpp"
+#include "perf_counters.hpp"
+#include <vss/types/struct.hpp>
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace vss::types;
+using vss::types::test::AllocationScope;
+
+namespace {
+
+std::string field_name(int64_t i) {
+    return "Field" + std::to_string(i);
+}
+
+// "Payload" with `fields` fields cycling through float, uint16 with a range
+// constraint, string and bool, each with a default value; "Envelope" holds
+// a Payload and a sequence number
+StructRegistry make_registry(int64_t fields) {
+    StructRegistry registry;
+    StructDefinition payload("Payload");
+    for (int64_t i = 0; i < fields; ++i) {
+        const ValueType types[] = {ValueType::FLOAT, ValueType::UINT16, ValueType::STRING, ValueType::BOOL};
+        const Value defaults[] = {Value{1.5f}, Value{uint16_t(10)}, Value{std::string("id")}, Value{true}};
+        FieldDefinition field(field_name(i), types[i % 4]);
+        field.default_value = defaults[i % 4];
+        if (i % 4 == 1) {
+            field.constraints.min = 0.0;
+            field.constraints.max = 1000.0;
+        }
+        payload.add_field(field);
+    }
+    registry.register_struct(payload);
+
+    StructDefinition envelope("Envelope");
+    envelope.add_field(FieldDefinition("Sequence", ValueType::UINT32))
+            .add_field(FieldDefinition("Payload", ValueType::STRUCT));
+    registry.register_struct(envelope);
+    return registry;
+}
+
+} // namespace
+
+static void BM_ValidateStructFlat(benchmark::State& state) {
+    const auto registry = make_registry(state.range(0));
+    const auto value = create_default_struct("Payload", registry);
+    AllocationScope allocations;
+    PerfScope perf;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(validate_struct(*value, registry));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    perf.report(state);
+    report_allocations(state, allocations);
+}
+BENCHMARK(BM_ValidateStructFlat)->Arg(4)->Arg(16)->Arg(64);
+
+static void BM_ValidateStructNested(benchmark::State& state) {
+    const auto registry = make_registry(state.range(0));
+    StructValue envelope("Envelope");
+    envelope.set_field("Sequence", uint32_t(7));
+    envelope.set_field("Payload", std::make_shared<StructValue>(*create_default_struct("Payload", registry)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(validate_struct(envelope, registry));
+    }
+    state.SetItemsProcessed(state.iterations() * (state.range(0) + 2));
+}
+BENCHMARK(BM_ValidateStructNested)->Arg(4)->Arg(64);
+
+static void BM_ValidateStructInvalid(benchmark::State& state) {
+    const auto registry = make_registry(state.range(0));
+    auto value = *create_default_struct("Payload", registry);
+    value.set_field(field_name(state.range(0) - 1), int32_t(-1));     // Type mismatch in the last field
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(validate_struct(value, registry));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ValidateStructInvalid)->Arg(4)->Arg(64);
+
+static void BM_CreateDefaultStruct(benchmark::State& state) {
+    const auto registry = make_registry(state.range(0));
+    AllocationScope allocations;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(create_default_struct("Payload", registry));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    report_allocations(state, allocations);
+}
+BENCHMARK(BM_CreateDefaultStruct)->Arg(4)->Arg(16)->Arg(64);
+
+namespace {
+
+// `fields` updates alternating between a 64-element float array and a
+// string too long for the small-string buffer
+std::vector<std::pair<std::string, Value>> make_updates(int64_t fields) {
+    std::vector<std::pair<std::string, Value>> updates;
+    for (int64_t i = 0; i < fields; ++i) {
+        if (i % 2 == 0) {
+            updates.emplace_back(field_name(i), Value{std::vector<float>(64, static_cast<float>(i))});
+        } else {
+            updates.emplace_back(field_name(i), Value{std::string("sensor reading ") + std::to_string(i)});
+        }
+    }
+    return updates;
+}
+
+} // namespace
+
+// Update every field of an existing struct: set_field copies the value and
+// key, then replaces the field's storage
+static void BM_StructUpdateSetField(benchmark::State& state) {
+    const auto updates = make_updates(state.range(0));
+    StructValue value{"Payload"};
+    value.set_fields(updates);
+    AllocationScope allocations;
+    for (auto _ : state) {
+        for (const auto& [name, update] : updates) {
+            value.set_field(name, update);
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    report_allocations(state, allocations, state.range(0));
+}
+BENCHMARK(BM_StructUpdateSetField)->Arg(4)->Arg(64);
+
+// Same updates through assign_field, which copies into the existing buffers
+static void BM_StructUpdateAssignField(benchmark::State& state) {
+    const auto updates = make_updates(state.range(0));
+    StructValue value{"Payload"};
+    value.set_fields(updates);
+    AllocationScope allocations;
+    for (auto _ : state) {
+        value.set_fields(updates);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    report_allocations(state, allocations, state.range(0));
+}
+BENCHMARK(BM_StructUpdateAssignField)->Arg(4)->Arg(64);
@@ -0,0 +1,230 @@
+/**
+ * @file bench_value.cpp
+ * @brief Benchmarks for the Value helpers in value.hpp
+ *
+ * convert_value_type is registered for every compatible (from, to) pair,
+ * scalars over a batch of 1024 values and arrays at several sizes.
+ */
+
+#include "bench_alloc.hpp"
+#include "perf_counters.hpp"
+#include <vss/types/struct.hpp>
+#include <vss/types/value.hpp>
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace vss::types;
+using vss::types::test::AllocationScope;
+
+namespace {
+
+const ValueType ALL_TYPES[] = {
+    ValueType::STRING, ValueType::BOOL,
+    ValueType::INT8, ValueType::INT16, ValueType::INT32, ValueType::INT64,
+    ValueType::UINT8, ValueType::UINT16, ValueType::UINT32, ValueType::UINT64,
+    ValueType::FLOAT, ValueType::DOUBLE,
+    ValueType::STRING_ARRAY, ValueType::BOOL_ARRAY,
+    ValueType::INT8_ARRAY, ValueType::INT16_ARRAY, ValueType::INT32_ARRAY, ValueType::INT64_ARRAY,
+    ValueType::UINT8_ARRAY, ValueType::UINT16_ARRAY, ValueType::UINT32_ARRAY, ValueType::UINT64_ARRAY,
+    ValueType::FLOAT_ARRAY, ValueType::DOUBLE_ARRAY,
+    ValueType::STRUCT, ValueType::STRUCT_ARRAY,
+};
+
+template<typename T>
+std::vector<T> sequence(size_t n) {
+    std::vector<T> v(n);
+    for (size_t i = 0; i < n; ++i) {
+        v[i] = static_cast<T>(i % 100);     // Fits every numeric type
+    }
+    return v;
+}
+
+// A value of the given type; arrays have n elements, scalars are i % 100
+Value make_value(ValueType type, size_t n, size_t i = 0) {
+    const auto k = i % 100;
+    switch (type) {
+        case ValueType::STRING: return Value{std::string("value-") + std::to_string(k)};
+        case ValueType::BOOL: return Value{k % 2 == 0};
+        case ValueType::INT8: return Value{static_cast<int8_t>(k)};
+        case ValueType::INT16: return Value{static_cast<int16_t>(k)};
+        case ValueType::INT32: return Value{static_cast<int32_t>(k)};
+        case ValueType::INT64: return Value{static_cast<int64_t>(k)};
+        case ValueType::UINT8: return Value{static_cast<uint8_t>(k)};
+        case ValueType::UINT16: return Value{static_cast<uint16_t>(k)};
+        case ValueType::UINT32: return Value{static_cast<uint32_t>(k)};
+        case ValueType::UINT64: return Value{static_cast<uint64_t>(k)};
+        case ValueType::FLOAT: return Value{static_cast<float>(k)};
+        case ValueType::DOUBLE: return Value{static_cast<double>(k)};
+        case ValueType::STRING_ARRAY: return Value{std::vector<std::string>(n, "value")};
+        case ValueType::BOOL_ARRAY: return Value{std::vector<bool>(n, true)};
+        case ValueType::INT8_ARRAY: return Value{sequence<int8_t>(n)};
+        case ValueType::INT16_ARRAY: return Value{sequence<int16_t>(n)};
+        case ValueType::INT32_ARRAY: return Value{sequence<int32_t>(n)};
+        case ValueType::INT64_ARRAY: return Value{sequence<int64_t>(n)};
+        case ValueType::UINT8_ARRAY: return Value{sequence<uint8_t>(n)};
+        case ValueType::UINT16_ARRAY: return Value{sequence<uint16_t>(n)};
+        case ValueType::UINT32_ARRAY: return Value{sequence<uint32_t>(n)};
+        case ValueType::UINT64_ARRAY: return Value{sequence<uint64_t>(n)};
+        case ValueType::FLOAT_ARRAY: return Value{sequence<float>(n)};
+        case ValueType::DOUBLE_ARRAY: return Value{sequence<double>(n)};
+        case ValueType::STRUCT: return Value{std::make_shared<StructValue>("Point")};
+        case ValueType::STRUCT_ARRAY:
+            return Value{std::vector<std::shared_ptr<StructValue>>(n, std::make_shared<StructValue>("Point"))};
+        default: return Value{};
+    }
+}
+
+// Struct with `width` float fields and a nested struct `depth - 1` levels deep
+std::shared_ptr<StructValue> make_nested(int depth, int width) {
+    auto node = std::make_shared<StructValue>("Level" + std::to_string(depth));
+    for (int f = 0; f < width; ++f) {
+        node->set_field("Field" + std::to_string(f), static_cast<float>(f));
+    }
+    if (depth > 1) {
+        node->set_field("Child", make_nested(depth - 1, width));
+    }
+    return node;
+}
+
+void BM_ConvertScalar(benchmark::State& state, ValueType from, ValueType to) {
+    std::vector<Value> values;
+    for (size_t i = 0; i < 1024; ++i) {
+        values.push_back(make_value(from, 0, i));
+    }
+    AllocationScope allocations;
+    PerfScope perf;
+    for (auto _ : state) {
+        for (const auto& v : values) {
+            benchmark::DoNotOptimize(convert_value_type(v, to));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(values.size()));
+    perf.report(state, static_cast<int64_t>(values.size()));
+    report_allocations(state, allocations, static_cast<int64_t>(values.size()));
+}
+
+void BM_ConvertArray(benchmark::State& state, ValueType from, ValueType to) {
+    const Value value = make_value(from, static_cast<size_t>(state.range(0)));
+    AllocationScope allocations;
+    PerfScope perf;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(convert_value_type(value, to));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    perf.report(state);
+    report_allocations(state, allocations);
+}
+
+// One benchmark per compatible pair
+const bool conversions_registered = [] {
+    for (ValueType from : ALL_TYPES) {
+        for (ValueType to : ALL_TYPES) {
+            if (from == to || !are_types_compatible(to, from)) {
+                continue;
+            }
+            const std::string name = std::string("BM_ConvertValueType/") + value_type_to_string(from) +
+                                     "_to_" + value_type_to_string(to);
+            if (is_array(from)) {
+                benchmark::RegisterBenchmark(name.c_str(), BM_ConvertArray, from, to)
+                    ->Arg(16)->Arg(256)->Arg(4096);
+            } else {
+                benchmark::RegisterBenchmark(name.c_str(), BM_ConvertScalar, from, to);
+            }
+        }
+    }
+    return true;
+}();
+
+} // namespace
+
+static void BM_GetValueType(benchmark::State& state) {
+    std::vector<Value> values;
+    for (ValueType type : ALL_TYPES) {
+        values.push_back(make_value(type, 4));
+    }
+    for (auto _ : state) {
+        for (const auto& v : values) {
+            benchmark::DoNotOptimize(get_value_type(v));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(values.size()));
+}
+BENCHMARK(BM_GetValueType);
+
+static void BM_ConvertValueTypeSameType(benchmark::State& state) {
+    const Value value = make_value(ValueType::FLOAT_ARRAY, static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(convert_value_type(value, ValueType::FLOAT_ARRAY));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ConvertValueTypeSameType)->Arg(16)->Arg(4096);
+
+// Args: nesting depth, fields per level
+static void BM_ValuesEqualNestedStruct(benchmark::State& state) {
+    const int depth = static_cast<int>(state.range(0));
+    const int width = static_cast<int>(state.range(1));
+    const Value a{make_nested(depth, width)};
+    const Value b{make_nested(depth, width)};
+    PerfScope perf;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(values_equal(a, b));
+    }
+    state.SetItemsProcessed(state.iterations() * depth * width);
+    perf.report(state);
+}
+BENCHMARK(BM_ValuesEqualNestedStruct)->Args({1, 4})->Args({4, 8})->Args({8, 32});
+
+static void BM_ValuesEqualStructArray(benchmark::State& state) {
+    std::vector<std::shared_ptr<StructValue>> a, b;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        a.push_back(make_nested(2, 4));
+        b.push_back(make_nested(2, 4));
+    }
+    const Value va{std::move(a)};
+    const Value vb{std::move(b)};
+    PerfScope perf;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(values_equal(va, vb));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    perf.report(state);
+}
+BENCHMARK(BM_ValuesEqualStructArray)->Arg(16)->Arg(256);
+
+static void BM_ValueChangedScalar(benchmark::State& state) {
+    std::vector<Value> values;
+    for (int i = 0; i < 1024; ++i) {
+        values.emplace_back(static_cast<float>(i % 10) * 0.5f);
+    }
+    for (auto _ : state) {
+        size_t changed = 0;
+        for (size_t i = 1; i < values.size(); ++i) {
+            changed += value_changed_beyond_threshold(values[i - 1], values[i], 1.0);
+        }
+        benchmark::DoNotOptimize(changed);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(values.size() - 1));
+}
+BENCHMARK(BM_ValueChangedScalar);
+
+static void BM_ValueChangedString(benchmark::State& state) {
+    const Value a{std::string(static_cast<size_t>(state.range(0)), 'x')};
+    const Value b{std::string(static_cast<size_t>(state.range(0)), 'x')};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(value_changed_beyond_threshold(a, b, 0.0));
+    }
+}
+BENCHMARK(BM_ValueChangedString)->Arg(8)->Arg(256);
+
+static void BM_ValueChangedArray(benchmark::State& state) {
+    const Value a = make_value(ValueType::FLOAT_ARRAY, static_cast<size_t>(state.range(0)));
+    const Value b = make_value(ValueType::FLOAT_ARRAY, static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(value_changed_beyond_threshold(a, b, 0.5));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ValueChangedArray)->Arg(16)->Arg(256)->Arg(4096);
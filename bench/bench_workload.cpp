@@ -0,0 +1,101 @@
+/**
+ * @file bench_workload.cpp
+ * @brief Benchmarks for the synthetic workload generator
+ *
+ * Generator throughput for a catalog of scalar signals and for a mixed
+ * catalog with arrays and structs, plus a mixed workload fed through the
+ * k-way merge as a pipeline-sized example.
+ */
+
+#include "bench_alloc.hpp"
+#include <vss/types/workload.hpp>
+#include <vss/types/merge.hpp>
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace vss::types;
+using vss::types::test::AllocationScope;
+
+namespace {
+
+// `signals` sensors cycling through the scalar types; with `mixed`, every
+// fourth signal is an array and every sixteenth a struct
+void make_catalog(int64_t signals, bool mixed, SignalCatalog& catalog, StructRegistry& registry) {
+    StructDefinition position("Position");
+    position.add_field(FieldDefinition("Latitude", ValueType::DOUBLE))
+            .add_field(FieldDefinition("Longitude", ValueType::DOUBLE))
+            .add_field(FieldDefinition("Heading", ValueType::UINT16));
+    registry.register_struct(position);
+
+    const ValueType scalars[] = {ValueType::FLOAT, ValueType::BOOL, ValueType::INT32,
+                                 ValueType::UINT8, ValueType::DOUBLE, ValueType::STRING};
+    const ValueType arrays[] = {ValueType::FLOAT_ARRAY, ValueType::UINT16_ARRAY};
+    for (int64_t i = 0; i < signals; ++i) {
+        const std::string path = "Vehicle.Group" + std::to_string(i / 32) + ".Signal" + std::to_string(i);
+        if (mixed && i % 16 == 15) {
+            catalog.add_signal(path, NodeType::SENSOR, ValueType::STRUCT, "Position");
+        } else if (mixed && i % 4 == 3) {
+            catalog.add_signal(path, NodeType::SENSOR, arrays[(i / 4) % 2]);
+        } else {
+            auto id = catalog.add_signal(path, NodeType::SENSOR, scalars[i % 6]);
+            catalog.set_priority(*id, static_cast<PriorityClass>(i % 4));
+        }
+    }
+}
+
+} // namespace
+
+// Args: signals, mixed (0/1)
+static void BM_WorkloadGenerate(benchmark::State& state) {
+    SignalCatalog catalog;
+    StructRegistry registry;
+    make_catalog(state.range(0), state.range(1) != 0, catalog, registry);
+    WorkloadGenerator generator(catalog, registry);
+
+    std::vector<SignalUpdate> batch;
+    batch.reserve(4096);
+    AllocationScope allocations;
+    for (auto _ : state) {
+        batch.clear();
+        generator.pull(batch, 4096);
+        benchmark::DoNotOptimize(batch.data());
+    }
+    state.SetItemsProcessed(state.iterations() * 4096);
+    report_allocations(state, allocations, 4096);
+}
+BENCHMARK(BM_WorkloadGenerate)->Args({64, 0})->Args({4096, 0})->Args({64, 1})->Args({4096, 1});
+
+static void BM_WorkloadMerge(benchmark::State& state) {
+    const size_t sources = static_cast<size_t>(state.range(0));
+    std::vector<SignalCatalog> catalogs(sources);
+    StructRegistry registry;
+    for (auto& catalog : catalogs) {
+        make_catalog(256, true, catalog, registry);
+    }
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::vector<std::unique_ptr<WorkloadGenerator>> generators;
+        std::vector<UpdateSource*> pointers;
+        for (size_t s = 0; s < sources; ++s) {
+            WorkloadProfile profile;
+            profile.seed = s + 1;
+            profile.max_updates = 10000;
+            generators.push_back(std::make_unique<WorkloadGenerator>(catalogs[s], registry, profile));
+            pointers.push_back(generators.back().get());
+        }
+        state.ResumeTiming();
+
+        UpdateMerger merger(pointers);
+        SignalUpdate update;
+        size_t count = 0;
+        while (merger.next(update)) {
+            ++count;
+        }
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(sources * 10000));
+}
+BENCHMARK(BM_WorkloadMerge)->Arg(4)->Arg(16);
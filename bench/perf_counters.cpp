@@ -0,0 +1,199 @@
+/**
+ * @file perf_counters.cpp
+ * @brief perf_event_open backend for PerfCounters
+ */
+
+#include "perf_counters.hpp"
+#include <cerrno>
+#include <cstring>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <fstream>
+#endif
+
+namespace {
+
+constexpr size_t index(PerfEvent event) {
+    return static_cast<size_t>(event);
+}
+
+#if defined(__linux__)
+
+struct EventConfig {
+    uint32_t type;
+    uint64_t config;
+};
+
+EventConfig event_config(PerfEvent event) {
+    switch (event) {
+        case PerfEvent::CYCLES:
+            return {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES};
+        case PerfEvent::INSTRUCTIONS:
+            return {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS};
+        case PerfEvent::L1D_MISSES:
+            return {PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                                        (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)};
+        case PerfEvent::LLC_MISSES:
+            return {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES};
+        case PerfEvent::BRANCH_MISSES:
+            return {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES};
+    }
+    return {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES};
+}
+
+int open_event(PerfEvent event) {
+    const EventConfig config = event_config(event);
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = config.type;
+    attr.config = config.config;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    // This thread, any CPU, no group: events the PMU cannot schedule
+    // together are multiplexed and scaled in read()
+    return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+}
+
+std::string paranoid_level() {
+    std::ifstream in("/proc/sys/kernel/perf_event_paranoid");
+    std::string level;
+    in >> level;
+    return level;
+}
+
+#endif
+
+} // namespace
+
+const char* perf_event_name(PerfEvent event) {
+    switch (event) {
+        case PerfEvent::CYCLES: return "cycles";
+        case PerfEvent::INSTRUCTIONS: return "instructions";
+        case PerfEvent::L1D_MISSES: return "L1D-misses";
+        case PerfEvent::LLC_MISSES: return "LLC-misses";
+        case PerfEvent::BRANCH_MISSES: return "branch-misses";
+    }
+    return "unknown";
+}
+
+PerfCounters& PerfCounters::instance() {
+    static PerfCounters counters;
+    return counters;
+}
+
+bool PerfCounters::open() {
+    if (active_) {
+        return true;
+    }
+#if defined(__linux__)
+    std::string missing;
+    int first_errno = 0;
+    for (size_t i = 0; i < PERF_EVENT_COUNT; ++i) {
+        const auto event = static_cast<PerfEvent>(i);
+        fds_[i] = open_event(event);
+        if (fds_[i] < 0) {
+            if (first_errno == 0) {
+                first_errno = errno;
+            }
+            missing += missing.empty() ? "" : ", ";
+            missing += perf_event_name(event);
+            continue;
+        }
+        ioctl(fds_[i], PERF_EVENT_IOC_RESET, 0);
+        ioctl(fds_[i], PERF_EVENT_IOC_ENABLE, 0);
+        active_ = true;
+    }
+
+    if (!active_) {
+        error_ = std::string("perf_event_open failed: ") + std::strerror(first_errno);
+        if (first_errno == ENOENT || first_errno == EOPNOTSUPP) {
+            error_ += " (no hardware PMU exposed, e.g. in a VM or container)";
+        } else if (first_errno == EACCES || first_errno == EPERM) {
+            const std::string level = paranoid_level();
+            error_ += " (kernel.perf_event_paranoid = " + (level.empty() ? std::string("?") : level) + ")";
+        }
+    } else if (!missing.empty()) {
+        error_ = "not supported here: " + missing;
+    }
+    return active_;
+#else
+    error_ = "hardware counters need Linux perf_event";
+    return false;
+#endif
+}
+
+bool PerfCounters::available(PerfEvent event) const noexcept {
+    return fds_[index(event)] >= 0;
+}
+
+PerfCounters::Reading PerfCounters::read() const {
+    Reading reading;
+#if defined(__linux__)
+    for (size_t i = 0; i < PERF_EVENT_COUNT; ++i) {
+        if (fds_[i] < 0) {
+            continue;
+        }
+        uint64_t data[3];   // value, time enabled, time running
+        if (::read(fds_[i], data, sizeof(data)) != static_cast<ssize_t>(sizeof(data)) || data[2] == 0) {
+            continue;
+        }
+        reading.values[i] = data[2] == data[1]
+            ? data[0]
+            : static_cast<uint64_t>(static_cast<double>(data[0]) * static_cast<double>(data[1]) /
+                                    static_cast<double>(data[2]));
+        reading.valid[i] = true;
+    }
+#endif
+    return reading;
+}
+
+PerfCounters::~PerfCounters() {
+#if defined(__linux__)
+    for (int fd : fds_) {
+        if (fd >= 0) {
+            close(fd);
+        }
+    }
+#endif
+}
+
+PerfScope::PerfScope() {
+    if (PerfCounters::instance().active()) {
+        start_ = PerfCounters::instance().read();
+    }
+}
+
+void PerfScope::report(benchmark::State& state, int64_t items_per_iteration) const {
+    const PerfCounters& counters = PerfCounters::instance();
+    if (!counters.active()) {
+        return;
+    }
+    const PerfCounters::Reading end = counters.read();
+    const double items = static_cast<double>(state.iterations()) * static_cast<double>(items_per_iteration);
+    if (items <= 0) {
+        return;
+    }
+
+    double delta[PERF_EVENT_COUNT] = {};
+    bool valid[PERF_EVENT_COUNT] = {};
+    for (size_t i = 0; i < PERF_EVENT_COUNT; ++i) {
+        if (start_.valid[i] && end.valid[i] && end.values[i] >= start_.values[i]) {
+            delta[i] = static_cast<double>(end.values[i] - start_.values[i]);
+            valid[i] = true;
+            state.counters[perf_event_name(static_cast<PerfEvent>(i))] = delta[i] / items;
+        }
+    }
+
+    const size_t cycles = index(PerfEvent::CYCLES);
+    const size_t instructions = index(PerfEvent::INSTRUCTIONS);
+    if (valid[cycles] && valid[instructions] && delta[cycles] > 0) {
+        state.counters["IPC"] = delta[instructions] / delta[cycles];
+    }
+}
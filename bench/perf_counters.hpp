@@ -0,0 +1,121 @@
+/**
+ * @file perf_counters.hpp
+ * @brief Optional hardware performance counters for benchmarks (Linux perf_event)
+ *
+ * With `--hw_counters` on the command line, bench_main.cpp calls
+ * PerfCounters::open() and benchmarks that wrap their timed loop in a
+ * PerfScope report, per item:
+ *
+ *   cycles, instructions, IPC, L1D-misses, LLC-misses, branch-misses
+ *
+ * The counters follow the benchmark thread in user space only. Events
+ * the CPU or kernel does not provide are left out of the output; when
+ * none can be opened (non-Linux, containers without perf access,
+ * perf_event_paranoid too high) a note is printed and the benchmarks run
+ * as usual.
+ *
+ * @code
+ * PerfScope perf;
+ * for (auto _ : state) {
+ *     benchmark::DoNotOptimize(convert_value_type(value, to));
+ * }
+ * perf.report(state, state.range(0));
+ * @endcode
+ */
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * @brief Counted hardware events
+ */
+enum class PerfEvent {
+    CYCLES,
+    INSTRUCTIONS,
+    L1D_MISSES,
+    LLC_MISSES,
+    BRANCH_MISSES
+};
+
+constexpr size_t PERF_EVENT_COUNT = 5;
+
+/**
+ * @brief Counter name as shown in the benchmark output
+ */
+const char* perf_event_name(PerfEvent event);
+
+/**
+ * @brief Process-wide set of perf_event counters for the benchmark thread
+ */
+class PerfCounters {
+public:
+    /**
+     * @brief Raw counter readings, scaled for multiplexing
+     */
+    struct Reading {
+        std::array<uint64_t, PERF_EVENT_COUNT> values{};
+        std::array<bool, PERF_EVENT_COUNT> valid{};
+    };
+
+    static PerfCounters& instance();
+
+    /**
+     * @brief Open and start the counters on the calling thread
+     *
+     * @return false if no event could be opened; see error()
+     */
+    bool open();
+
+    /**
+     * @brief True when at least one event is counting
+     */
+    bool active() const noexcept { return active_; }
+
+    /**
+     * @brief Whether a specific event is counting
+     */
+    bool available(PerfEvent event) const noexcept;
+
+    /**
+     * @brief Why open() failed, or which events are missing
+     */
+    const std::string& error() const noexcept { return error_; }
+
+    Reading read() const;
+
+    ~PerfCounters();
+
+private:
+    PerfCounters() = default;
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    std::array<int, PERF_EVENT_COUNT> fds_{-1, -1, -1, -1, -1};
+    bool active_ = false;
+    std::string error_;
+};
+
+/**
+ * @brief Counts hardware events from construction until report()
+ *
+ * Does nothing when the counters are not active.
+ */
+class PerfScope {
+public:
+    PerfScope();
+
+    /**
+     * @brief Add the event counts per item to the benchmark's counters
+     *
+     * @param items_per_iteration Items processed per benchmark iteration
+     */
+    void report(benchmark::State& state, int64_t items_per_iteration = 1) const;
+
+private:
+    PerfCounters::Reading start_;
+};
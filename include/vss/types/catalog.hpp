@@ -0,0 +1,383 @@
+/**
+ * @file catalog.hpp
+ * @brief VSS signal path catalog
+ *
+ * Interns VSS paths (e.g. "Vehicle.Cabin.Door.Row1.Left.IsOpen") into dense
+ * numeric SignalIds and keeps the branch/leaf hierarchy of the VSS tree.
+ * Consumers can then key their signal state by SignalId (a plain vector index)
+ * instead of by path string.
+ */
+
+#pragma once
+
+#include "value.hpp"
+#include "constraints.hpp"
+#include "enum.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace vss::types {
+
+/**
+ * @brief Dense numeric identifier of a node in a SignalCatalog
+ *
+ * Ids are assigned in insertion order starting at 0, so they can be used
+ * directly as indices into per-signal arrays.
+ */
+using SignalId = std::uint32_t;
+
+/**
+ * @brief Sentinel for "no signal" (e.g. the parent of a root node)
+ */
+inline constexpr SignalId INVALID_SIGNAL_ID = static_cast<SignalId>(-1);
+
+/**
+ * @brief Set of SignalIds stored as a dense bitset
+ *
+ * Grows on insert; membership tests are a single word lookup.
+ */
+class SignalSet {
+public:
+    SignalSet() = default;
+
+    /**
+     * @brief Create an empty set with room for ids [0, capacity)
+     */
+    explicit SignalSet(size_t capacity)
+        : words_((capacity + 63) / 64, 0) {}
+
+    /**
+     * @brief Add an id to the set
+     */
+    void insert(SignalId id) {
+        size_t word = id / 64;
+        if (word >= words_.size()) {
+            words_.resize(word + 1, 0);
+        }
+        words_[word] |= std::uint64_t{1} << (id % 64);
+    }
+
+    /**
+     * @brief Remove an id from the set
+     */
+    void erase(SignalId id) noexcept {
+        size_t word = id / 64;
+        if (word < words_.size()) {
+            words_[word] &= ~(std::uint64_t{1} << (id % 64));
+        }
+    }
+
+    /**
+     * @brief Check if an id is in the set
+     */
+    bool contains(SignalId id) const noexcept {
+        size_t word = id / 64;
+        return word < words_.size() && ((words_[word] >> (id % 64)) & 1u);
+    }
+
+    /**
+     * @brief Number of ids in the set
+     */
+    size_t count() const noexcept;
+
+    /**
+     * @brief Check if the set has no ids
+     */
+    bool empty() const noexcept;
+
+    /**
+     * @brief Remove all ids (keeps capacity)
+     */
+    void clear() noexcept {
+        std::fill(words_.begin(), words_.end(), 0);
+    }
+
+    /**
+     * @brief Call f(SignalId) for every id in ascending order
+     */
+    template<typename F>
+    void for_each(F&& f) const {
+        for (size_t w = 0; w < words_.size(); ++w) {
+            std::uint64_t bits = words_[w];
+            while (bits != 0) {
+#if defined(__GNUC__) || defined(__clang__)
+                unsigned bit = static_cast<unsigned>(__builtin_ctzll(bits));
+#else
+                unsigned bit = 0;
+                while (((bits >> bit) & 1u) == 0) ++bit;
+#endif
+                f(static_cast<SignalId>(w * 64 + bit));
+                bits &= bits - 1;
+            }
+        }
+    }
+
+    /**
+     * @brief Ids in ascending order
+     */
+    std::vector<SignalId> to_vector() const;
+
+    /**
+     * @brief Set union
+     */
+    SignalSet& operator|=(const SignalSet& other);
+
+    /**
+     * @brief Set intersection
+     */
+    SignalSet& operator&=(const SignalSet& other);
+
+    /**
+     * @brief Equality comparison (same ids, capacity ignored)
+     */
+    bool operator==(const SignalSet& other) const noexcept;
+
+    bool operator!=(const SignalSet& other) const noexcept {
+        return !(*this == other);
+    }
+
+    /**
+     * @brief Underlying bitset words (bit i of word w is id w*64+i)
+     */
+    const std::vector<std::uint64_t>& words() const noexcept { return words_; }
+
+private:
+    std::vector<std::uint64_t> words_;
+};
+
+/**
+ * @brief VSS node type
+ *
+ * Matches the "type" attribute of nodes in the VSS tree.
+ */
+enum class NodeType {
+    BRANCH = 0,     ///< Interior node grouping other nodes
+    SENSOR = 1,     ///< Signal read from the vehicle
+    ACTUATOR = 2,   ///< Signal that can be set
+    ATTRIBUTE = 3   ///< Static (rarely changing) property
+};
+
+/**
+ * @brief Convert NodeType to string
+ *
+ * @param type The node type
+ * @return String representation (e.g., "BRANCH", "SENSOR")
+ */
+const char* node_type_to_string(NodeType type);
+
+/**
+ * @brief Parse NodeType from string
+ *
+ * @param str String representation (case-insensitive, e.g. "sensor")
+ * @return NodeType if recognized, std::nullopt otherwise
+ */
+std::optional<NodeType> node_type_from_string(const std::string& str);
+
+/**
+ * @brief Scheduling class of a signal (see UpdateScheduler)
+ */
+enum class PriorityClass {
+    CRITICAL = 0,   ///< Safety-relevant (brakes, airbags)
+    HIGH = 1,       ///< Driving-relevant (speed, gear)
+    NORMAL = 2,     ///< Default
+    LOW = 3         ///< Bulk and comfort data (infotainment)
+};
+
+/**
+ * @brief Number of PriorityClass values
+ */
+inline constexpr size_t PRIORITY_CLASS_COUNT = 4;
+
+/**
+ * @brief Convert PriorityClass to string
+ */
+const char* priority_class_to_string(PriorityClass priority);
+
+/**
+ * @brief Parse PriorityClass from string
+ *
+ * @param str String representation (case-insensitive, e.g. "critical")
+ * @return PriorityClass if recognized, std::nullopt otherwise
+ */
+std::optional<PriorityClass> priority_class_from_string(const std::string& str);
+
+/**
+ * @brief A single node (branch or signal) in the catalog
+ */
+struct SignalNode {
+    SignalId id = INVALID_SIGNAL_ID;         ///< Dense id of this node
+    SignalId parent = INVALID_SIGNAL_ID;     ///< Parent node, INVALID_SIGNAL_ID for roots
+    std::string path;                        ///< Full dotted path
+    NodeType node_type = NodeType::BRANCH;   ///< Branch, sensor, actuator or attribute
+    ValueType type = ValueType::UNSPECIFIED; ///< Expected value type (UNSPECIFIED for branches)
+    std::string struct_type_name;            ///< If type is STRUCT/STRUCT_ARRAY, the struct type name
+    std::string description;                 ///< Human-readable description
+    std::vector<SignalId> children;          ///< Child nodes in insertion order
+    ValueConstraints constraints;            ///< VSS min/max/allowed (signals only)
+    std::shared_ptr<const EnumDictionary> enum_dictionary;  ///< STRING signals with allowed values
+    PriorityClass priority = PriorityClass::NORMAL;          ///< Scheduling class (signals only)
+    std::chrono::nanoseconds latency_budget{0};              ///< Max age at dispatch, 0 = none
+
+    /**
+     * @brief Last path segment (e.g. "IsOpen")
+     */
+    std::string_view name() const noexcept {
+        auto pos = path.rfind('.');
+        return pos == std::string::npos ? std::string_view(path)
+                                        : std::string_view(path).substr(pos + 1);
+    }
+
+    /**
+     * @brief Check if node is a branch (has no value)
+     */
+    bool is_branch() const noexcept { return node_type == NodeType::BRANCH; }
+};
+
+/**
+ * @brief Catalog of VSS nodes with interned paths
+ *
+ * Nodes are added by full path; missing intermediate branches are created
+ * automatically. Every node (branches included) gets a dense SignalId.
+ *
+ * Lookups by path take a std::string_view and do not allocate. Ids and node
+ * references stay stable while nodes are added.
+ *
+ * Thread-safe for read operations after initialization.
+ *
+ * Example:
+ * @code
+ * SignalCatalog catalog;
+ * auto speed = catalog.add_signal("Vehicle.Speed", NodeType::SENSOR, ValueType::FLOAT);
+ *
+ * auto id = catalog.find("Vehicle.Speed");      // == speed
+ * auto path = catalog.path(*id);                // "Vehicle.Speed"
+ * auto parent = catalog.find("Vehicle");        // auto-created branch
+ * @endcode
+ */
+class SignalCatalog {
+public:
+    SignalCatalog() = default;
+    SignalCatalog(const SignalCatalog& other);
+    SignalCatalog& operator=(const SignalCatalog& other);
+    SignalCatalog(SignalCatalog&&) = default;
+    SignalCatalog& operator=(SignalCatalog&&) = default;
+
+    /**
+     * @brief Add a branch node
+     *
+     * Returns the existing id if the branch is already present.
+     *
+     * @param path Full dotted path
+     * @param description Human-readable description
+     * @return Branch id, or nullopt if the path (or a prefix of it) is a signal
+     *         or the path is malformed
+     */
+    std::optional<SignalId> add_branch(std::string_view path, std::string description = "");
+
+    /**
+     * @brief Add a signal (leaf) node
+     *
+     * @param path Full dotted path
+     * @param node_type SENSOR, ACTUATOR or ATTRIBUTE
+     * @param type Expected value type
+     * @param struct_type_name Struct type name if type is STRUCT/STRUCT_ARRAY
+     * @param description Human-readable description
+     * @return Signal id, or nullopt if the path already exists, a prefix of it
+     *         is a signal, node_type is BRANCH or the path is malformed
+     */
+    std::optional<SignalId> add_signal(
+        std::string_view path,
+        NodeType node_type,
+        ValueType type,
+        std::string struct_type_name = "",
+        std::string description = "");
+
+    /**
+     * @brief Set the min/max/allowed constraints of a signal
+     *
+     * For STRING signals with allowed values this also builds the node's
+     * enum_dictionary, used to store values as EnumValue.
+     *
+     * @param id Signal id
+     * @param constraints Constraints to store in the node
+     * @return false if id is out of range or refers to a branch
+     */
+    bool set_constraints(SignalId id, ValueConstraints constraints);
+
+    /**
+     * @brief Set the scheduling class and latency budget of a signal
+     *
+     * @param id Signal id
+     * @param priority Scheduling class
+     * @param latency_budget Maximum time from the sample's timestamp to its
+     *                       dispatch (0 = no deadline)
+     * @return false if id is out of range or refers to a branch
+     */
+    bool set_priority(SignalId id, PriorityClass priority,
+                      std::chrono::nanoseconds latency_budget = std::chrono::nanoseconds(0));
+
+    /**
+     * @brief Look up a node by path (allocation-free)
+     *
+     * @param path Full dotted path
+     * @return Node id, or nullopt if not found
+     */
+    std::optional<SignalId> find(std::string_view path) const;
+
+    /**
+     * @brief Get a node by id
+     *
+     * @param id Node id
+     * @return Pointer to node, or nullptr if id is out of range
+     */
+    const SignalNode* get(SignalId id) const noexcept {
+        return id < nodes_.size() ? &nodes_[id] : nullptr;
+    }
+
+    /**
+     * @brief Reverse lookup: id to full path
+     *
+     * @param id Node id
+     * @return Full path, or empty view if id is out of range
+     */
+    std::string_view path(SignalId id) const noexcept {
+        return id < nodes_.size() ? std::string_view(nodes_[id].path) : std::string_view();
+    }
+
+    /**
+     * @brief Check if a path is present
+     */
+    bool contains(std::string_view path) const { return find(path).has_value(); }
+
+    /**
+     * @brief Root nodes (nodes without a parent), e.g. "Vehicle"
+     */
+    const std::vector<SignalId>& roots() const noexcept { return roots_; }
+
+    /**
+     * @brief Number of nodes (branches and signals); valid ids are [0, size())
+     */
+    size_t size() const noexcept { return nodes_.size(); }
+
+    /**
+     * @brief Remove all nodes
+     */
+    void clear();
+
+private:
+    std::optional<SignalId> intern(std::string_view path, const SignalNode& node);
+    void rebuild_index();
+
+    std::deque<SignalNode> nodes_;   ///< Indexed by SignalId; deque keeps paths at stable addresses
+    std::vector<SignalId> roots_;    ///< Nodes without parent
+    std::unordered_map<std::string_view, SignalId> index_;  ///< Path (view into nodes_) → id
+};
+
+} // namespace vss::types
@@ -0,0 +1,119 @@
+/**
+ * @file clock.hpp
+ * @brief Pluggable time source for timestamps
+ *
+ * Everything in the library that stamps "the current time" (the
+ * QualifiedValue and DynamicQualifiedValue constructors, age()) reads it
+ * from vss::types::now(). By default that is std::chrono::system_clock;
+ * installing a ClockSource makes it deterministic, e.g. during replay or
+ * in tests.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace vss::types {
+
+/**
+ * @brief Source of the current time
+ */
+class ClockSource {
+public:
+    virtual ~ClockSource() = default;
+
+    virtual std::chrono::system_clock::time_point now() const noexcept = 0;
+};
+
+namespace detail {
+extern std::atomic<const ClockSource*> active_clock_source;
+
+// Nanoseconds since the epoch, the integer time key of the stream,
+// storage and replay code
+inline int64_t to_ns(std::chrono::system_clock::time_point tp) noexcept {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(tp.time_since_epoch()).count();
+}
+
+inline std::chrono::system_clock::time_point from_ns(int64_t ns) noexcept {
+    return std::chrono::system_clock::time_point{
+        std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::nanoseconds(ns))};
+}
+} // namespace detail
+
+/**
+ * @brief Current time from the installed clock source (system_clock if none)
+ */
+inline std::chrono::system_clock::time_point now() noexcept {
+    const ClockSource* source = detail::active_clock_source.load(std::memory_order_acquire);
+    return source ? source->now() : std::chrono::system_clock::now();
+}
+
+/**
+ * @brief Install a clock source for the whole process
+ *
+ * The source must stay alive while installed.
+ *
+ * @param source New source, or nullptr for system_clock
+ * @return Previously installed source (nullptr for system_clock)
+ */
+const ClockSource* set_clock_source(const ClockSource* source) noexcept;
+
+/**
+ * @brief Currently installed clock source (nullptr for system_clock)
+ */
+const ClockSource* clock_source() noexcept;
+
+/**
+ * @brief Clock that only moves when told to
+ *
+ * Thread-safe: set() and advance() may be called while other threads
+ * read the time.
+ */
+class ManualClock : public ClockSource {
+public:
+    explicit ManualClock(std::chrono::system_clock::time_point start = {}) noexcept
+        : ns_(detail::to_ns(start)) {}
+
+    std::chrono::system_clock::time_point now() const noexcept override {
+        return detail::from_ns(ns_.load(std::memory_order_relaxed));
+    }
+
+    void set(std::chrono::system_clock::time_point t) noexcept {
+        ns_.store(detail::to_ns(t), std::memory_order_relaxed);
+    }
+
+    void advance(std::chrono::nanoseconds d) noexcept {
+        ns_.fetch_add(d.count(), std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<int64_t> ns_;
+};
+
+/**
+ * @brief Installs a clock source for the lifetime of the object
+ *
+ * Example:
+ * @code
+ * ManualClock clock{recording_start};
+ * ScopedClockSource scope{clock};
+ * DynamicQualifiedValue v{Value{1.0f}};   // stamped with recording_start
+ * @endcode
+ */
+class ScopedClockSource {
+public:
+    explicit ScopedClockSource(const ClockSource& source) noexcept
+        : previous_(set_clock_source(&source)) {}
+
+    ~ScopedClockSource() { set_clock_source(previous_); }
+
+    ScopedClockSource(const ScopedClockSource&) = delete;
+    ScopedClockSource& operator=(const ScopedClockSource&) = delete;
+
+private:
+    const ClockSource* previous_;
+};
+
+} // namespace vss::types
@@ -0,0 +1,177 @@
+/**
+ * @file constraints.hpp
+ * @brief VSS min/max/allowed constraints and batch checking
+ *
+ * VSS signals and struct properties may restrict their values with `min`,
+ * `max` and `allowed`. ValueConstraints carries that metadata; it is
+ * attached to FieldDefinition (struct properties) and SignalNode (leaf
+ * signals). Arrays satisfy a constraint if every element does.
+ */
+
+#pragma once
+
+#include "quality.hpp"
+#include "value.hpp"
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace vss::types {
+
+/**
+ * @brief Value restrictions of a signal or struct field
+ *
+ * Example VSS:
+ * @code{.yaml}
+ * Vehicle.Cabin.Seat.Row1.DriverSide.Position:
+ *   datatype: uint16
+ *   min: 0
+ *   max: 1000
+ *
+ * Vehicle.Powertrain.Transmission.PerformanceMode:
+ *   datatype: string
+ *   allowed: ['NORMAL', 'SPORT', 'ECONOMY', 'SNOW', 'RAIN']
+ * @endcode
+ */
+struct ValueConstraints {
+    std::optional<double> min;      ///< Lowest valid value (inclusive), numeric types only
+    std::optional<double> max;      ///< Highest valid value (inclusive), numeric types only
+    std::vector<Value> allowed;     ///< Allowed scalar values; empty means any value
+
+    /**
+     * @brief Check if no constraint is set
+     */
+    bool empty() const noexcept {
+        return !min.has_value() && !max.has_value() && allowed.empty();
+    }
+};
+
+/**
+ * @brief Check a value against constraints
+ *
+ * - min/max apply to numeric values and numeric array elements (NaN fails
+ *   a range check)
+ * - allowed applies to numeric, bool and string (including EnumValue) values
+ *   and array elements; numeric values match allowed entries by value
+ *   (uint8 5 matches int32 5)
+ * - Empty values and structs always pass
+ *
+ * For repeated checks against the same constraints use ConstraintChecker.
+ *
+ * @param value The value to check
+ * @param constraints Constraints to apply
+ * @return nullopt if valid, error message otherwise
+ */
+std::optional<std::string> check_constraints(
+    const Value& value,
+    const ValueConstraints& constraints);
+
+/**
+ * @brief Precompiled constraints for batch checking
+ *
+ * Numeric range tests run as branch-free loops over the native element
+ * type (bounds are converted into that type once), which the compiler
+ * vectorizes. Allowed strings are looked up in a hash set, allowed
+ * numbers with a binary search.
+ *
+ * The batch functions write one flag per element into `valid`
+ * (1 = satisfies the constraints, 0 = violates them). `valid` may be
+ * nullptr if only the number of violations is needed.
+ *
+ * Example:
+ * @code
+ * ConstraintChecker checker{signal_node->constraints};
+ *
+ * std::vector<uint8_t> valid;
+ * size_t violations = checker.check(samples, valid);
+ *
+ * checker.apply(slots.data(), slots.size());  // VALID → INVALID on violation
+ * @endcode
+ */
+class ConstraintChecker {
+public:
+    ConstraintChecker() = default;
+    explicit ConstraintChecker(const ValueConstraints& constraints);
+
+    /**
+     * @brief Check if the checker accepts every value
+     */
+    bool empty() const noexcept { return !has_range_ && !restricted_; }
+
+    /**
+     * @brief Check numeric elements
+     *
+     * Supported types: int8..int64, uint8..uint64, float, double.
+     *
+     * @param values Elements to check
+     * @param count Number of elements
+     * @param valid Output flags (count elements), or nullptr
+     * @return Number of violating elements
+     */
+    template<typename T>
+    size_t check_range(const T* values, size_t count, uint8_t* valid) const;
+
+    /**
+     * @brief Check string elements against the allowed set
+     *
+     * @param values Elements to check
+     * @param count Number of elements
+     * @param valid Output flags (count elements), or nullptr
+     * @return Number of violating elements
+     */
+    size_t check_strings(const std::string* values, size_t count, uint8_t* valid) const;
+
+    /**
+     * @brief Check a scalar or array value element by element
+     *
+     * @param value Value to check
+     * @param valid Resized to the number of elements (1 for scalars, 0 for
+     *              empty values and structs) and filled with per-element flags
+     * @return Number of violating elements
+     */
+    size_t check(const Value& value, std::vector<uint8_t>& valid) const;
+
+    /**
+     * @brief Count violating elements of a value without allocating
+     *
+     * @param value Value to check
+     * @return Number of violating elements (0 for empty values and structs)
+     */
+    size_t count_violations(const Value& value) const;
+
+    /**
+     * @brief Check if a value (all of its elements) satisfies the constraints
+     */
+    bool satisfied(const Value& value) const { return count_violations(value) == 0; }
+
+    /**
+     * @brief Downgrade slots that violate the constraints
+     *
+     * Every VALID slot whose value violates the constraints gets INVALID
+     * quality; the value itself is kept. Other slots are left untouched.
+     *
+     * @param slots Slots to check
+     * @param count Number of slots
+     * @return Number of slots downgraded to INVALID
+     */
+    size_t apply(DynamicQualifiedValue* slots, size_t count) const;
+
+private:
+    bool allows(bool value) const noexcept {
+        return !restricted_ || (value ? allow_true_ : allow_false_);
+    }
+
+    bool has_range_ = false;
+    double min_ = 0.0;
+    double max_ = 0.0;
+
+    bool restricted_ = false;                       ///< allowed list is non-empty
+    std::vector<double> allowed_numbers_;           ///< Sorted numeric allowed values
+    std::unordered_set<std::string> allowed_strings_;
+    bool allow_true_ = false;
+    bool allow_false_ = false;
+};
+
+} // namespace vss::types
@@ -0,0 +1,213 @@
+/**
+ * @file decoder.hpp
+ * @brief Table-driven decoding of raw frame bytes into values
+ *
+ * Extracts bit-field signals (CAN / CAN FD style) from a frame buffer and
+ * writes the scaled physical values straight into DynamicQualifiedValue
+ * slots. Signal layout follows DBC conventions:
+ * - INTEL (little-endian): start_bit is the least significant bit
+ * - MOTOROLA (big-endian): start_bit is the most significant bit, using
+ *   DBC "sawtooth" bit numbering (bit 7 of byte 0 is bit 7, bit 0 of
+ *   byte 1 is bit 8, ...)
+ */
+
+#pragma once
+
+#include "enum.hpp"
+#include "quality.hpp"
+#include "value.hpp"
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace vss::types {
+
+/**
+ * @brief Byte order of a bit-field signal
+ */
+enum class ByteOrder {
+    INTEL = 0,      ///< Little-endian
+    MOTOROLA = 1    ///< Big-endian
+};
+
+/**
+ * @brief Layout and scaling of one signal within a frame
+ *
+ * physical = raw * scale + offset, then converted to target_type.
+ */
+struct SignalDescriptor {
+    uint16_t start_bit = 0;                 ///< See ByteOrder for numbering
+    uint8_t length = 0;                     ///< Bit length, 1..64
+    ByteOrder byte_order = ByteOrder::INTEL;
+    bool is_signed = false;                 ///< Raw value is two's complement
+    double scale = 1.0;                     ///< Factor applied to the raw value
+    double offset = 0.0;                    ///< Offset added after scaling
+    ValueType target_type = ValueType::DOUBLE;  ///< BOOL, integer, FLOAT, DOUBLE or STRING
+    size_t slot = 0;                        ///< Index of the output slot
+
+    /**
+     * @brief Value table of an enum signal (required for STRING targets)
+     *
+     * The unsigned raw value is used as the code into the dictionary
+     * (scale and offset are ignored); slots receive an EnumValue.
+     */
+    std::shared_ptr<const EnumDictionary> value_table;
+
+    /**
+     * @brief Multiplexor value selecting this signal
+     *
+     * If set, the signal is only decoded when the frame's multiplexor
+     * (see FrameDecoder::set_multiplexor) has this raw value.
+     */
+    std::optional<uint64_t> multiplex_value;
+};
+
+/**
+ * @brief Maximum supported frame payload (CAN FD)
+ */
+inline constexpr size_t MAX_FRAME_SIZE = 64;
+
+/**
+ * @brief Extract a raw bit field from a frame
+ *
+ * @param data Frame payload
+ * @param size Payload size in bytes (at most MAX_FRAME_SIZE)
+ * @param start_bit Start bit (see ByteOrder for numbering)
+ * @param length Bit length, 1..64
+ * @param byte_order Byte order of the field
+ * @return Raw unsigned bits, or nullopt if the field is not inside the payload
+ */
+std::optional<uint64_t> extract_bits(
+    const uint8_t* data,
+    size_t size,
+    uint16_t start_bit,
+    uint8_t length,
+    ByteOrder byte_order);
+
+/**
+ * @brief Decodes many signals from a frame in one pass
+ *
+ * Descriptors are compiled into structure-of-arrays tables, one per
+ * multiplexor value, so decoding runs as a few tight loops over all signals
+ * (extract, sign-extend, scale) before the results are stored into slots.
+ * Decoding does not allocate once the slot vector has its final size.
+ *
+ * Per signal, the slot receives:
+ * - VALID quality and the converted value on success
+ * - INVALID quality and an empty value if the physical value does not fit
+ *   target_type (e.g. 300 into UINT8, negative into unsigned) or the raw
+ *   value has no entry in the value table
+ * - NOT_AVAILABLE quality and an empty value if the frame is too short
+ *
+ * Example:
+ * @code
+ * FrameDecoder decoder;
+ * SignalDescriptor speed;
+ * speed.start_bit = 0;
+ * speed.length = 16;
+ * speed.scale = 0.01;
+ * speed.target_type = ValueType::FLOAT;
+ * speed.slot = 0;
+ * decoder.add_signal(speed);
+ *
+ * std::vector<DynamicQualifiedValue> slots;
+ * decoder.decode(frame, 8, slots, timestamp);
+ * @endcode
+ */
+class FrameDecoder {
+public:
+    /**
+     * @brief Add a signal to the decoding table
+     *
+     * @param descriptor Signal layout, scaling and output slot
+     * @return false if the layout does not fit MAX_FRAME_SIZE, the length is
+     *         not 1..64, target_type is not BOOL, integer, FLOAT or DOUBLE, or
+     *         target_type is STRING without a value_table
+     */
+    bool add_signal(const SignalDescriptor& descriptor);
+
+    /**
+     * @brief Define the multiplexor field of the frame
+     *
+     * Only the layout (start_bit, length, byte_order) is used.
+     *
+     * @param descriptor Multiplexor layout
+     * @return false if the layout is invalid
+     */
+    bool set_multiplexor(const SignalDescriptor& descriptor);
+
+    /**
+     * @brief Decode a frame into slots
+     *
+     * Slots is grown to slot_count() if needed. Slots of signals belonging
+     * to other multiplexor values are left untouched.
+     *
+     * @param data Frame payload
+     * @param size Payload size in bytes (bytes beyond MAX_FRAME_SIZE are ignored)
+     * @param slots Output slots, indexed by SignalDescriptor::slot
+     * @param timestamp Timestamp written into every decoded slot
+     * @return Number of slots written
+     */
+    size_t decode(
+        const uint8_t* data,
+        size_t size,
+        std::vector<DynamicQualifiedValue>& slots,
+        std::chrono::system_clock::time_point timestamp) const;
+
+    /**
+     * @brief Minimum slot vector size (highest slot index + 1)
+     */
+    size_t slot_count() const noexcept { return slot_count_; }
+
+    /**
+     * @brief Number of signals in the table (excluding the multiplexor)
+     */
+    size_t signal_count() const noexcept;
+
+    /**
+     * @brief Remove all signals and the multiplexor
+     */
+    void clear();
+
+private:
+    /**
+     * @brief Compiled field layout, shared by signals and the multiplexor
+     */
+    struct Field {
+        uint16_t byte_index;    ///< First byte of the 9-byte read window
+        uint8_t bit_offset;     ///< INTEL: right shift; MOTOROLA: left shift
+        uint8_t length;
+        bool motorola;
+        uint16_t last_byte;     ///< Highest byte the field touches
+    };
+
+    /**
+     * @brief Structure-of-arrays table of signals sharing a multiplexor value
+     */
+    struct Table {
+        std::optional<uint64_t> multiplex_value;
+        std::vector<Field> fields;
+        std::vector<uint64_t> sign_bits;    ///< 1 << (length-1) if signed, else 0
+        std::vector<double> scales;
+        std::vector<double> offsets;
+        std::vector<ValueType> targets;
+        std::vector<size_t> slots;
+        std::vector<bool> identity;         ///< scale == 1 && offset == 0
+        std::vector<std::shared_ptr<const EnumDictionary>> value_tables;  ///< STRING targets only
+    };
+
+    static std::optional<Field> compile_field(const SignalDescriptor& descriptor);
+    size_t decode_table(
+        const Table& table,
+        const uint8_t* frame,
+        size_t size,
+        std::vector<DynamicQualifiedValue>& slots,
+        std::chrono::system_clock::time_point timestamp) const;
+
+    std::vector<Table> tables_;     ///< tables_[0] holds non-multiplexed signals
+    std::optional<Field> multiplexor_;
+    size_t slot_count_ = 0;
+};
+
+} // namespace vss::types
@@ -0,0 +1,205 @@
+/**
+ * @file derived.hpp
+ * @brief Incremental computation of derived signals
+ */
+
+#pragma once
+
+#include "catalog.hpp"
+#include "pool.hpp"
+#include "quality.hpp"
+#include "update.hpp"
+#include "value.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace vss::types {
+
+/**
+ * @brief Current input values of a derived node, in declaration order
+ */
+class DerivedInputs {
+public:
+    size_t size() const noexcept { return size_; }
+
+    const DynamicQualifiedValue& operator[](size_t i) const noexcept { return table_[ids_[i]]; }
+
+    const Value& value(size_t i) const noexcept { return table_[ids_[i]].value; }
+
+    /**
+     * @brief Input i as double (see to_double())
+     */
+    double number(size_t i) const { return to_double(table_[ids_[i]].value); }
+
+private:
+    friend class DerivedGraph;
+
+    DerivedInputs(const DynamicQualifiedValue* table, const SignalId* ids, size_t size) noexcept
+        : table_(table), ids_(ids), size_(size) {}
+
+    const DynamicQualifiedValue* table_;
+    const SignalId* ids_;
+    size_t size_;
+};
+
+/**
+ * @brief Node of a DerivedGraph: one output signal computed from inputs
+ *
+ * Inputs may be plain signals fed through DerivedGraph::update() or the
+ * outputs of other nodes. The output is stamped with the newest input
+ * timestamp. Its quality is VALID if all inputs are VALID, otherwise the
+ * worst input quality (INVALID before NOT_AVAILABLE before UNKNOWN); an
+ * empty result is NOT_AVAILABLE.
+ */
+struct DerivedNode {
+    SignalId output = INVALID_SIGNAL_ID;
+    std::vector<SignalId> inputs;
+    std::function<Value(const DerivedInputs&)> compute;
+    bool require_valid = true;      ///< Skip compute() and emit an empty value unless all inputs are VALID
+};
+
+/**
+ * @brief Dataflow graph of derived signals with dirty propagation
+ *
+ * Only nodes downstream of a changed input are re-evaluated, in
+ * topological order. A signal counts as changed when its quality changes
+ * or its value moves beyond the signal's threshold (see
+ * value_changed_beyond_threshold()); this applies to node outputs as
+ * well, so a node whose result did not change stops the propagation.
+ * Below the threshold only the timestamp is refreshed and the value
+ * keeps the last propagated one, so slow drift still triggers once it
+ * adds up.
+ *
+ * With worker threads, the affected part of the graph is evaluated on a
+ * WorkStealingPool: a node is scheduled as soon as all its affected
+ * predecessors are done, so independent subgraphs run in parallel.
+ * compute() functions must then be safe to call concurrently for
+ * different nodes.
+ *
+ * The graph itself is not thread-safe; update() and evaluate() must not
+ * run concurrently.
+ *
+ * Example:
+ * @code
+ * DerivedGraph graph;
+ * graph.add_node({range_id, {fuel_id, consumption_id}, [](const DerivedInputs& in) {
+ *     return Value{in.number(0) / in.number(1) * 100.0};
+ * }});
+ * graph.set_threshold(fuel_id, 0.1);
+ * graph.build();
+ *
+ * graph.update(fuel_id, fuel_sample);
+ * std::vector<SignalUpdate> changed;
+ * graph.evaluate(&changed);   // publishes range_id if it changed
+ * @endcode
+ */
+class DerivedGraph {
+public:
+    /**
+     * @param threads Worker threads for evaluate() (0 = evaluate on the calling thread)
+     */
+    explicit DerivedGraph(size_t threads = 0);
+
+    /**
+     * @brief Add a node (invalidates a previous build())
+     *
+     * @return Node index, or nullopt if the output is invalid, already
+     *         produced by another node, listed as its own input, or
+     *         compute is empty
+     */
+    std::optional<size_t> add_node(DerivedNode node);
+
+    /**
+     * @brief Compute the evaluation order and mark every node dirty
+     *
+     * Called by evaluate() if needed.
+     *
+     * @return false if the nodes form a cycle
+     */
+    bool build();
+
+    /**
+     * @brief Minimum change of a signal that propagates (0 = any change)
+     */
+    void set_threshold(SignalId id, double threshold);
+
+    /**
+     * @brief Feed a new sample of a signal
+     *
+     * @return true if nodes depending on the signal were marked dirty
+     */
+    bool update(SignalId id, const DynamicQualifiedValue& sample);
+
+    bool update(const SignalUpdate& update) { return this->update(update.id, update.value); }
+
+    /**
+     * @brief Re-evaluate all dirty nodes and their changed descendants
+     *
+     * @param changed If not null, receives the outputs that changed (appended,
+     *                in topological order)
+     * @return Number of nodes evaluated (0 if build() fails)
+     */
+    size_t evaluate(std::vector<SignalUpdate>* changed = nullptr);
+
+    /**
+     * @brief Current value of a signal (input or output)
+     *
+     * @return Pointer to the sample, or nullptr if none was seen or computed yet
+     */
+    const DynamicQualifiedValue* value(SignalId id) const noexcept;
+
+    size_t node_count() const noexcept { return nodes_.size(); }
+
+    /**
+     * @brief Nodes waiting for evaluate()
+     */
+    size_t dirty_count() const noexcept;
+
+    /**
+     * @brief Worker threads (0 = evaluation on the calling thread)
+     */
+    size_t threads() const noexcept { return pool_ ? pool_->size() : 0; }
+
+private:
+    static constexpr size_t NO_NODE = static_cast<size_t>(-1);
+
+    void ensure_signal(SignalId id);
+    double threshold(SignalId id) const noexcept;
+    bool store(SignalId id, const DynamicQualifiedValue& sample);
+    bool evaluate_node(size_t node);
+    size_t evaluate_serial();
+    size_t evaluate_parallel();
+    void run_parallel(size_t node);
+
+    std::vector<DerivedNode> nodes_;
+    std::vector<size_t> producer_;          ///< Per signal: producing node or NO_NODE
+    std::vector<uint32_t> rank_;            ///< Per node: position in topological order
+    std::vector<size_t> successor_offsets_; ///< Per node: range into successors_
+    std::vector<size_t> successors_;        ///< Nodes reading a node's output
+    std::vector<size_t> consumer_offsets_;  ///< Per signal: range into consumers_
+    std::vector<size_t> consumers_;         ///< Nodes reading a signal
+    bool built_ = false;
+
+    std::vector<DynamicQualifiedValue> values_;  ///< Per signal
+    std::vector<uint8_t> known_;                 ///< Per signal: values_ holds a sample
+    std::vector<double> thresholds_;             ///< Per signal
+    std::vector<uint8_t> dirty_;                 ///< Per node
+    std::vector<size_t> dirty_nodes_;            ///< Nodes with dirty_ set
+
+    // Evaluation scratch, reused between calls
+    std::vector<size_t> queue_;
+    std::vector<uint8_t> queued_;
+    std::vector<size_t> affected_;
+    std::vector<uint8_t> changed_;
+    std::unique_ptr<std::atomic<uint32_t>[]> pending_;
+    std::atomic<size_t> evaluated_{0};
+
+    std::unique_ptr<WorkStealingPool> pool_;
+};
+
+} // namespace vss::types
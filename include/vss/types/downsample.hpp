@@ -0,0 +1,129 @@
+/**
+ * @file downsample.hpp
+ * @brief Downsampling of signal histories for display and storage
+ *
+ * Kernels take a columnar SeriesView and append the reduced series to a
+ * SignalSeries, in one pass over the input:
+ * - LTTB (Largest-Triangle-Three-Buckets): keeps the visual shape
+ * - MIN_MAX: keeps the extremes of every bucket, so peaks survive
+ * - AVERAGE: mean per fixed time bucket
+ *
+ * All kernels are quality-aware: only VALID, non-NaN samples are selected
+ * or averaged. A bucket without any such sample still yields one sample
+ * carrying the bucket's non-VALID quality, so gaps stay visible downstream.
+ */
+
+#pragma once
+
+#include "series.hpp"
+#include <chrono>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace vss::types {
+
+/**
+ * @brief Downsampling algorithm
+ */
+enum class DownsampleMethod {
+    LTTB = 0,       ///< Largest-Triangle-Three-Buckets, `points` output samples
+    MIN_MAX = 1,    ///< Min and max per bucket, at most `points` output samples
+    AVERAGE = 2     ///< Mean per `bucket_width` time bucket
+};
+
+/**
+ * @brief Convert DownsampleMethod to string
+ */
+const char* downsample_method_to_string(DownsampleMethod method);
+
+/**
+ * @brief Parse DownsampleMethod from string
+ *
+ * @param str String representation (case-insensitive)
+ * @return DownsampleMethod if recognized, std::nullopt otherwise
+ */
+std::optional<DownsampleMethod> downsample_method_from_string(const std::string& str);
+
+/**
+ * @brief Downsample with Largest-Triangle-Three-Buckets
+ *
+ * The first and last samples are always kept; the samples in between are
+ * split into threshold - 2 buckets by index, and from each bucket the
+ * sample forming the largest triangle with the previously selected sample
+ * and the average of the next bucket is kept. Samples are copied
+ * unchanged (timestamp, value, quality).
+ *
+ * @param in Input samples in timestamp order
+ * @param threshold Number of output samples; if in.size <= threshold or
+ *                  threshold < 3, all samples are copied
+ * @param out Receives the selected samples (appended)
+ * @return Number of samples appended
+ */
+size_t downsample_lttb(const SeriesView& in, size_t threshold, SignalSeries& out);
+
+/**
+ * @brief Keep the minimum and maximum of each bucket
+ *
+ * The input is split into max_points / 2 buckets by index; per bucket the
+ * VALID minimum and maximum are appended in timestamp order (once if they
+ * are the same sample).
+ *
+ * @param in Input samples in timestamp order
+ * @param max_points Maximum number of output samples; if in.size <= max_points
+ *                   or max_points < 2, all samples are copied
+ * @param out Receives the selected samples (appended)
+ * @return Number of samples appended
+ */
+size_t downsample_min_max(const SeriesView& in, size_t max_points, SignalSeries& out);
+
+/**
+ * @brief Average per time bucket
+ *
+ * Buckets are aligned to the epoch ([k * width, (k+1) * width)); each
+ * non-empty bucket yields one sample stamped with the bucket start,
+ * holding the mean of its VALID samples with VALID quality. A bucket
+ * without VALID samples yields NaN with the quality of its first sample
+ * (NOT_AVAILABLE if that sample was a VALID NaN).
+ *
+ * @param in Input samples in timestamp order
+ * @param bucket_width Bucket width; if not positive, all samples are copied
+ * @param out Receives the averaged samples (appended)
+ * @return Number of samples appended
+ */
+size_t downsample_average(const SeriesView& in, std::chrono::nanoseconds bucket_width, SignalSeries& out);
+
+/**
+ * @brief Method and target resolution for downsample_many()
+ */
+struct DownsampleSpec {
+    DownsampleMethod method = DownsampleMethod::LTTB;
+    size_t points = 1000;                                   ///< LTTB and MIN_MAX
+    std::chrono::nanoseconds bucket_width{std::chrono::seconds(1)};  ///< AVERAGE
+};
+
+/**
+ * @brief Downsample one series according to a spec
+ *
+ * @return Number of samples appended to out
+ */
+size_t downsample(const SeriesView& in, const DownsampleSpec& spec, SignalSeries& out);
+
+/**
+ * @brief Downsample many signals in parallel
+ *
+ * Signals are distributed dynamically over worker threads, so a few long
+ * histories do not hold up the rest.
+ *
+ * @param inputs One view per signal
+ * @param spec Method and resolution, applied to every signal
+ * @param threads Number of worker threads (0 = hardware concurrency)
+ * @return Downsampled series, same order as inputs
+ */
+std::vector<SignalSeries> downsample_many(
+    const std::vector<SeriesView>& inputs,
+    const DownsampleSpec& spec,
+    size_t threads = 0);
+
+} // namespace vss::types
@@ -0,0 +1,125 @@
+/**
+ * @file enum.hpp
+ * @brief Dictionary-encoded strings for VSS allowed-values signals
+ *
+ * Many VSS string signals are enums in practice (gear position, lamp
+ * modes, ...). An EnumDictionary holds the allowed strings once; values
+ * then carry a shared pointer to it plus a 16-bit code (EnumValue), so
+ * copying and comparing them does not touch the string data.
+ */
+
+#pragma once
+
+#include "value.hpp"
+#include "constraints.hpp"
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace vss::types {
+
+/**
+ * @brief Immutable list of allowed strings, indexed by code
+ *
+ * Codes are positions in the list given at creation. Dictionaries are
+ * only handed out as shared_ptr so EnumValues can keep them alive.
+ *
+ * Example:
+ * @code
+ * auto modes = EnumDictionary::create({"NORMAL", "SPORT", "ECONOMY"});
+ *
+ * Value mode = modes->encode("SPORT");         // EnumValue, code 1
+ * values_equal(mode, Value{std::string("SPORT")});  // true
+ * std::string text = std::get<EnumValue>(mode).str();
+ * @endcode
+ */
+class EnumDictionary : public std::enable_shared_from_this<EnumDictionary> {
+public:
+    /**
+     * @brief Largest number of entries a dictionary can hold
+     */
+    static constexpr size_t MAX_SIZE = 65536;
+
+    /**
+     * @brief Create a dictionary
+     *
+     * @param values Allowed strings; code i stands for values[i]
+     * @return Dictionary, or nullptr if values is empty, has duplicates or
+     *         more than MAX_SIZE entries
+     */
+    static std::shared_ptr<const EnumDictionary> create(std::vector<std::string> values);
+
+    /**
+     * @brief Create a dictionary from the string entries of `allowed`
+     *
+     * @param constraints Constraints of a STRING signal
+     * @return Dictionary, or nullptr if there are no (or duplicate) allowed strings
+     */
+    static std::shared_ptr<const EnumDictionary> from_constraints(const ValueConstraints& constraints);
+
+    EnumDictionary(const EnumDictionary&) = delete;
+    EnumDictionary& operator=(const EnumDictionary&) = delete;
+
+    /**
+     * @brief Look up the code of a string
+     *
+     * @param text String to look up
+     * @return Code, or nullopt if text is not in the dictionary
+     */
+    std::optional<uint16_t> code(std::string_view text) const;
+
+    /**
+     * @brief String of a code
+     *
+     * @param code Code to look up
+     * @return String, or an empty string if code is out of range
+     */
+    const std::string& name(uint16_t code) const noexcept;
+
+    /**
+     * @brief Encode a string into an EnumValue of this dictionary
+     *
+     * @param text String to encode
+     * @return EnumValue, or empty Value if text is not in the dictionary
+     */
+    Value encode(std::string_view text) const;
+
+    /**
+     * @brief All strings, in code order
+     */
+    const std::vector<std::string>& values() const noexcept { return values_; }
+
+    /**
+     * @brief Number of entries
+     */
+    size_t size() const noexcept { return values_.size(); }
+
+private:
+    explicit EnumDictionary(std::vector<std::string> values);
+
+    std::vector<std::string> values_;
+    std::unordered_map<std::string_view, uint16_t> index_;  ///< Views into values_
+};
+
+/**
+ * @brief Encode a STRING value with a dictionary
+ *
+ * @param value std::string or EnumValue (re-encoded if it uses another dictionary)
+ * @param dictionary Target dictionary
+ * @return EnumValue, or empty Value if the text is not in the dictionary or
+ *         value is not a STRING
+ */
+Value encode_enum(const Value& value, const std::shared_ptr<const EnumDictionary>& dictionary);
+
+/**
+ * @brief Decode an EnumValue into a plain std::string
+ *
+ * @param value Value to decode
+ * @return std::string for EnumValue; any other value is returned unchanged
+ */
+Value decode_enum(const Value& value);
+
+} // namespace vss::types
@@ -0,0 +1,217 @@
+/**
+ * @file expression.hpp
+ * @brief Compiled expressions and predicates over signal values
+ *
+ * A small expression language for rule conditions and computed values:
+ *
+ * - literals: 100, 2.5, true, false, "SPORT"
+ * - signals by VSS path: Vehicle.Speed
+ * - arithmetic: + - * / and unary -
+ * - comparisons: < <= > >= == !=
+ * - logic: && || !
+ * - functions: valid(path), abs(x), min(x, y), max(x, y)
+ *
+ * Expressions are type-checked against the ValueType of each signal in a
+ * SignalCatalog and compiled to flat bytecode. Loads are specialised per
+ * ValueType (no std::visit), comparisons against a literal are fused into
+ * one instruction, and string comparisons against allowed values compare
+ * enum codes.
+ *
+ * Missing data follows three-valued logic: a signal that is not VALID (or
+ * empty, or NaN) is unknown, anything computed from it is unknown, except
+ * that `false && x` is false and `true || x` is true. valid(path) is
+ * always known.
+ */
+
+#pragma once
+
+#include "catalog.hpp"
+#include "quality.hpp"
+#include "series.hpp"
+#include "value.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace vss::types {
+
+/**
+ * @brief Static type of an expression
+ */
+enum class ExpressionType {
+    BOOL = 0,       ///< Predicate, evaluates to bool
+    NUMBER = 1      ///< Evaluates to double
+};
+
+/**
+ * @brief Convert ExpressionType to string
+ */
+const char* expression_type_to_string(ExpressionType type);
+
+/**
+ * @brief Why an expression failed to compile
+ */
+struct ExpressionError {
+    size_t position = 0;    ///< Offset into the source
+    std::string message;
+};
+
+/**
+ * @brief Result of evaluating an expression
+ */
+struct ExpressionResult {
+    Value value;                                    ///< bool or double; empty if unknown
+    SignalQuality quality = SignalQuality::VALID;   ///< Worst quality of the inputs that made it unknown
+
+    /**
+     * @brief Known and true
+     */
+    bool is_true() const noexcept {
+        const bool* b = std::get_if<bool>(&value);
+        return quality == SignalQuality::VALID && b && *b;
+    }
+};
+
+/**
+ * @brief Compiled, type-checked expression
+ *
+ * Inputs are bound by slot: inputs() lists the distinct signals the
+ * expression reads, and evaluate() takes one sample pointer per slot.
+ * Evaluation does not allocate and a compiled expression can be shared
+ * between threads.
+ *
+ * Example:
+ * @code
+ * ExpressionError error;
+ * auto rule = Expression::compile(
+ *     "Vehicle.Speed > 100 && Vehicle.Cabin.Door.Row1.Left.IsOpen", catalog, &error);
+ * if (!rule) {
+ *     std::cerr << error.position << ": " << error.message << "\n";
+ * }
+ *
+ * std::vector<const DynamicQualifiedValue*> inputs;
+ * for (SignalId id : rule->inputs()) {
+ *     inputs.push_back(latest(id));
+ * }
+ * if (rule->evaluate(inputs.data()).is_true()) { ... }
+ *
+ * // Columnar: one SeriesView per slot, aligned rows (e.g. a ResampledTable)
+ * std::vector<uint8_t> hits;
+ * rule->evaluate_batch(columns, hits);
+ * @endcode
+ */
+class Expression {
+public:
+    /**
+     * @brief Parse, type-check and compile an expression
+     *
+     * @param source Expression text
+     * @param catalog Catalog to resolve signal paths and types against
+     * @param error If not null, receives the reason on failure
+     * @return Compiled expression, or nullopt on a syntax or type error
+     */
+    static std::optional<Expression> compile(std::string_view source, const SignalCatalog& catalog,
+                                             ExpressionError* error = nullptr);
+
+    ExpressionType type() const noexcept { return type_; }
+
+    /**
+     * @brief Signals read by the expression, in slot order
+     */
+    const std::vector<SignalId>& inputs() const noexcept { return inputs_; }
+
+    const std::string& source() const noexcept { return source_; }
+
+    /**
+     * @brief Number of bytecode instructions
+     */
+    size_t size() const noexcept { return code_.size(); }
+
+    /**
+     * @brief Evaluate against one sample per input slot
+     *
+     * @param inputs inputs()[i] is read from inputs[i] (nullptr = no sample)
+     */
+    ExpressionResult evaluate(const DynamicQualifiedValue* const* inputs) const;
+
+    /**
+     * @brief Evaluate a predicate; true only if known and true
+     */
+    bool matches(const DynamicQualifiedValue* const* inputs) const;
+
+    /**
+     * @brief Evaluate over aligned columns, one block of rows at a time
+     *
+     * Every instruction runs over a block of rows before the next, so
+     * comparisons and arithmetic are tight loops (AVX2 where available).
+     * Bool signals are read as 0/1. Rows whose inputs are not VALID or NaN
+     * are unknown, as in evaluate().
+     *
+     * @param columns One view per input slot, all of the same size
+     * @param out Per row: 1 if the result is known and true (BOOL) or known
+     *            and non-zero (NUMBER), else 0 (resized)
+     * @return Number of rows set to 1, or nullopt if the column count or
+     *         sizes do not match or the expression compares strings
+     */
+    std::optional<size_t> evaluate_batch(const std::vector<SeriesView>& columns,
+                                         std::vector<uint8_t>& out) const;
+
+    /**
+     * @brief Evaluate a NUMBER expression over aligned columns
+     *
+     * @param out Per row: the result, or NaN if unknown (resized)
+     * @return Number of known rows, or nullopt as for the predicate overload
+     *         or if the expression is not NUMBER
+     */
+    std::optional<size_t> evaluate_batch(const std::vector<SeriesView>& columns,
+                                         std::vector<double>& out) const;
+
+    /**
+     * @brief Bytecode operation
+     */
+    enum class Op : uint8_t {
+        LOAD_BOOL, LOAD_INT8, LOAD_INT16, LOAD_INT32, LOAD_INT64,
+        LOAD_UINT8, LOAD_UINT16, LOAD_UINT32, LOAD_UINT64, LOAD_FLOAT, LOAD_DOUBLE,
+        VALID, CONST,
+        ADD, SUB, MUL, DIV, NEG, ABS, MIN, MAX,
+        LT, LE, GT, GE, EQ, NE,
+        LT_CONST, LE_CONST, GT_CONST, GE_CONST, EQ_CONST, NE_CONST,
+        STR_EQ, STR_NE,
+        NOT, AND, OR,
+        AND_SKIP, OR_SKIP       ///< Short-circuit jumps (ignored in batch mode)
+    };
+
+    struct Instruction {
+        Op op;
+        uint32_t arg = 0;       ///< Input slot, string constant or jump target
+        double constant = 0.0;
+    };
+
+private:
+    friend class ExpressionCompiler;
+
+    struct StringConstant {
+        std::string text;
+        uint32_t slot = 0;                                 ///< Input slot compared against
+        std::shared_ptr<const EnumDictionary> dictionary;  ///< Of the compared signal, if enum-coded
+        uint16_t code = 0;                                 ///< text's code in dictionary
+    };
+
+    bool run(const DynamicQualifiedValue* const* inputs, double& result, SignalQuality& worst) const;
+
+    template<typename Out>
+    std::optional<size_t> run_batch(const std::vector<SeriesView>& columns, Out* out, size_t rows) const;
+
+    std::string source_;
+    ExpressionType type_ = ExpressionType::BOOL;
+    std::vector<SignalId> inputs_;
+    std::vector<Instruction> code_;
+    std::vector<StringConstant> strings_;
+    size_t stack_depth_ = 0;
+};
+
+} // namespace vss::types
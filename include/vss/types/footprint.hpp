@@ -0,0 +1,120 @@
+/**
+ * @file footprint.hpp
+ * @brief Deep memory-footprint accounting for values, structs and the struct registry
+ *
+ * sizeof(Value) only covers the variant itself; strings, vectors, struct
+ * map nodes and shared_ptr control blocks live on the heap. The functions
+ * here walk a value and add up what it owns, so the effect of layout
+ * changes (small-string-friendly names, fewer nested structs, shared
+ * dictionaries) can be measured.
+ *
+ * Heap sizes are the bytes requested from the allocator, derived from
+ * container capacities and the standard library's node layouts; malloc
+ * rounding and headers are not included.
+ */
+
+#pragma once
+
+#include "struct.hpp"
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace vss::types {
+
+/**
+ * @brief Memory owned by a value (or a set of values)
+ */
+struct MemoryUsage {
+    size_t inline_bytes = 0;    ///< Bytes inside the objects themselves (sizeof)
+    size_t heap_bytes = 0;      ///< Bytes of heap blocks they own
+    size_t allocations = 0;     ///< Number of heap blocks
+    size_t inline_strings = 0;  ///< Strings held in the small-string buffer
+    size_t heap_strings = 0;    ///< Strings with a heap buffer
+    size_t structs = 0;         ///< StructValues counted (each shared instance once)
+
+    /**
+     * @brief Inline plus heap bytes
+     */
+    size_t total_bytes() const noexcept { return inline_bytes + heap_bytes; }
+
+    MemoryUsage& operator+=(const MemoryUsage& other) noexcept {
+        inline_bytes += other.inline_bytes;
+        heap_bytes += other.heap_bytes;
+        allocations += other.allocations;
+        inline_strings += other.inline_strings;
+        heap_strings += other.heap_strings;
+        structs += other.structs;
+        return *this;
+    }
+};
+
+/**
+ * @brief Memory of a value, recursing through nested structs and struct arrays
+ *
+ * inline_bytes is sizeof(Value). A StructValue reached through several
+ * shared_ptrs is counted once; the shared_ptr control block is assumed to
+ * come from std::make_shared (one allocation with the object). The
+ * EnumDictionary of an EnumValue is shared by all values of a signal and
+ * is not counted.
+ *
+ * @param value Value to measure
+ * @return Owned memory
+ */
+MemoryUsage memory_usage(const Value& value);
+
+/**
+ * @brief Memory of a struct value and everything its fields own
+ *
+ * inline_bytes is sizeof(StructValue); field map nodes, names and values
+ * are heap. Same rules as memory_usage(const Value&).
+ *
+ * @param value Struct to measure
+ * @return Owned memory
+ */
+MemoryUsage memory_usage(const StructValue& value);
+
+/**
+ * @brief Memory of a struct definition (names, descriptions, defaults, constraints)
+ */
+MemoryUsage memory_usage(const StructDefinition& definition);
+
+/**
+ * @brief Footprint of one registered struct type
+ */
+struct StructMemoryEntry {
+    std::string type_name;
+    size_t field_count = 0;
+    MemoryUsage definition;     ///< Schema held by the registry
+    MemoryUsage instance;       ///< One instance with every field set (see memory_report())
+};
+
+/**
+ * @brief Footprint of a StructRegistry and of one instance per struct type
+ */
+struct RegistryMemoryReport {
+    std::vector<StructMemoryEntry> structs;     ///< By type name
+    MemoryUsage registry;                       ///< Registry object, map nodes and all definitions
+
+    /**
+     * @brief Human-readable table, one line per struct type plus totals
+     *
+     * The Strings column shows heap-allocated / total strings of the instance.
+     */
+    std::string to_string() const;
+};
+
+/**
+ * @brief Measure the registry and a default instance of every struct type
+ *
+ * The instance of a type has every field set: to its default value if
+ * the definition has one, else to an empty value of the field type
+ * (nested structs are filled the same way, struct arrays are empty). It
+ * shows the minimum a signal of that type costs once fully populated.
+ *
+ * @param registry Registry to measure
+ * @return Report with one entry per registered struct
+ */
+RegistryMemoryReport memory_report(const StructRegistry& registry);
+
+} // namespace vss::types
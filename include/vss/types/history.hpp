@@ -0,0 +1,146 @@
+/**
+ * @file history.hpp
+ * @brief Per-signal value history with point-in-time (as-of) queries
+ */
+
+#pragma once
+
+#include "catalog.hpp"
+#include "quality.hpp"
+#include "update.hpp"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace vss::types {
+
+/**
+ * @brief Result of an as-of join, stored column by column
+ *
+ * Column c holds, for every query time, the latest sample of signals[c]
+ * at or before that time. Cells without such a sample hold an empty
+ * value with NOT_AVAILABLE quality and the query time as timestamp.
+ */
+struct AsOfTable {
+    std::vector<std::chrono::system_clock::time_point> times;  ///< Query times (rows)
+    std::vector<SignalId> signals;                              ///< Columns
+    std::vector<DynamicQualifiedValue> cells;                   ///< Column c at [c * rows(), (c + 1) * rows())
+
+    size_t rows() const noexcept { return times.size(); }
+    size_t columns() const noexcept { return signals.size(); }
+
+    const DynamicQualifiedValue& cell(size_t row, size_t column) const noexcept {
+        return cells[column * rows() + row];
+    }
+};
+
+/**
+ * @brief Indexed history of all signals, keyed by SignalId
+ *
+ * Each signal keeps its samples in timestamp order in separate columns
+ * (timestamps, values, qualities). The "value at time t" is the latest
+ * sample with timestamp <= t, found by binary search over the timestamp
+ * column; batch joins over sorted query times use exponential search from
+ * the previous hit, so a join costs O(log gap) per lookup.
+ *
+ * Samples normally arrive in order and are appended; an older sample is
+ * inserted at its position (equal timestamps keep arrival order).
+ *
+ * Example:
+ * @code
+ * HistoryStore history;
+ * history.record(speed_id, DynamicQualifiedValue{Value{88.0f}, SignalQuality::VALID, ts});
+ *
+ * auto speed_then = history.as_of(speed_id, incident_time);
+ * auto everything = history.snapshot(incident_time);
+ * @endcode
+ */
+class HistoryStore {
+public:
+    /**
+     * @brief Record a sample of a signal
+     *
+     * @return false if id is INVALID_SIGNAL_ID
+     */
+    bool record(SignalId id, DynamicQualifiedValue sample);
+
+    /**
+     * @brief Record an update
+     *
+     * @return false if the update has no valid id
+     */
+    bool record(SignalUpdate update) { return record(update.id, std::move(update.value)); }
+
+    /**
+     * @brief Latest sample of a signal at or before t
+     *
+     * @return Sample, or nullopt if the signal has no sample at or before t
+     */
+    std::optional<DynamicQualifiedValue> as_of(SignalId id, std::chrono::system_clock::time_point t) const;
+
+    /**
+     * @brief Latest sample at or before t of every recorded signal
+     *
+     * @return One update per signal that has such a sample, in id order
+     */
+    std::vector<SignalUpdate> snapshot(std::chrono::system_clock::time_point t) const;
+
+    /**
+     * @brief Latest sample at or before t of the signals in a set
+     */
+    std::vector<SignalUpdate> snapshot(std::chrono::system_clock::time_point t, const SignalSet& signals) const;
+
+    /**
+     * @brief Look up many signals at many points in time
+     *
+     * Sorted query times are resolved with one forward exponential search
+     * per signal; unsorted times fall back to a binary search per lookup.
+     *
+     * @param signals Columns of the result
+     * @param times Query times (rows of the result)
+     */
+    AsOfTable as_of_join(const std::vector<SignalId>& signals,
+                         const std::vector<std::chrono::system_clock::time_point>& times) const;
+
+    /**
+     * @brief Drop samples older than t, keeping the latest one before t
+     *
+     * as_of() answers for times >= t are unchanged.
+     */
+    void trim_before(std::chrono::system_clock::time_point t);
+
+    /**
+     * @brief Number of samples stored for a signal
+     */
+    size_t size(SignalId id) const noexcept;
+
+    /**
+     * @brief Number of samples stored over all signals
+     */
+    size_t total_size() const noexcept;
+
+    void clear() noexcept { signals_.clear(); }
+
+private:
+    struct Column {
+        std::vector<int64_t> timestamps;    ///< ns since epoch, non-decreasing
+        std::vector<Value> values;
+        std::vector<SignalQuality> qualities;
+
+        /// Index of the latest sample <= t, or npos
+        size_t find(int64_t t) const noexcept;
+        DynamicQualifiedValue sample(size_t i) const;
+    };
+
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    const Column* column(SignalId id) const noexcept {
+        return id < signals_.size() ? &signals_[id] : nullptr;
+    }
+
+    std::vector<Column> signals_;
+};
+
+} // namespace vss::types
@@ -0,0 +1,137 @@
+/**
+ * @file instrumentation.hpp
+ * @brief Optional hot-path counters for conversion, validation and comparison
+ *
+ * Built with -DVSS_TYPES_ENABLE_INSTRUMENTATION=ON, the library counts:
+ * - convert_value_type() calls by (from, to) type pair and outcome
+ * - validate_struct() calls by outcome (the first error found)
+ * - values_equal() calls and the values and structs they visit
+ *
+ * Counters live in a block per thread that only its owner writes, so
+ * counting is a plain load and store with no shared cache lines.
+ * instrumentation_snapshot() sums the blocks of all threads, including
+ * threads that have exited.
+ *
+ * The first instrumented call on a thread registers its block, taking a
+ * process-wide mutex once. Registration allocates nothing for the first
+ * 64 concurrently live threads; beyond that, the registry's list may grow.
+ *
+ * Without the option, the counting statements are compiled out and
+ * instrumentation_snapshot() returns zeros.
+ */
+
+#pragma once
+
+#include "value.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#if VSS_TYPES_ENABLE_INSTRUMENTATION
+#define VSS_TYPES_INSTRUMENT(...) __VA_ARGS__
+#else
+#define VSS_TYPES_INSTRUMENT(...) do {} while (0)
+#endif
+
+namespace vss::types {
+
+/**
+ * @brief Whether the library was built with instrumentation
+ */
+constexpr bool instrumentation_enabled() noexcept {
+#if VSS_TYPES_ENABLE_INSTRUMENTATION
+    return true;
+#else
+    return false;
+#endif
+}
+
+/**
+ * @brief Result of a convert_value_type() call
+ */
+enum class ConversionOutcome {
+    UNCHANGED = 0,      ///< Already the target type, or empty
+    CONVERTED = 1,
+    INCOMPATIBLE = 2,   ///< Types are not compatible
+    OUT_OF_RANGE = 3    ///< A value (or array element) does not fit the target type
+};
+
+constexpr size_t CONVERSION_OUTCOME_COUNT = 4;
+
+/**
+ * @brief Result of a validate_struct() call (the first error found)
+ */
+enum class ValidationOutcome {
+    VALID = 0,
+    UNKNOWN_TYPE = 1,           ///< Struct type not in the registry
+    MISSING_FIELD = 2,          ///< Required field without default missing
+    TYPE_MISMATCH = 3,          ///< Field value of an incompatible type
+    CONSTRAINT_VIOLATION = 4,   ///< Field value outside min/max/allowed
+    EXTRA_FIELD = 5             ///< Field not in the definition (strict mode)
+};
+
+constexpr size_t VALIDATION_OUTCOME_COUNT = 6;
+
+const char* conversion_outcome_to_string(ConversionOutcome outcome);
+const char* validation_outcome_to_string(ValidationOutcome outcome);
+
+/**
+ * @brief Number of conversions of one (from, to, outcome) combination
+ */
+struct ConversionCount {
+    ValueType from = ValueType::UNSPECIFIED;
+    ValueType to = ValueType::UNSPECIFIED;
+    ConversionOutcome outcome = ConversionOutcome::UNCHANGED;
+    uint64_t count = 0;
+};
+
+/**
+ * @brief Counter totals over all threads
+ */
+struct InstrumentationSnapshot {
+    std::vector<ConversionCount> conversions;   ///< Non-zero combinations only
+    std::array<uint64_t, VALIDATION_OUTCOME_COUNT> validations{};
+    uint64_t compare_calls = 0;     ///< values_equal() calls
+    uint64_t compare_nodes = 0;     ///< Values visited, including struct fields
+    uint64_t compare_structs = 0;   ///< StructValues visited
+
+    /**
+     * @brief Conversions of one type pair with one outcome
+     */
+    uint64_t conversion_count(ValueType from, ValueType to, ConversionOutcome outcome) const noexcept;
+
+    /**
+     * @brief Conversions with one outcome, over all type pairs
+     */
+    uint64_t conversion_count(ConversionOutcome outcome) const noexcept;
+
+    uint64_t validation_count(ValidationOutcome outcome) const noexcept {
+        return validations[static_cast<size_t>(outcome)];
+    }
+};
+
+/**
+ * @brief Sum the counters of all threads since the last reset
+ *
+ * Thread-safe; counts from threads still running may be slightly behind.
+ */
+InstrumentationSnapshot instrumentation_snapshot();
+
+/**
+ * @brief Start counting from zero
+ *
+ * The counters themselves are not cleared (other threads own them); later
+ * snapshots subtract the totals at the time of the reset.
+ */
+void reset_instrumentation();
+
+namespace detail {
+void count_conversion(ValueType from, ValueType to, ConversionOutcome outcome) noexcept;
+void count_validation(ValidationOutcome outcome) noexcept;
+void count_compare_call() noexcept;
+void count_compare_node() noexcept;
+void count_compare_struct() noexcept;
+} // namespace detail
+
+} // namespace vss::types
@@ -0,0 +1,282 @@
+/**
+ * @file latency.hpp
+ * @brief Latency histograms and per-stage value-age instrumentation
+ *
+ * LatencyHistogram is an HDR-style log-linear histogram of nanosecond
+ * latencies: values below 128 ns are counted exactly, larger values in
+ * 64 linear sub-buckets per power of two (relative error below 1.6%),
+ * up to MAX_TRACKABLE_NS. Histograms merge by adding bucket counts.
+ *
+ * LatencyRecorder is the thread-safe front end: each thread records into
+ * its own shard of relaxed atomic counters, and snapshot() merges the
+ * shards into a LatencyHistogram.
+ *
+ * The decode, conversion, validation and dispatch paths record the age
+ * (now() - timestamp) of every value they handle into the recorder
+ * installed for their PipelineStage. Without a recorder the cost is one
+ * atomic load per call.
+ */
+
+#pragma once
+
+#include "quality.hpp"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace vss::types {
+
+/**
+ * @brief Percentiles and extremes of a latency histogram
+ */
+struct LatencySummary {
+    uint64_t count = 0;
+    std::chrono::nanoseconds min{0};
+    std::chrono::nanoseconds mean{0};
+    std::chrono::nanoseconds p50{0};
+    std::chrono::nanoseconds p90{0};
+    std::chrono::nanoseconds p99{0};
+    std::chrono::nanoseconds p999{0};
+    std::chrono::nanoseconds max{0};
+};
+
+/**
+ * @brief Log-linear histogram of nanosecond latencies
+ *
+ * Not thread-safe; see LatencyRecorder for concurrent recording.
+ *
+ * Example:
+ * @code
+ * LatencyHistogram histogram;
+ * histogram.record(std::chrono::microseconds(250));
+ * auto p99 = histogram.quantile(0.99);
+ * @endcode
+ */
+class LatencyHistogram {
+public:
+    static constexpr unsigned SUB_BUCKET_BITS = 6;
+    static constexpr int64_t SUB_BUCKET_COUNT = int64_t(1) << SUB_BUCKET_BITS;
+    static constexpr unsigned MAGNITUDE_BITS = 36;
+
+    /**
+     * @brief Largest distinct latency (about 68.7 s); larger ones land in the last bucket
+     */
+    static constexpr int64_t MAX_TRACKABLE_NS = (int64_t(1) << MAGNITUDE_BITS) - 1;
+
+    static constexpr size_t BUCKET_COUNT =
+        (MAGNITUDE_BITS - SUB_BUCKET_BITS) * SUB_BUCKET_COUNT + SUB_BUCKET_COUNT;
+
+    LatencyHistogram();
+
+    /**
+     * @brief Add n samples of one latency (negative latencies count as 0)
+     */
+    void record(std::chrono::nanoseconds latency, uint64_t n = 1) noexcept;
+
+    /**
+     * @brief Add all samples of another histogram
+     */
+    void merge(const LatencyHistogram& other) noexcept;
+
+    /**
+     * @brief Get a latency quantile
+     *
+     * Reports the highest latency of the bucket holding the quantile,
+     * clamped to the recorded min and max (q = 0 is the exact min).
+     *
+     * @param q Quantile in [0, 1] (0.5 = median, 0.99 = p99)
+     * @return Latency, or nullopt if the histogram is empty
+     */
+    std::optional<std::chrono::nanoseconds> quantile(double q) const;
+
+    /**
+     * @brief Count, mean, extremes and the usual percentiles
+     */
+    LatencySummary summary() const;
+
+    uint64_t count() const noexcept { return count_; }
+    std::chrono::nanoseconds min() const noexcept { return std::chrono::nanoseconds(count_ ? min_ : 0); }
+    std::chrono::nanoseconds max() const noexcept { return std::chrono::nanoseconds(max_); }
+    std::chrono::nanoseconds mean() const noexcept;
+
+    /**
+     * @brief Samples in one bucket
+     */
+    uint64_t bucket_count(size_t index) const noexcept { return index < counts_.size() ? counts_[index] : 0; }
+
+    void clear() noexcept;
+
+    /**
+     * @brief Bucket a latency (in ns, >= 0) is counted in
+     */
+    static size_t bucket_index(int64_t ns) noexcept {
+        if (ns > MAX_TRACKABLE_NS) {
+            ns = MAX_TRACKABLE_NS;
+        }
+        const unsigned magnitude = 63u - static_cast<unsigned>(__builtin_clzll(static_cast<uint64_t>(ns) | 1u));
+        const unsigned shift = magnitude > SUB_BUCKET_BITS ? magnitude - SUB_BUCKET_BITS : 0;
+        return static_cast<size_t>(shift) * SUB_BUCKET_COUNT + static_cast<size_t>(ns >> shift);
+    }
+
+    /**
+     * @brief Smallest latency counted in a bucket
+     */
+    static int64_t bucket_lower(size_t index) noexcept;
+
+    /**
+     * @brief Largest latency counted in a bucket
+     */
+    static int64_t bucket_upper(size_t index) noexcept;
+
+private:
+    friend class LatencyRecorder;
+
+    std::vector<uint64_t> counts_;
+    uint64_t count_ = 0;
+    uint64_t sum_ns_ = 0;
+    int64_t min_ = 0;
+    int64_t max_ = 0;
+};
+
+/**
+ * @brief Thread-safe latency histogram with per-thread shards
+ *
+ * record() is wait-free: it adds to the shard of the calling thread with
+ * relaxed atomics, so threads on different shards never share a cache
+ * line. snapshot() may run concurrently with recording and sees each
+ * sample either fully or not at all in the bucket counts.
+ *
+ * Example:
+ * @code
+ * LatencyRecorder dispatch_latency;
+ * ScopedStageRecorder scope{PipelineStage::DISPATCH, dispatch_latency};
+ * ...
+ * auto p99 = dispatch_latency.snapshot().quantile(0.99);
+ * @endcode
+ */
+class LatencyRecorder {
+public:
+    /**
+     * @param shards Number of shards (0 = one per hardware thread)
+     */
+    explicit LatencyRecorder(size_t shards = 0);
+
+    LatencyRecorder(const LatencyRecorder&) = delete;
+    LatencyRecorder& operator=(const LatencyRecorder&) = delete;
+
+    /**
+     * @brief Add n samples of one latency
+     */
+    void record(std::chrono::nanoseconds latency, uint64_t n = 1) noexcept;
+
+    /**
+     * @brief Record the age of a timestamp at a given time
+     */
+    void record_age(std::chrono::system_clock::time_point timestamp,
+                    std::chrono::system_clock::time_point now, uint64_t n = 1) noexcept {
+        record(std::chrono::duration_cast<std::chrono::nanoseconds>(now - timestamp), n);
+    }
+
+    /**
+     * @brief Record the age of a value at vss::types::now()
+     */
+    void record_age(const DynamicQualifiedValue& value) noexcept;
+
+    /**
+     * @brief Record the ages of many values at a given time
+     *
+     * Cheaper than one record_age() per value: the sum and extremes are
+     * updated once per call.
+     */
+    void record_ages(const DynamicQualifiedValue* values, size_t count,
+                     std::chrono::system_clock::time_point now) noexcept;
+
+    /**
+     * @brief Merge all shards into one histogram
+     */
+    LatencyHistogram snapshot() const;
+
+    /**
+     * @brief Clear all shards (not atomic with respect to concurrent record())
+     */
+    void reset() noexcept;
+
+    size_t shard_count() const noexcept { return shard_count_; }
+
+private:
+    struct alignas(64) Shard {
+        std::array<std::atomic<uint64_t>, LatencyHistogram::BUCKET_COUNT> counts{};
+        std::atomic<uint64_t> sum_ns{0};
+        std::atomic<int64_t> min{INT64_MAX};
+        std::atomic<int64_t> max{0};
+    };
+
+    void add(Shard& shard, uint64_t sum_ns, int64_t min, int64_t max) noexcept;
+
+    std::unique_ptr<Shard[]> shards_;
+    size_t shard_count_;
+};
+
+/**
+ * @brief Instrumented pipeline stage
+ */
+enum class PipelineStage {
+    DECODE = 0,         ///< FrameDecoder::decode()
+    CONVERSION = 1,     ///< scale_into_slots()
+    VALIDATION = 2,     ///< ConstraintChecker::apply()
+    DISPATCH = 3        ///< UpdateScheduler::dispatch()
+};
+
+constexpr size_t PIPELINE_STAGE_COUNT = 4;
+
+/**
+ * @brief Convert PipelineStage to string
+ */
+const char* pipeline_stage_to_string(PipelineStage stage);
+
+namespace detail {
+extern std::array<std::atomic<LatencyRecorder*>, PIPELINE_STAGE_COUNT> stage_recorders;
+} // namespace detail
+
+/**
+ * @brief Recorder installed for a stage (nullptr if not instrumented)
+ */
+inline LatencyRecorder* stage_recorder(PipelineStage stage) noexcept {
+    return detail::stage_recorders[static_cast<size_t>(stage)].load(std::memory_order_acquire);
+}
+
+/**
+ * @brief Install a recorder for a stage, process-wide
+ *
+ * The recorder must stay alive while installed.
+ *
+ * @param stage Stage to instrument
+ * @param recorder New recorder, or nullptr to disable
+ * @return Previously installed recorder
+ */
+LatencyRecorder* set_stage_recorder(PipelineStage stage, LatencyRecorder* recorder) noexcept;
+
+/**
+ * @brief Installs a stage recorder for the lifetime of the object
+ */
+class ScopedStageRecorder {
+public:
+    ScopedStageRecorder(PipelineStage stage, LatencyRecorder& recorder) noexcept
+        : stage_(stage), previous_(set_stage_recorder(stage, &recorder)) {}
+
+    ~ScopedStageRecorder() { set_stage_recorder(stage_, previous_); }
+
+    ScopedStageRecorder(const ScopedStageRecorder&) = delete;
+    ScopedStageRecorder& operator=(const ScopedStageRecorder&) = delete;
+
+private:
+    PipelineStage stage_;
+    LatencyRecorder* previous_;
+};
+
+} // namespace vss::types
@@ -0,0 +1,104 @@
+/**
+ * @file merge.hpp
+ * @brief Streaming k-way merge of update sources by timestamp
+ */
+
+#pragma once
+
+#include "update.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace vss::types {
+
+/**
+ * @brief Merges many time-ordered UpdateSources into one time-ordered stream
+ *
+ * Uses a loser tree over the sources: producing an update costs one
+ * comparison per tree level (log2 k), and only the path of the source
+ * that produced it is replayed. Each source is read in batches into a
+ * reusable buffer, and updates are moved from there to the caller, so
+ * values are never copied.
+ *
+ * Updates with equal timestamps are returned in source order (lower index
+ * first), which makes the merge deterministic.
+ *
+ * The sources are not owned and must outlive the merger.
+ *
+ * Example:
+ * @code
+ * VectorUpdateSource can0{std::move(bus0)}, can1{std::move(bus1)};
+ * UpdateMerger merger({&can0, &can1});
+ *
+ * SignalUpdate update;
+ * while (merger.next(update)) {
+ *     log.write(update);
+ * }
+ * @endcode
+ */
+class UpdateMerger {
+public:
+    /**
+     * @param sources Inputs, each in non-decreasing timestamp order (nullptr entries are ignored)
+     * @param batch_size Updates pulled from a source at a time
+     */
+    explicit UpdateMerger(std::vector<UpdateSource*> sources, size_t batch_size = 256);
+
+    /**
+     * @brief Move the next update into out
+     *
+     * @return false if all sources are exhausted
+     */
+    bool next(SignalUpdate& out);
+
+    /**
+     * @brief Append up to max_count next updates to out
+     *
+     * @return Number of updates appended (0 once all sources are exhausted)
+     */
+    size_t next_batch(std::vector<SignalUpdate>& out, size_t max_count);
+
+    /**
+     * @brief Next update without consuming it
+     *
+     * @return nullptr if all sources are exhausted
+     */
+    const SignalUpdate* peek() const noexcept;
+
+    /**
+     * @brief True once all sources are exhausted
+     */
+    bool done() const noexcept { return exhausted_[winner_] != 0; }
+
+    /**
+     * @brief Number of sources
+     */
+    size_t source_count() const noexcept { return inputs_.size(); }
+
+private:
+    struct Input {
+        UpdateSource* source = nullptr;
+        std::vector<SignalUpdate> buffer;
+        size_t position = 0;
+    };
+
+    bool less(uint32_t a, uint32_t b) const noexcept {
+        if (keys_[a] != keys_[b]) return keys_[a] < keys_[b];
+        if (exhausted_[a] != exhausted_[b]) return exhausted_[a] < exhausted_[b];
+        return a < b;
+    }
+
+    void refill(uint32_t leaf);
+    void advance(uint32_t leaf);
+
+    std::vector<Input> inputs_;
+    std::vector<int64_t> keys_;         ///< Head timestamp per leaf (ns), max when exhausted
+    std::vector<uint8_t> exhausted_;    ///< Per leaf, including padding leaves
+    std::vector<uint32_t> losers_;      ///< losers_[n] = losing leaf at internal node n (1-based)
+    uint32_t leaves_ = 1;               ///< Source count rounded up to a power of two
+    uint32_t winner_ = 0;
+    size_t batch_size_;
+};
+
+} // namespace vss::types
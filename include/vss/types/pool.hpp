@@ -0,0 +1,95 @@
+/**
+ * @file pool.hpp
+ * @brief Work-stealing thread pool
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace vss::types {
+
+/**
+ * @brief Fixed set of worker threads with one task deque each
+ *
+ * A task submitted from a worker goes to that worker's own deque and is
+ * taken from the back (most recent first, which keeps related work on the
+ * same core); idle workers steal from the front of other deques. Tasks
+ * submitted from other threads are spread round-robin.
+ *
+ * wait() blocks until every submitted task has finished, running queued
+ * tasks on the calling thread in the meantime, so a pool with zero
+ * workers still makes progress.
+ *
+ * Example:
+ * @code
+ * WorkStealingPool pool(4);
+ * for (auto& job : jobs) {
+ *     pool.submit([&job] { job.run(); });
+ * }
+ * pool.wait();
+ * @endcode
+ */
+class WorkStealingPool {
+public:
+    using Task = std::function<void()>;
+
+    /**
+     * @param threads Worker threads (0 = hardware concurrency - 1; the
+     *                thread calling wait() also runs tasks)
+     */
+    explicit WorkStealingPool(size_t threads = 0);
+    ~WorkStealingPool();
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    /**
+     * @brief Queue a task (tasks may submit further tasks)
+     */
+    void submit(Task task);
+
+    /**
+     * @brief Run tasks until all submitted tasks have finished
+     *
+     * A task that throws still counts as finished and does not stop the
+     * other tasks. Once they are all done, wait() rethrows the first such
+     * exception (later ones are dropped).
+     */
+    void wait();
+
+    /**
+     * @brief Number of worker threads
+     */
+    size_t size() const noexcept { return threads_.size(); }
+
+private:
+    struct Queue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    bool try_run(size_t self);
+    void worker_loop(size_t index);
+
+    std::vector<std::unique_ptr<Queue>> queues_;    ///< One per worker plus one for outside threads
+    std::vector<std::thread> threads_;
+    std::atomic<size_t> pending_{0};                ///< Submitted, not yet finished
+    std::atomic<size_t> queued_{0};                 ///< Submitted, not yet started
+    std::atomic<size_t> next_queue_{0};
+    std::atomic<bool> stop_{false};
+    std::mutex sleep_mutex_;
+    std::condition_variable wake_;
+    std::exception_ptr error_;                      ///< First exception thrown by a task, under sleep_mutex_
+};
+
+} // namespace vss::types
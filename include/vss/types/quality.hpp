@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include "clock.hpp"
 #include "value.hpp"
 #include <chrono>
 #include <cmath>
@@ -80,7 +81,7 @@ std::optional<SignalQuality> signal_quality_from_string(const std::string& str);
  * QualifiedValue<float> speed{
  *     120.5f,                  // value
  *     SignalQuality::VALID,    // quality
- *     std::chrono::system_clock::now()  // timestamp
+ *     vss::types::now()        // timestamp
  * };
  *
  * if (speed.is_valid()) {
@@ -96,17 +97,17 @@ struct QualifiedValue {
 
     QualifiedValue()
         : quality(SignalQuality::UNKNOWN)
-        , timestamp(std::chrono::system_clock::now()) {}
+        , timestamp(vss::types::now()) {}
 
     explicit QualifiedValue(T val)
         : value(std::move(val))
         , quality(SignalQuality::VALID)
-        , timestamp(std::chrono::system_clock::now()) {}
+        , timestamp(vss::types::now()) {}
 
     QualifiedValue(T val, SignalQuality q)
         : value(std::move(val))
         , quality(q)
-        , timestamp(std::chrono::system_clock::now()) {}
+        , timestamp(vss::types::now()) {}
 
     QualifiedValue(T val, SignalQuality q, std::chrono::system_clock::time_point ts)
         : value(std::move(val))
@@ -155,8 +156,7 @@ struct QualifiedValue {
      * @brief Get age of the value
      */
     std::chrono::milliseconds age() const {
-        auto now = std::chrono::system_clock::now();
-        return std::chrono::duration_cast<std::chrono::milliseconds>(now - timestamp);
+        return std::chrono::duration_cast<std::chrono::milliseconds>(vss::types::now() - timestamp);
     }
 
     /**
@@ -243,17 +243,17 @@ struct DynamicQualifiedValue {
 
     DynamicQualifiedValue()
         : quality(SignalQuality::UNKNOWN)
-        , timestamp(std::chrono::system_clock::now()) {}
+        , timestamp(vss::types::now()) {}
 
     explicit DynamicQualifiedValue(Value val)
         : value(std::move(val))
         , quality(SignalQuality::VALID)
-        , timestamp(std::chrono::system_clock::now()) {}
+        , timestamp(vss::types::now()) {}
 
     DynamicQualifiedValue(Value val, SignalQuality q)
         : value(std::move(val))
         , quality(q)
-        , timestamp(std::chrono::system_clock::now()) {}
+        , timestamp(vss::types::now()) {}
 
     DynamicQualifiedValue(Value val, SignalQuality q, std::chrono::system_clock::time_point ts)
         : value(std::move(val))
@@ -285,8 +285,7 @@ struct DynamicQualifiedValue {
      * @brief Get age of the value
      */
     std::chrono::milliseconds age() const {
-        auto now = std::chrono::system_clock::now();
-        return std::chrono::duration_cast<std::chrono::milliseconds>(now - timestamp);
+        return std::chrono::duration_cast<std::chrono::milliseconds>(vss::types::now() - timestamp);
     }
 
     /**
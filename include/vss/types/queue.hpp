@@ -0,0 +1,133 @@
+/**
+ * @file queue.hpp
+ * @brief Bounded lock-free multi-producer multi-consumer queue
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace vss::types {
+
+/**
+ * @brief Bounded MPMC queue (Dmitry Vyukov's array queue)
+ *
+ * Each cell carries a sequence number that tells producers and consumers
+ * whether it is free or filled for their lap of the ring, so push and pop
+ * are a single CAS on the shared position plus one store. No locks, no
+ * allocation after construction.
+ *
+ * Example:
+ * @code
+ * MpmcQueue<SignalUpdate> queue(1024);
+ * if (!queue.try_push(std::move(update))) {
+ *     // full
+ * }
+ * SignalUpdate next;
+ * while (queue.try_pop(next)) { ... }
+ * @endcode
+ */
+template<typename T>
+class MpmcQueue {
+public:
+    /**
+     * @param capacity Number of elements, rounded up to a power of two (at least 2)
+     */
+    explicit MpmcQueue(size_t capacity) {
+        size_t size = 2;
+        while (size < capacity) {
+            size *= 2;
+        }
+        mask_ = size - 1;
+        cells_ = std::make_unique<Cell[]>(size);
+        for (size_t i = 0; i < size; ++i) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MpmcQueue(const MpmcQueue&) = delete;
+    MpmcQueue& operator=(const MpmcQueue&) = delete;
+
+    /**
+     * @brief Append an element
+     *
+     * @return false if the queue is full (value is left untouched)
+     */
+    bool try_push(T&& value) { return emplace(std::move(value)); }
+    bool try_push(const T& value) { return emplace(value); }
+
+    /**
+     * @brief Remove the oldest element
+     *
+     * @return false if the queue is empty
+     */
+    bool try_pop(T& out) {
+        size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = cells_[pos & mask_];
+            const size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos + 1);
+            if (diff == 0) {
+                if (dequeue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    out = std::move(cell.value);
+                    cell.sequence.store(pos + mask_ + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = dequeue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    size_t capacity() const noexcept { return mask_ + 1; }
+
+    /**
+     * @brief Number of elements (approximate while other threads are active)
+     */
+    size_t size() const noexcept {
+        const size_t tail = enqueue_pos_.load(std::memory_order_relaxed);
+        const size_t head = dequeue_pos_.load(std::memory_order_relaxed);
+        return tail > head ? tail - head : 0;
+    }
+
+    bool empty() const noexcept { return size() == 0; }
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence{0};
+        T value{};
+    };
+
+    template<typename U>
+    bool emplace(U&& value) {
+        size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = cells_[pos & mask_];
+            const size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos);
+            if (diff == 0) {
+                if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell.value = std::forward<U>(value);
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = enqueue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    std::unique_ptr<Cell[]> cells_;
+    size_t mask_ = 0;
+    alignas(64) std::atomic<size_t> enqueue_pos_{0};    ///< Own cache lines: producers and
+    alignas(64) std::atomic<size_t> dequeue_pos_{0};    ///< consumers do not false-share
+};
+
+} // namespace vss::types
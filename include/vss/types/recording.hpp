@@ -0,0 +1,303 @@
+/**
+ * @file recording.hpp
+ * @brief Append-only binary recording of signal updates
+ *
+ * File layout (host byte order, all blocks 8-byte aligned):
+ * - File header: magic "VSSREC01", byte-order mark, version
+ * - Chunks, each a 64-byte header followed by its records. The header
+ *   holds the record count, payload size, min/max timestamp and a 256-bit
+ *   mask of the signal ids (id % 256) in the chunk, which serves as the
+ *   time and id index for queries.
+ * - Records: 24-byte header (timestamp, id, quality, value type, sizes)
+ *   followed by the value payload. Scalars take 8 bytes, strings and
+ *   numeric arrays are stored raw, string arrays as an offset table plus
+ *   the concatenated characters.
+ *
+ * Struct values are not recorded. Enum values are recorded as strings.
+ * A chunk cut short by a crash is ignored by the reader, so a file is
+ * always readable up to its last complete chunk.
+ */
+
+#pragma once
+
+#include "catalog.hpp"
+#include "quality.hpp"
+#include "update.hpp"
+#include "value.hpp"
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace vss::types {
+
+/**
+ * @brief Writer settings
+ */
+struct RecordingOptions {
+    size_t chunk_bytes = 1 << 20;   ///< Record payload per chunk before it is written out
+};
+
+/**
+ * @brief Writes updates to a recording file in large sequential chunks
+ *
+ * Records are encoded into an in-memory chunk buffer; each full chunk is
+ * written with a single sequential write. flush() writes the pending
+ * partial chunk.
+ *
+ * Example:
+ * @code
+ * RecordingWriter writer;
+ * if (!writer.open("drive.vssrec")) return;
+ * for (const auto& update : updates) {
+ *     writer.write(update);
+ * }
+ * writer.close();
+ * @endcode
+ */
+class RecordingWriter {
+public:
+    explicit RecordingWriter(RecordingOptions options = {});
+    ~RecordingWriter();
+
+    RecordingWriter(const RecordingWriter&) = delete;
+    RecordingWriter& operator=(const RecordingWriter&) = delete;
+
+    /**
+     * @brief Open a file for writing
+     *
+     * @param path File path
+     * @param append Append to an existing recording instead of truncating
+     * When appending, an incomplete chunk at the end of the file (left by
+     * a crash) is truncated away before new chunks are written.
+     *
+     * @return false if the file cannot be opened, or (when appending) is
+     *         not a recording written with the same byte order and version
+     */
+    bool open(const std::string& path, bool append = false);
+
+    /**
+     * @brief Encode one record into the current chunk
+     *
+     * @return false if no file is open, the value is a struct, or writing
+     *         a full chunk failed
+     */
+    bool write(SignalId id, const DynamicQualifiedValue& sample);
+
+    bool write(const SignalUpdate& update) { return write(update.id, update.value); }
+
+    /**
+     * @brief Write the pending chunk and flush the file
+     */
+    bool flush();
+
+    /**
+     * @brief Flush and close the file
+     */
+    bool close();
+
+    bool is_open() const noexcept { return file_ != nullptr; }
+
+    /**
+     * @brief Records in the file, including the pending chunk
+     *
+     * After open() with append, this starts at the number of records in
+     * the complete chunks already in the file.
+     */
+    uint64_t records_written() const noexcept { return records_; }
+
+private:
+    bool write_chunk();
+
+    RecordingOptions options_;
+    std::FILE* file_ = nullptr;
+    std::vector<uint8_t> payload_;
+    uint32_t chunk_records_ = 0;
+    int64_t chunk_min_ = 0;
+    int64_t chunk_max_ = 0;
+    uint64_t chunk_ids_[4] = {};
+    uint64_t records_ = 0;
+};
+
+/**
+ * @brief Zero-copy view of one record inside a mapped recording
+ *
+ * Valid while the RecordingReader it came from stays open.
+ */
+struct RecordView {
+    SignalId id = INVALID_SIGNAL_ID;
+    std::chrono::system_clock::time_point timestamp;
+    SignalQuality quality = SignalQuality::UNKNOWN;
+    ValueType type = ValueType::UNSPECIFIED;    ///< UNSPECIFIED for an empty value
+    const uint8_t* data = nullptr;              ///< Value payload
+    uint32_t size = 0;                          ///< Payload bytes (without padding)
+    uint32_t count = 0;                         ///< Array elements (1 for scalars and strings)
+
+    /**
+     * @brief Scalar value of type T
+     *
+     * @return nullopt if the record does not hold a T scalar
+     */
+    template<typename T>
+    std::optional<T> scalar() const noexcept {
+        if (type != get_value_type<T>() || size != sizeof(T)) {
+            return std::nullopt;
+        }
+        T v;
+        std::memcpy(&v, data, sizeof(T));
+        return v;
+    }
+
+    /**
+     * @brief Whether size and count are consistent with type
+     *
+     * RecordingReader::scan() skips records that are not; the accessors
+     * check their own preconditions and return empty results instead.
+     */
+    bool well_formed() const noexcept;
+
+    /**
+     * @brief Numeric or bool scalar as double
+     */
+    std::optional<double> as_double() const noexcept;
+
+    /**
+     * @brief Characters of a STRING record (empty view otherwise)
+     */
+    std::string_view as_string() const noexcept;
+
+    /**
+     * @brief Elements of a numeric array record, in place
+     *
+     * bool arrays are stored as one byte (0 or 1) per element, so
+     * array<bool>() works for BOOL_ARRAY records.
+     *
+     * @return Pointer to count elements, or nullptr if the element type
+     *         does not match or size is not count elements
+     */
+    template<typename T>
+    const T* array() const noexcept {
+        static_assert(std::is_arithmetic_v<T>, "array() is for numeric elements");
+        constexpr size_t element = std::is_same_v<T, bool> ? 1 : sizeof(T);
+        return type == get_value_type<std::vector<T>>() && size == static_cast<uint64_t>(count) * element
+            ? reinterpret_cast<const T*>(data) : nullptr;
+    }
+
+    /**
+     * @brief Element i of a STRING_ARRAY record (empty view if out of range)
+     */
+    std::string_view string_at(size_t i) const noexcept;
+
+    /**
+     * @brief Decode into an owning Value (copies)
+     */
+    Value to_value() const;
+
+    /**
+     * @brief Decode into an owning DynamicQualifiedValue (copies)
+     */
+    DynamicQualifiedValue to_qualified() const {
+        return DynamicQualifiedValue{to_value(), quality, timestamp};
+    }
+};
+
+/**
+ * @brief Time range and signal filter for reading a recording
+ */
+struct RecordQuery {
+    std::chrono::system_clock::time_point begin = std::chrono::system_clock::time_point::min();  ///< Inclusive
+    std::chrono::system_clock::time_point end = std::chrono::system_clock::time_point::max();    ///< Exclusive
+    const SignalSet* signals = nullptr;     ///< nullptr = all signals
+};
+
+/**
+ * @brief Index entry of one chunk
+ */
+struct ChunkInfo {
+    uint64_t offset = 0;        ///< Of the chunk header in the file
+    uint64_t payload_bytes = 0; ///< Record bytes following the header
+    uint32_t records = 0;
+    std::chrono::system_clock::time_point min_time;
+    std::chrono::system_clock::time_point max_time;
+};
+
+/**
+ * @brief Reads a recording through a memory mapping
+ *
+ * open() maps the file (on POSIX systems; elsewhere it is read into
+ * memory) and walks the chunk headers to build the index. Queries skip
+ * chunks whose time range or id mask cannot match and hand out
+ * RecordView objects pointing into the mapping.
+ *
+ * Records come back in file order, which is write order.
+ *
+ * Example:
+ * @code
+ * RecordingReader reader;
+ * reader.open("drive.vssrec");
+ *
+ * RecordQuery query;
+ * query.begin = incident - std::chrono::seconds(5);
+ * query.end = incident;
+ * query.signals = &brake_signals;
+ * reader.scan(query, [](const RecordView& r) {
+ *     std::cout << r.id << " " << r.as_double().value_or(NAN) << "\n";
+ * });
+ * @endcode
+ */
+class RecordingReader {
+public:
+    RecordingReader() = default;
+    ~RecordingReader();
+
+    RecordingReader(const RecordingReader&) = delete;
+    RecordingReader& operator=(const RecordingReader&) = delete;
+
+    /**
+     * @brief Map a recording and build the chunk index
+     *
+     * @return false if the file cannot be read or is not a recording
+     */
+    bool open(const std::string& path);
+
+    void close() noexcept;
+
+    bool is_open() const noexcept { return data_ != nullptr; }
+
+    /**
+     * @brief Visit all records matching a query
+     *
+     * @return Number of records visited
+     */
+    size_t scan(const RecordQuery& query, const std::function<void(const RecordView&)>& visit) const;
+
+    /**
+     * @brief Decode all records matching a query
+     */
+    std::vector<SignalUpdate> read(const RecordQuery& query = {}) const;
+
+    const std::vector<ChunkInfo>& chunks() const noexcept { return chunks_; }
+
+    /**
+     * @brief Total records in all complete chunks
+     */
+    uint64_t record_count() const noexcept;
+
+private:
+    const uint8_t* data_ = nullptr;
+    size_t size_ = 0;
+    bool mapped_ = false;
+    std::vector<uint8_t> buffer_;               ///< Used where mmap is not available
+    std::vector<ChunkInfo> chunks_;
+    std::vector<std::array<uint64_t, 4>> chunk_ids_;
+};
+
+} // namespace vss::types
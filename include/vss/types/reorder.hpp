@@ -0,0 +1,128 @@
+/**
+ * @file reorder.hpp
+ * @brief Watermark-based reordering of jittered signal updates
+ */
+
+#pragma once
+
+#include "update.hpp"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace vss::types {
+
+/**
+ * @brief Restores timestamp order of updates arriving out of order
+ *
+ * The watermark trails the newest timestamp seen by `max_delay` (and can
+ * be advanced explicitly for idle inputs). Updates are held until the
+ * watermark passes their timestamp and are then released in timestamp
+ * order (arrival order for equal timestamps) through the release handler.
+ *
+ * An update older than what has already been released is late: it is
+ * passed to the late handler if one is set, otherwise dropped, and counted
+ * either way.
+ *
+ * Storage is fixed at construction: slots for `capacity` updates plus an
+ * index heap. When the buffer is full, the oldest update is released
+ * early (counted in forced_releases()) to make room, so pushes never
+ * allocate.
+ *
+ * Example:
+ * @code
+ * ReorderBuffer reorder(std::chrono::milliseconds(50));
+ * reorder.set_release_handler([&](SignalUpdate&& u) { aggregator.add(u.value); });
+ * reorder.set_late_handler([&](SignalUpdate&& u) { late_log.push_back(std::move(u)); });
+ *
+ * for (auto& update : gateway_updates) {
+ *     reorder.push(std::move(update));
+ * }
+ * reorder.flush();
+ * @endcode
+ */
+class ReorderBuffer {
+public:
+    using Handler = std::function<void(SignalUpdate&&)>;
+
+    /**
+     * @param max_delay Maximum expected lateness (watermark = newest timestamp - max_delay)
+     * @param capacity Maximum number of buffered updates (at least 1)
+     */
+    explicit ReorderBuffer(std::chrono::nanoseconds max_delay, size_t capacity = 4096);
+
+    /**
+     * @brief Set the function receiving updates in timestamp order
+     */
+    void set_release_handler(Handler handler) { release_ = std::move(handler); }
+
+    /**
+     * @brief Set the function receiving late updates (dropped if unset)
+     */
+    void set_late_handler(Handler handler) { late_ = std::move(handler); }
+
+    /**
+     * @brief Add an update and release everything the watermark has passed
+     *
+     * @return false if the update was late
+     */
+    bool push(SignalUpdate update);
+
+    /**
+     * @brief Move the watermark forward without a new update
+     *
+     * For inputs that went quiet; a watermark behind the current one is ignored.
+     */
+    void advance_watermark(std::chrono::system_clock::time_point watermark);
+
+    /**
+     * @brief Release all buffered updates, e.g. at end of stream
+     */
+    void flush();
+
+    /**
+     * @brief Current watermark (time_point::min() before the first update)
+     */
+    std::chrono::system_clock::time_point watermark() const noexcept;
+
+    size_t size() const noexcept { return heap_.size(); }
+    size_t capacity() const noexcept { return slots_.size(); }
+
+    uint64_t released() const noexcept { return released_count_; }
+    uint64_t late_updates() const noexcept { return late_count_; }
+    uint64_t forced_releases() const noexcept { return forced_count_; }
+
+private:
+    struct Entry {
+        int64_t key;        ///< Timestamp (ns)
+        uint64_t sequence;  ///< Arrival order, breaks ties
+        uint32_t slot;
+    };
+
+    struct Later {
+        bool operator()(const Entry& a, const Entry& b) const noexcept {
+            return a.key != b.key ? a.key > b.key : a.sequence > b.sequence;
+        }
+    };
+
+    void release_top();
+    void release_ready();
+
+    int64_t max_delay_;
+    std::vector<SignalUpdate> slots_;
+    std::vector<uint32_t> free_;    ///< Stack of unused slots
+    std::vector<Entry> heap_;       ///< Min-heap by (key, sequence)
+    uint64_t sequence_ = 0;
+    int64_t newest_;                ///< Newest timestamp seen
+    int64_t watermark_;
+    int64_t frontier_;              ///< Timestamp of the last released update
+    uint64_t released_count_ = 0;
+    uint64_t late_count_ = 0;
+    uint64_t forced_count_ = 0;
+    Handler release_;
+    Handler late_;
+};
+
+} // namespace vss::types
@@ -0,0 +1,133 @@
+/**
+ * @file replay.hpp
+ * @brief Deterministic, optionally accelerated replay of recorded updates
+ */
+
+#pragma once
+
+#include "clock.hpp"
+#include "recording.hpp"
+#include "update.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace vss::types {
+
+/**
+ * @brief Replay settings
+ */
+struct ReplayOptions {
+    double speed = 1.0;         ///< Recorded time per wall time (2 = twice as fast); 0 = unthrottled
+    size_t batch_size = 256;    ///< Maximum updates per consumer call
+    /// Wall-clock granularity of throttled replay: updates due within one interval share a batch
+    std::chrono::nanoseconds resolution{std::chrono::milliseconds(1)};
+    bool drive_clock = true;    ///< Install the replay clock as vss::types::now() while running
+};
+
+/**
+ * @brief Outcome of a replay run
+ */
+struct ReplayStats {
+    uint64_t events = 0;
+    uint64_t batches = 0;
+    std::chrono::nanoseconds recorded_span{0};  ///< Last minus first replayed timestamp
+    std::chrono::nanoseconds wall_time{0};
+    bool stopped = false;                       ///< Ended by stop() rather than end of input
+
+    /**
+     * @brief Achieved replay rate
+     */
+    double events_per_second() const noexcept {
+        return wall_time.count() > 0 ? static_cast<double>(events) * 1e9 / static_cast<double>(wall_time.count()) : 0.0;
+    }
+};
+
+/**
+ * @brief Pushes recorded updates into consumers in batches
+ *
+ * Replay time follows the recorded timestamps: while a batch is being
+ * consumed, the engine's clock reads the timestamp of the newest update
+ * delivered so far (it never moves backwards). With drive_clock set, that
+ * clock is installed process-wide, so values created by consumers get
+ * recording timestamps and runs are reproducible.
+ *
+ * With a speed > 0, batches are released when the wall clock reaches
+ * their recorded offset divided by speed; updates due in different
+ * `resolution` intervals are never put in the same batch. With speed 0 the input is
+ * replayed as fast as consumers take it.
+ *
+ * Example:
+ * @code
+ * RecordingReader reader;
+ * reader.open("drive.vssrec");
+ *
+ * ReplayOptions options;
+ * options.speed = 0;   // as fast as possible
+ * ReplayEngine replay(options);
+ * replay.add_consumer([&](const std::vector<SignalUpdate>& batch) { rules.evaluate(batch); });
+ * ReplayStats stats = replay.run(reader);
+ * std::cout << stats.events_per_second() << " events/s\n";
+ * @endcode
+ */
+class ReplayEngine {
+public:
+    using Consumer = std::function<void(const std::vector<SignalUpdate>&)>;
+
+    explicit ReplayEngine(ReplayOptions options = {});
+
+    /**
+     * @brief Add a consumer; every consumer sees every batch, in order of registration
+     */
+    void add_consumer(Consumer consumer) { consumers_.push_back(std::move(consumer)); }
+
+    /**
+     * @brief Replay all updates of a source
+     */
+    ReplayStats run(UpdateSource& source);
+
+    /**
+     * @brief Replay the records of a recording matching a query
+     */
+    ReplayStats run(const RecordingReader& reader, const RecordQuery& query = {});
+
+    /**
+     * @brief Ask a running replay to end after the current batch
+     *
+     * May be called from a consumer or another thread. A stop() made while
+     * no replay is running ends the next run() before its first update.
+     * The request is cleared when a run finishes.
+     */
+    void stop() noexcept { stop_.store(true, std::memory_order_relaxed); }
+
+    /**
+     * @brief Replay clock (current replay time)
+     */
+    const ManualClock& clock() const noexcept { return clock_; }
+
+    const ReplayOptions& options() const noexcept { return options_; }
+
+private:
+    void begin();
+    bool feed(SignalUpdate&& update);
+    void dispatch();
+    ReplayStats finish();
+
+    ReplayOptions options_;
+    std::vector<Consumer> consumers_;
+    ManualClock clock_;
+    std::atomic<bool> stop_{false};
+
+    // State of the current run
+    std::vector<SignalUpdate> batch_;
+    ReplayStats stats_;
+    std::chrono::steady_clock::time_point wall_start_;
+    int64_t first_ns_ = 0;
+    int64_t newest_ns_ = 0;
+    int64_t batch_due_ns_ = 0;      ///< Wall offset at which the pending batch is due
+};
+
+} // namespace vss::types
@@ -0,0 +1,105 @@
+/**
+ * @file resample.hpp
+ * @brief Alignment of several signals onto a common fixed-period time grid
+ *
+ * Produces a columnar table (one column per signal, one row per grid
+ * point) for correlation and feature extraction. Each signal is swept
+ * once, so the cost is linear in samples plus grid points.
+ */
+
+#pragma once
+
+#include "quality.hpp"
+#include "series.hpp"
+#include <chrono>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace vss::types {
+
+/**
+ * @brief How values between samples are reconstructed
+ */
+enum class InterpolationMode {
+    ZERO_ORDER_HOLD = 0,    ///< Last sample at or before the grid point
+    LINEAR = 1              ///< Straight line between the surrounding samples
+};
+
+/**
+ * @brief Convert InterpolationMode to string
+ */
+const char* interpolation_mode_to_string(InterpolationMode mode);
+
+/**
+ * @brief Parse InterpolationMode from string
+ *
+ * @param str String representation (case-insensitive)
+ * @return InterpolationMode if recognized, std::nullopt otherwise
+ */
+std::optional<InterpolationMode> interpolation_mode_from_string(const std::string& str);
+
+/**
+ * @brief Grid and reconstruction settings
+ *
+ * The grid is start, start + period, ... up to but excluding end.
+ */
+struct ResampleSpec {
+    std::chrono::system_clock::time_point start;
+    std::chrono::system_clock::time_point end;
+    std::chrono::nanoseconds period{std::chrono::milliseconds(100)};
+    InterpolationMode mode = InterpolationMode::ZERO_ORDER_HOLD;
+    /// Grid points further than this from the last sample are NOT_AVAILABLE
+    std::optional<std::chrono::nanoseconds> max_staleness;
+};
+
+/**
+ * @brief Signals aligned on a common grid, stored column by column
+ *
+ * Only VALID cells carry a value; all other cells hold NaN and the reason
+ * as quality (NOT_AVAILABLE for no data or stale data, otherwise the
+ * quality of the held sample).
+ */
+struct ResampledTable {
+    std::vector<std::chrono::system_clock::time_point> timestamps;  ///< Grid points (rows)
+    std::vector<double> values;             ///< Column c at [c * rows(), (c + 1) * rows())
+    std::vector<SignalQuality> qualities;   ///< Same layout as values
+    size_t columns = 0;
+
+    size_t rows() const noexcept { return timestamps.size(); }
+
+    double value(size_t row, size_t column) const noexcept { return values[column * rows() + row]; }
+    SignalQuality quality(size_t row, size_t column) const noexcept { return qualities[column * rows() + row]; }
+
+    /**
+     * @brief One signal as a series view over the grid timestamps
+     */
+    SeriesView column(size_t column) const noexcept {
+        return SeriesView{timestamps.data(), values.data() + column * rows(),
+                          qualities.data() + column * rows(), rows()};
+    }
+};
+
+/**
+ * @brief Resample columnar histories onto a grid
+ *
+ * @param inputs One view per signal, each in timestamp order
+ * @param spec Grid and reconstruction settings
+ * @return Table with inputs.size() columns (no rows if the grid is empty
+ *         or the period is not positive)
+ */
+ResampledTable resample(const std::vector<SeriesView>& inputs, const ResampleSpec& spec);
+
+/**
+ * @brief Resample dynamic histories onto a grid
+ *
+ * Empty values count as missing data; non-numeric values as INVALID.
+ *
+ * @param histories One history per signal, each in timestamp order
+ * @param spec Grid and reconstruction settings
+ */
+ResampledTable resample(const std::vector<std::vector<DynamicQualifiedValue>>& histories,
+                        const ResampleSpec& spec);
+
+} // namespace vss::types
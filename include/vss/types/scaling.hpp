@@ -0,0 +1,103 @@
+/**
+ * @file scaling.hpp
+ * @brief Batch linear scaling from raw integers to physical values
+ *
+ * Converts spans of raw integer payload values into physical FLOAT/DOUBLE
+ * values with `factor * raw + offset`, checking each result against the
+ * signal's min/max range in the same pass.
+ *
+ * With AVX2/FMA available at compile time (e.g. VSS_TYPES_NATIVE_ARCH=ON),
+ * the scale-and-check step uses fused multiply-add intrinsics; otherwise a
+ * portable loop is used. Results are identical apart from FMA rounding.
+ */
+
+#pragma once
+
+#include "quality.hpp"
+#include "value.hpp"
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace vss::types {
+
+/**
+ * @brief Linear scaling and physical range of a signal
+ */
+struct ScalingParams {
+    double factor = 1.0;            ///< physical = factor * raw + offset
+    double offset = 0.0;
+    std::optional<double> min;      ///< Lowest valid physical value (inclusive)
+    std::optional<double> max;      ///< Highest valid physical value (inclusive)
+};
+
+/**
+ * @brief Scale raw integers into a physical value array
+ *
+ * Supported raw types: int8..int64, uint8..uint64. Supported output types:
+ * float, double. Out-of-range samples are still written; their quality is
+ * INVALID, all others VALID (NaN results are always INVALID). For float
+ * output, results beyond float's range are out of range too and are
+ * written as +/-infinity.
+ *
+ * @param raw Raw values
+ * @param count Number of values
+ * @param params Factor, offset and range
+ * @param out Output array of count elements
+ * @param quality Output quality array of count elements, or nullptr
+ * @return Number of out-of-range samples
+ */
+template<typename Raw, typename Out>
+size_t scale_linear(
+    const Raw* raw,
+    size_t count,
+    const ScalingParams& params,
+    Out* out,
+    SignalQuality* quality);
+
+/**
+ * @brief Scale a raw integer array Value into a FLOAT_ARRAY or DOUBLE_ARRAY
+ *
+ * Produces the target array directly, without a convert_value_type pass.
+ *
+ * @param raw Value holding an integer array (INT8_ARRAY .. UINT64_ARRAY)
+ * @param params Factor, offset and range
+ * @param target_type FLOAT_ARRAY or DOUBLE_ARRAY
+ * @param out_of_range If not null, receives the number of out-of-range samples
+ * @return Scaled array, or empty Value if raw is not an integer array or
+ *         target_type is not a floating point array
+ */
+Value scale_array(
+    const Value& raw,
+    const ScalingParams& params,
+    ValueType target_type,
+    size_t* out_of_range = nullptr);
+
+/**
+ * @brief Scale raw integers into DynamicQualifiedValue slots
+ *
+ * slots[i] receives the scaled sample i as FLOAT or DOUBLE with VALID
+ * quality, or an empty value with INVALID quality if it is out of range
+ * (for FLOAT, also if float cannot hold it).
+ * Slots that already hold the target type are updated in place.
+ *
+ * @param raw Raw values
+ * @param count Number of values (and slots)
+ * @param params Factor, offset and range
+ * @param target_type FLOAT or DOUBLE
+ * @param slots Output slots, at least count elements
+ * @param timestamp Timestamp written into every slot
+ * @return Number of out-of-range samples, or count (slots untouched) if
+ *         target_type is unsupported
+ */
+template<typename Raw>
+size_t scale_into_slots(
+    const Raw* raw,
+    size_t count,
+    const ScalingParams& params,
+    ValueType target_type,
+    DynamicQualifiedValue* slots,
+    std::chrono::system_clock::time_point timestamp);
+
+} // namespace vss::types
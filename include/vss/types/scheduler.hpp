@@ -0,0 +1,144 @@
+/**
+ * @file scheduler.hpp
+ * @brief Priority-aware scheduling of signal updates
+ */
+
+#pragma once
+
+#include "catalog.hpp"
+#include "queue.hpp"
+#include "update.hpp"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace vss::types {
+
+/**
+ * @brief Queue sizes and dispatch weights of an UpdateScheduler
+ */
+struct SchedulerOptions {
+    size_t queue_capacity = 4096;   ///< Per priority class (rounded up to a power of two)
+
+    /**
+     * Updates taken from each class per dispatch round, indexed by
+     * PriorityClass (0 is treated as 1)
+     */
+    std::array<uint32_t, PRIORITY_CLASS_COUNT> weights{{16, 8, 4, 1}};
+};
+
+/**
+ * @brief Counters of one priority class
+ */
+struct PriorityStats {
+    uint64_t submitted = 0;
+    uint64_t dispatched = 0;
+    uint64_t dropped = 0;                       ///< Rejected because the class queue was full
+    uint64_t deadline_misses = 0;               ///< Dispatched later than the signal's latency budget
+    std::chrono::nanoseconds max_latency{0};    ///< Largest timestamp-to-dispatch time
+};
+
+/**
+ * @brief Scheduler stage that serves safety-relevant signals first
+ *
+ * Each update is queued by the PriorityClass of its signal (taken from
+ * the catalog when the scheduler is created; unknown ids are NORMAL) in
+ * a lock-free MPMC queue per class. dispatch() serves the classes by
+ * weighted round robin: per round up to weights[c] updates of class c,
+ * so a burst of LOW updates delays a CRITICAL one by at most one round
+ * and lower classes still make progress under a steady CRITICAL load.
+ * A full class queue rejects updates of that class only.
+ *
+ * Latency is measured at dispatch as vss::types::now() minus the
+ * sample's timestamp, and counted as a deadline miss when it exceeds the
+ * signal's latency_budget.
+ *
+ * submit() is thread-safe; dispatch() must be called from one thread at
+ * a time.
+ *
+ * Example:
+ * @code
+ * catalog.set_priority(brake_id, PriorityClass::CRITICAL, std::chrono::milliseconds(5));
+ * UpdateScheduler scheduler(catalog);
+ *
+ * scheduler.submit(SignalUpdate{brake_id, sample});   // any thread
+ *
+ * std::vector<SignalUpdate> batch;
+ * scheduler.dispatch(batch, 256);                     // consumer thread
+ * auto misses = scheduler.stats(PriorityClass::CRITICAL).deadline_misses;
+ * @endcode
+ */
+class UpdateScheduler {
+public:
+    explicit UpdateScheduler(const SignalCatalog& catalog, SchedulerOptions options = {});
+
+    UpdateScheduler(const UpdateScheduler&) = delete;
+    UpdateScheduler& operator=(const UpdateScheduler&) = delete;
+
+    /**
+     * @brief Queue an update in its signal's class
+     *
+     * @return false if that class queue is full (the update is dropped)
+     */
+    bool submit(SignalUpdate update);
+
+    /**
+     * @brief Take up to max_count updates by weighted round robin
+     *
+     * @param out Receives the updates (appended)
+     * @return Number of updates appended
+     */
+    size_t dispatch(std::vector<SignalUpdate>& out, size_t max_count);
+
+    /**
+     * @brief Updates waiting in all classes (approximate under concurrency)
+     */
+    size_t pending() const noexcept;
+
+    /**
+     * @brief Updates waiting in one class
+     */
+    size_t pending(PriorityClass priority) const noexcept;
+
+    /**
+     * @brief Counters of one class
+     */
+    PriorityStats stats(PriorityClass priority) const noexcept;
+
+    /**
+     * @brief Reset all counters
+     */
+    void reset_stats() noexcept;
+
+    /**
+     * @brief Class an update of this signal is queued in
+     */
+    PriorityClass priority(SignalId id) const noexcept {
+        return id < classes_.size() ? static_cast<PriorityClass>(classes_[id]) : PriorityClass::NORMAL;
+    }
+
+    const SchedulerOptions& options() const noexcept { return options_; }
+
+private:
+    struct alignas(64) Counters {
+        std::atomic<uint64_t> submitted{0};
+        std::atomic<uint64_t> dispatched{0};
+        std::atomic<uint64_t> dropped{0};
+        std::atomic<uint64_t> deadline_misses{0};
+        std::atomic<int64_t> max_latency_ns{0};
+    };
+
+    SchedulerOptions options_;
+    std::vector<uint8_t> classes_;          ///< Per signal
+    std::vector<int64_t> budgets_ns_;       ///< Per signal, 0 = none
+    std::array<std::unique_ptr<MpmcQueue<SignalUpdate>>, PRIORITY_CLASS_COUNT> queues_;
+    std::array<Counters, PRIORITY_CLASS_COUNT> counters_;
+    size_t cursor_ = 0;                     ///< Class served next
+    uint32_t credit_ = 0;                   ///< Updates left for cursor_ in this round
+};
+
+} // namespace vss::types
@@ -0,0 +1,133 @@
+/**
+ * @file series.hpp
+ * @brief Columnar history of a numeric signal
+ *
+ * Stores timestamps, values and qualities in separate arrays so batch
+ * algorithms (statistics, downsampling, resampling) can run tight loops
+ * over one column at a time.
+ */
+
+#pragma once
+
+#include "quality.hpp"
+#include "value.hpp"
+#include <chrono>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace vss::types {
+
+/**
+ * @brief Non-owning columnar view of numeric samples
+ *
+ * Samples are expected in non-decreasing timestamp order.
+ */
+struct SeriesView {
+    const std::chrono::system_clock::time_point* timestamps = nullptr;
+    const double* values = nullptr;
+    const SignalQuality* qualities = nullptr;   ///< nullptr means every sample is VALID
+    size_t size = 0;
+
+    /**
+     * @brief Quality of sample i
+     */
+    SignalQuality quality(size_t i) const noexcept {
+        return qualities ? qualities[i] : SignalQuality::VALID;
+    }
+
+    /**
+     * @brief Samples [offset, offset + count), clamped to the view
+     */
+    SeriesView subview(size_t offset, size_t count) const noexcept;
+};
+
+/**
+ * @brief Owning columnar buffer of numeric samples
+ *
+ * Example:
+ * @code
+ * SignalSeries speed;
+ * speed.append(QualifiedValue<float>{120.5f, SignalQuality::VALID, ts});
+ * speed.append(sample);  // DynamicQualifiedValue
+ *
+ * WindowAggregator agg{WindowSpec::tumbling(std::chrono::seconds(1))};
+ * agg.add_batch(speed.view());
+ * @endcode
+ */
+class SignalSeries {
+public:
+    /**
+     * @brief Append a sample
+     */
+    void append(std::chrono::system_clock::time_point timestamp, double value,
+                SignalQuality quality = SignalQuality::VALID) {
+        timestamps_.push_back(timestamp);
+        values_.push_back(value);
+        qualities_.push_back(quality);
+    }
+
+    /**
+     * @brief Append a typed sample
+     *
+     * A missing value is stored as NaN with the sample's quality (or
+     * NOT_AVAILABLE if the quality claims VALID).
+     */
+    template<typename T>
+    void append(const QualifiedValue<T>& sample) {
+        static_assert(std::is_arithmetic_v<T>, "SignalSeries holds numeric samples");
+        if (sample.value.has_value()) {
+            append(sample.timestamp, static_cast<double>(*sample.value), sample.quality);
+        } else {
+            append_missing(sample.timestamp, sample.quality);
+        }
+    }
+
+    /**
+     * @brief Append a dynamic sample
+     *
+     * @return false (nothing appended) if the value is neither empty nor
+     *         a numeric or bool scalar
+     */
+    bool append(const DynamicQualifiedValue& sample);
+
+    /**
+     * @brief Reserve capacity in all columns
+     */
+    void reserve(size_t count);
+
+    /**
+     * @brief Remove all samples
+     */
+    void clear() noexcept;
+
+    /**
+     * @brief Remove the oldest samples
+     *
+     * @param count Number of samples to drop from the front
+     */
+    void erase_front(size_t count);
+
+    size_t size() const noexcept { return values_.size(); }
+    bool empty() const noexcept { return values_.empty(); }
+
+    const std::vector<std::chrono::system_clock::time_point>& timestamps() const noexcept { return timestamps_; }
+    const std::vector<double>& values() const noexcept { return values_; }
+    const std::vector<SignalQuality>& qualities() const noexcept { return qualities_; }
+
+    /**
+     * @brief View of all samples
+     */
+    SeriesView view() const noexcept {
+        return SeriesView{timestamps_.data(), values_.data(), qualities_.data(), values_.size()};
+    }
+
+private:
+    void append_missing(std::chrono::system_clock::time_point timestamp, SignalQuality quality);
+
+    std::vector<std::chrono::system_clock::time_point> timestamps_;
+    std::vector<double> values_;
+    std::vector<SignalQuality> qualities_;
+};
+
+} // namespace vss::types
@@ -0,0 +1,297 @@
+/**
+ * @file stats.hpp
+ * @brief Streaming statistics over time windows of a signal
+ *
+ * Incremental min/max/mean/standard deviation (Welford) and percentiles
+ * (fixed-memory quantile sketch) for tumbling and sliding windows.
+ * Only VALID samples contribute; all others are counted as excluded.
+ */
+
+#pragma once
+
+#include "quality.hpp"
+#include "series.hpp"
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <vector>
+
+namespace vss::types {
+
+/**
+ * @brief Running count, mean, variance, min and max
+ *
+ * Uses Welford's update for single samples and Chan's formula to merge
+ * partial results, so batches can be reduced independently and combined.
+ */
+struct RunningStats {
+    size_t count = 0;
+    double mean = 0.0;
+    double m2 = 0.0;        ///< Sum of squared deviations from the mean
+    double min = 0.0;       ///< Valid only if count > 0
+    double max = 0.0;       ///< Valid only if count > 0
+
+    /**
+     * @brief Add one sample
+     */
+    void add(double x) noexcept;
+
+    /**
+     * @brief Combine with another partial result
+     */
+    void merge(const RunningStats& other) noexcept;
+
+    /**
+     * @brief Population variance (0 if count < 1)
+     */
+    double variance() const noexcept { return count > 0 ? m2 / static_cast<double>(count) : 0.0; }
+
+    /**
+     * @brief Sample variance (0 if count < 2)
+     */
+    double sample_variance() const noexcept {
+        return count > 1 ? m2 / static_cast<double>(count - 1) : 0.0;
+    }
+
+    /**
+     * @brief Population standard deviation
+     */
+    double stddev() const noexcept;
+
+    void clear() noexcept { *this = RunningStats{}; }
+};
+
+/**
+ * @brief Mergeable quantile sketch with fixed memory
+ *
+ * Values are counted in logarithmically sized buckets (DDSketch style):
+ * any quantile is returned with a relative error of at most
+ * relative_accuracy, as long as the data fits into max_buckets buckets per
+ * sign. Beyond that, the buckets closest to zero are collapsed, which only
+ * costs accuracy for the smallest magnitudes.
+ */
+class QuantileSketch {
+public:
+    /**
+     * @param relative_accuracy Relative error bound, in (0, 1)
+     * @param max_buckets Buckets per sign (memory is 2 * max_buckets counters)
+     */
+    explicit QuantileSketch(double relative_accuracy = 0.01, size_t max_buckets = 1024);
+
+    /**
+     * @brief Add a sample (NaN is ignored)
+     */
+    void add(double x);
+
+    /**
+     * @brief Merge another sketch
+     *
+     * @return false if the sketches use different accuracy or bucket counts
+     */
+    bool merge(const QuantileSketch& other);
+
+    /**
+     * @brief Estimate a quantile
+     *
+     * @param q Quantile in [0, 1] (0.5 = median, 0.99 = p99)
+     * @return Estimate, or nullopt if the sketch is empty or q is out of range
+     */
+    std::optional<double> quantile(double q) const;
+
+    /**
+     * @brief Number of samples added
+     */
+    uint64_t count() const noexcept { return count_; }
+
+    double relative_accuracy() const noexcept { return relative_accuracy_; }
+
+    void clear() noexcept;
+
+private:
+    /**
+     * @brief Fixed-size window of bucket counters, collapsing the lowest keys
+     */
+    struct Store {
+        std::vector<uint64_t> bins;
+        int32_t offset = 0;     ///< Key of bins[0]
+        uint64_t total = 0;
+        size_t first = 0;       ///< Lowest occupied bin (if total > 0)
+        size_t last = 0;        ///< Highest occupied bin (if total > 0)
+
+        void add(int32_t key, uint64_t n);
+        void clear() noexcept;
+    };
+
+    int32_t key(double magnitude) const;
+    double value(int32_t key) const;
+
+    double relative_accuracy_;
+    double gamma_;
+    double log_gamma_;
+    size_t max_buckets_;
+    Store positive_;
+    Store negative_;
+    uint64_t zero_count_ = 0;
+    uint64_t count_ = 0;
+    double min_ = 0.0;
+    double max_ = 0.0;
+};
+
+/**
+ * @brief Window width, slide and requested percentiles
+ *
+ * Windows are aligned to the epoch: a tumbling window of 1s covers
+ * [k s, (k+1) s). Sliding windows of `width` advance by `slide`; width
+ * must be a multiple of slide.
+ */
+struct WindowSpec {
+    std::chrono::nanoseconds width{std::chrono::seconds(1)};
+    std::chrono::nanoseconds slide{std::chrono::seconds(1)};
+    std::vector<double> percentiles;    ///< Quantiles to report, e.g. {0.5, 0.95, 0.99}
+    double relative_accuracy = 0.01;    ///< Of the percentile sketch
+    size_t max_buckets = 1024;          ///< Of the percentile sketch
+
+    static WindowSpec tumbling(std::chrono::nanoseconds width, std::vector<double> percentiles = {}) {
+        WindowSpec spec;
+        spec.width = width;
+        spec.slide = width;
+        spec.percentiles = std::move(percentiles);
+        return spec;
+    }
+
+    static WindowSpec sliding(std::chrono::nanoseconds width, std::chrono::nanoseconds slide,
+                              std::vector<double> percentiles = {}) {
+        WindowSpec spec;
+        spec.width = width;
+        spec.slide = slide;
+        spec.percentiles = std::move(percentiles);
+        return spec;
+    }
+};
+
+/**
+ * @brief Statistics of one closed window
+ */
+struct WindowResult {
+    std::chrono::system_clock::time_point start;    ///< Inclusive
+    std::chrono::system_clock::time_point end;      ///< Exclusive
+    RunningStats stats;                             ///< Over VALID samples
+    size_t excluded = 0;                            ///< Non-VALID (or NaN) samples
+    std::vector<double> percentiles;                ///< Same order as WindowSpec::percentiles
+                                                    ///< (NaN if the window has no VALID samples)
+};
+
+/**
+ * @brief Incremental tumbling/sliding window aggregator
+ *
+ * Time is split into panes of `slide`; each pane keeps RunningStats and a
+ * QuantileSketch, and a window is the merge of width/slide consecutive
+ * panes. Memory is therefore fixed, independent of the sample rate.
+ *
+ * A window is reported through the callback as soon as a sample at or
+ * after its end arrives (or on flush()). Windows without any sample are
+ * not reported. Samples older than the current pane are dropped and
+ * counted in late_samples().
+ *
+ * Example:
+ * @code
+ * WindowAggregator agg{WindowSpec::sliding(std::chrono::seconds(10),
+ *                                           std::chrono::seconds(1), {0.5, 0.99})};
+ * agg.set_callback([](const WindowResult& w) {
+ *     std::cout << w.stats.mean << " p99=" << w.percentiles[1] << "\n";
+ * });
+ *
+ * agg.add(QualifiedValue<float>{speed, SignalQuality::VALID, ts});
+ * agg.add_batch(history.view());   // columnar fast path
+ * agg.flush();
+ * @endcode
+ */
+class WindowAggregator {
+public:
+    using Callback = std::function<void(const WindowResult&)>;
+
+    /**
+     * @param spec Window definition; a non-positive slide or a width that
+     *             is not a multiple of slide is replaced by a tumbling
+     *             window of `width` (1s if width is not positive either)
+     */
+    explicit WindowAggregator(WindowSpec spec);
+
+    /**
+     * @brief Set the function receiving closed windows
+     */
+    void set_callback(Callback callback) { callback_ = std::move(callback); }
+
+    /**
+     * @brief Add one sample
+     */
+    void add(std::chrono::system_clock::time_point timestamp, double value, SignalQuality quality);
+
+    /**
+     * @brief Add a typed sample (missing values count as excluded)
+     */
+    template<typename T>
+    void add(const QualifiedValue<T>& sample) {
+        static_assert(std::is_arithmetic_v<T>, "WindowAggregator needs numeric samples");
+        if (sample.value.has_value()) {
+            add(sample.timestamp, static_cast<double>(*sample.value), sample.quality);
+        } else {
+            add(sample.timestamp, 0.0, SignalQuality::NOT_AVAILABLE);
+        }
+    }
+
+    /**
+     * @brief Add a dynamic sample (empty or non-numeric values count as excluded)
+     */
+    void add(const DynamicQualifiedValue& sample);
+
+    /**
+     * @brief Add a batch of samples in timestamp order
+     *
+     * Runs of samples falling into the same pane are reduced with
+     * branch-free loops over the value column before being merged.
+     */
+    void add_batch(const SeriesView& samples);
+
+    /**
+     * @brief Report all windows that still contain samples and reset
+     */
+    void flush();
+
+    /**
+     * @brief Samples dropped because they were older than the current pane
+     */
+    size_t late_samples() const noexcept { return late_; }
+
+    const WindowSpec& spec() const noexcept { return spec_; }
+
+private:
+    struct Pane {
+        RunningStats stats;
+        QuantileSketch sketch;
+        size_t excluded = 0;
+
+        bool empty() const noexcept { return stats.count == 0 && excluded == 0; }
+    };
+
+    Pane& current() noexcept { return panes_[head_]; }
+    void start(int64_t t);
+    void advance_to(int64_t t);
+    void close_pane();
+    void emit(int64_t window_end);
+    void add_run(const double* values, const SignalQuality* qualities, size_t count);
+
+    WindowSpec spec_;
+    int64_t slide_ns_;
+    std::vector<Pane> panes_;       ///< Ring buffer, head_ is the current pane
+    size_t head_ = 0;
+    int64_t pane_start_ = 0;        ///< Nanoseconds since epoch
+    bool started_ = false;
+    size_t late_ = 0;
+    Callback callback_;
+    WindowResult result_;           ///< Reused between windows
+    QuantileSketch merged_;         ///< Reused between windows
+};
+
+} // namespace vss::types
@@ -13,11 +13,17 @@
 #pragma once
 
 #include "value.hpp"
+#include "constraints.hpp"
 #include <string>
+#include <string_view>
 #include <map>
 #include <vector>
 #include <optional>
 #include <memory>
+#include <functional>
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
 
 namespace vss::types {
 
@@ -31,6 +37,7 @@ struct FieldDefinition {
     ValueType type;             ///< Field value type
     std::string description;    ///< Human-readable description
     std::optional<Value> default_value;  ///< Default value if not specified
+    ValueConstraints constraints;  ///< VSS min/max/allowed restrictions
 
     // For nested structs
     std::string struct_type_name;  ///< If type is STRUCT, the struct type name
@@ -146,9 +153,21 @@ private:
  * delivery.set_field("Address", std::string("123 Main St"));
  * delivery.set_field("Receiver", std::string("John Doe"));
  * @endcode
+ *
+ * assign_field(), emplace_field() and set_fields() look the field up
+ * without building a key string and copy into the field's current string
+ * or vector buffer when the type is unchanged, so the update itself does
+ * not allocate. Constructing the Value passed in is up to the caller: for
+ * steady-state updates, keep the source values around (e.g. in a vector
+ * of (name, Value) pairs) rather than building them at every call.
  */
 class StructValue {
 public:
+    /**
+     * @brief Field storage; std::less<> allows lookup by std::string_view
+     */
+    using FieldMap = std::map<std::string, Value, std::less<>>;
+
     StructValue() = default;
 
     explicit StructValue(std::string type_name)
@@ -172,7 +191,7 @@ public:
      * @brief Get all field values
      * @return Map of field_name → Value
      */
-    const std::map<std::string, Value>& fields() const noexcept { return fields_; }
+    const FieldMap& fields() const noexcept { return fields_; }
 
     /**
      * @brief Set a field value
@@ -182,13 +201,69 @@ public:
      */
     void set_field(std::string field_name, Value value);
 
+    /**
+     * @brief Set a field value, reusing the field's storage
+     *
+     * When the field already holds the same type, the value is copied into
+     * the existing string or vector buffer, so updating an existing field
+     * allocates only if the new contents do not fit. The key string is
+     * built only when the field is new.
+     *
+     * @param field_name Name of the field
+     * @param value Value to set
+     * @return Reference to the stored value
+     */
+    Value& assign_field(std::string_view field_name, const Value& value);
+    Value& assign_field(std::string_view field_name, Value&& value);
+
+    /**
+     * @brief Construct a field value of type T in place
+     *
+     * If the field already holds a T and a single argument is given, it is
+     * assigned to the existing value (reusing its buffer); otherwise a T is
+     * constructed from args, replacing any previous value.
+     *
+     * @code
+     * pos.emplace_field<double>("Latitude", 37.7749);
+     * samples.emplace_field<std::vector<float>>("Samples", 64, 0.0f);
+     * @endcode
+     *
+     * @param field_name Name of the field
+     * @param args Arguments for T's constructor (or assignment)
+     * @return Reference to the stored T
+     */
+    template<typename T, typename... Args>
+    T& emplace_field(std::string_view field_name, Args&&... args) {
+        Value& slot = field_slot(field_name);
+        if constexpr (sizeof...(Args) == 1) {
+            return assign_or_emplace<T>(slot, std::forward<Args>(args)...);
+        } else {
+            return slot.emplace<T>(std::forward<Args>(args)...);
+        }
+    }
+
+    /**
+     * @brief Set several fields with assign_field()
+     *
+     * The initializer-list form is convenient for scalars; its elements
+     * are Values built (and copied) at the call site, so non-small strings
+     * and arrays allocate there. The vector form assigns from values the
+     * caller keeps and allocates nothing once the fields exist.
+     *
+     * @code
+     * pos.set_fields({{"Latitude", 37.7749}, {"Longitude", -122.4194}});
+     * @endcode
+     */
+    void set_fields(std::initializer_list<std::pair<std::string_view, Value>> fields);
+    void set_fields(const std::vector<std::pair<std::string, Value>>& fields);
+
     /**
      * @brief Get a field value
      *
      * @param field_name Name of the field
      * @return Pointer to value, or nullptr if field not set
      */
-    const Value* get_field(const std::string& field_name) const;
+    const Value* get_field(std::string_view field_name) const;
 
     /**
      * @brief Check if a field is set
@@ -196,7 +271,7 @@ public:
      * @param field_name Name of the field
      * @return true if field has a value, false otherwise
      */
-    bool has_field(const std::string& field_name) const;
+    bool has_field(std::string_view field_name) const;
 
     /**
      * @brief Remove a field
@@ -204,7 +279,7 @@ public:
      * @param field_name Name of the field to remove
      * @return true if field was removed, false if it didn't exist
      */
-    bool remove_field(const std::string& field_name);
+    bool remove_field(std::string_view field_name);
 
     /**
      * @brief Clear all fields
@@ -212,8 +287,22 @@ public:
     void clear();
 
 private:
-    std::string type_name_;               ///< Struct type name
-    std::map<std::string, Value> fields_; ///< Field name → value
+    // Existing field, or a new empty one
+    Value& field_slot(std::string_view field_name);
+
+    template<typename T, typename Arg>
+    static T& assign_or_emplace(Value& slot, Arg&& arg) {
+        if constexpr (std::is_assignable_v<T&, Arg&&>) {
+            if (T* existing = std::get_if<T>(&slot)) {
+                *existing = std::forward<Arg>(arg);
+                return *existing;
+            }
+        }
+        return slot.emplace<T>(std::forward<Arg>(arg));
+    }
+
+    std::string type_name_;  ///< Struct type name
+    FieldMap fields_;        ///< Field name → value
 };
 
 /**
@@ -275,6 +364,7 @@ private:
  * - Type name matches a registered definition
  * - All required fields are present
  * - Field types match definition
+ * - Field values satisfy the field constraints (min/max/allowed)
  * - No extra fields exist (strict mode)
  *
  * @param value The struct value to validate
@@ -0,0 +1,139 @@
+/**
+ * @file subscription.hpp
+ * @brief Wildcard path subscriptions over a SignalCatalog
+ *
+ * Subscription patterns are dotted VSS paths where a whole segment may be
+ * a wildcard:
+ * - `*`  matches exactly one segment  (Vehicle.Cabin.Door.*.IsOpen)
+ * - `**` matches zero or more segments (Vehicle.Powertrain.**)
+ *
+ * All patterns of a matcher are compiled together into one deterministic
+ * automaton over path segments, so matching a path against N patterns costs
+ * one transition per path segment regardless of N.
+ */
+
+#pragma once
+
+#include "catalog.hpp"
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace vss::types {
+
+/**
+ * @brief Index of a pattern within a SubscriptionMatcher
+ */
+using PatternId = std::uint32_t;
+
+/**
+ * @brief Matches wildcard subscription patterns against catalog signals
+ *
+ * Keeps, per pattern, the SignalSet of catalog signals (branches excluded)
+ * the pattern matches. The matcher refers to the catalog it was created with,
+ * which must outlive it.
+ *
+ * - Adding signals to the catalog: call refresh(); only the new nodes are
+ *   evaluated (one automaton step each).
+ * - Adding a pattern: the automaton is recompiled and all nodes re-evaluated.
+ *
+ * Example:
+ * @code
+ * SubscriptionMatcher matcher(catalog);
+ * auto doors = matcher.add_pattern("Vehicle.Cabin.Door.*.*.IsOpen");
+ *
+ * const SignalSet& ids = matcher.signals(*doors);
+ *
+ * catalog.add_signal("Vehicle.Cabin.Door.Row2.Left.IsOpen", NodeType::ACTUATOR, ValueType::BOOL);
+ * matcher.refresh();  // ids now includes the new door
+ * @endcode
+ */
+class SubscriptionMatcher {
+public:
+    explicit SubscriptionMatcher(const SignalCatalog& catalog);
+
+    /**
+     * @brief Add a subscription pattern
+     *
+     * Also picks up any signals added to the catalog since the last refresh.
+     *
+     * @param pattern Dotted path; segments may be `*` or `**`
+     * @return Pattern id, or nullopt if the pattern is malformed (empty
+     *         segments, or wildcards mixed with other characters in a segment)
+     */
+    std::optional<PatternId> add_pattern(std::string_view pattern);
+
+    /**
+     * @brief Evaluate catalog nodes added since the last refresh
+     */
+    void refresh();
+
+    /**
+     * @brief Signals matched by a pattern
+     *
+     * @param pattern Pattern id
+     * @return Matched signal ids (empty set if pattern id is out of range)
+     */
+    const SignalSet& signals(PatternId pattern) const noexcept;
+
+    /**
+     * @brief Patterns matching a catalog signal
+     *
+     * @param id Signal id (must have been seen by refresh()/add_pattern())
+     * @return Matching pattern ids in ascending order (empty for branches)
+     */
+    const std::vector<PatternId>& match(SignalId id) const noexcept;
+
+    /**
+     * @brief Patterns matching an arbitrary path (allocation-free)
+     *
+     * The path does not have to be in the catalog.
+     *
+     * @param path Dotted path
+     * @return Matching pattern ids in ascending order
+     */
+    const std::vector<PatternId>& match(std::string_view path) const noexcept;
+
+    /**
+     * @brief Get the source text of a pattern
+     */
+    const std::string& pattern(PatternId id) const { return patterns_.at(id).text; }
+
+    /**
+     * @brief Number of patterns
+     */
+    size_t pattern_count() const noexcept { return patterns_.size(); }
+
+private:
+    struct Pattern {
+        std::string text;
+        std::vector<std::string> segments;
+        uint32_t first_state;   ///< First NFA state; pattern has segments.size()+1 states
+    };
+
+    struct DfaState {
+        std::vector<uint32_t> nfa;  ///< Sorted, epsilon-closed NFA states
+        std::vector<std::pair<std::string, uint32_t>> literal_next;  ///< Sorted by segment
+        uint32_t other_next = 0;    ///< Transition for segments not in literal_next
+        std::vector<PatternId> accepts;
+    };
+
+    void compile();
+    void evaluate(SignalId id);
+    uint32_t step(uint32_t state, std::string_view segment) const noexcept;
+    std::vector<uint32_t> closure(std::vector<uint32_t> states) const;
+    std::vector<uint32_t> advance(const std::vector<uint32_t>& states, const std::string* literal) const;
+
+    const SignalCatalog& catalog_;
+    std::vector<Pattern> patterns_;
+    std::vector<uint32_t> nfa_pattern_;     ///< NFA state → owning pattern
+    std::vector<DfaState> dfa_;             ///< 0 is the dead state
+    uint32_t start_ = 0;                    ///< State before the first segment
+    std::vector<uint32_t> node_state_;      ///< SignalId → DFA state after its last segment
+    std::vector<SignalSet> matches_;        ///< PatternId → matched signals
+};
+
+} // namespace vss::types
@@ -14,6 +14,7 @@
  * - Type-safe Value variant (primitives, arrays, structs)
  * - Struct definitions and validation (VSS 4.0)
  * - Signal quality indicators (VALID/INVALID/NOT_AVAILABLE)
+ * - Signal catalog interning VSS paths into dense SignalIds
  * - Type utilities and conversions
  * - NO dependencies on protobuf, gRPC, or KUKSA
  *
@@ -44,6 +45,32 @@
 #include "value.hpp"
 #include "struct.hpp"
 #include "quality.hpp"
+#include "constraints.hpp"
+#include "enum.hpp"
+#include "catalog.hpp"
+#include "subscription.hpp"
+#include "decoder.hpp"
+#include "scaling.hpp"
+#include "series.hpp"
+#include "stats.hpp"
+#include "downsample.hpp"
+#include "resample.hpp"
+#include "update.hpp"
+#include "merge.hpp"
+#include "reorder.hpp"
+#include "history.hpp"
+#include "recording.hpp"
+#include "clock.hpp"
+#include "replay.hpp"
+#include "pool.hpp"
+#include "derived.hpp"
+#include "expression.hpp"
+#include "queue.hpp"
+#include "scheduler.hpp"
+#include "latency.hpp"
+#include "instrumentation.hpp"
+#include "workload.hpp"
+#include "footprint.hpp"
 
 /**
  * @namespace vss::types
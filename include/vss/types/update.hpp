@@ -0,0 +1,74 @@
+/**
+ * @file update.hpp
+ * @brief Timestamped signal updates and sources producing them
+ *
+ * A SignalUpdate pairs a catalog SignalId with a DynamicQualifiedValue.
+ * Streams of updates (recordings, per-bus decoders, network feeds) are
+ * exposed through UpdateSource, which hands out updates in batches so
+ * consumers pay one virtual call per batch rather than per update.
+ */
+
+#pragma once
+
+#include "catalog.hpp"
+#include "quality.hpp"
+#include <cstddef>
+#include <vector>
+
+namespace vss::types {
+
+/**
+ * @brief One value update of one signal
+ */
+struct SignalUpdate {
+    SignalId id = INVALID_SIGNAL_ID;
+    DynamicQualifiedValue value;
+
+    SignalUpdate() = default;
+    SignalUpdate(SignalId i, DynamicQualifiedValue v)
+        : id(i), value(std::move(v)) {}
+};
+
+/**
+ * @brief Source of updates in non-decreasing timestamp order
+ */
+class UpdateSource {
+public:
+    virtual ~UpdateSource() = default;
+
+    /**
+     * @brief Move up to max_count further updates into out
+     *
+     * Updates are appended to out; implementations should move rather
+     * than copy values.
+     *
+     * @param out Receives the updates (appended)
+     * @param max_count Maximum number of updates to append
+     * @return Number of updates appended; 0 means the source is exhausted
+     */
+    virtual size_t pull(std::vector<SignalUpdate>& out, size_t max_count) = 0;
+};
+
+/**
+ * @brief UpdateSource over an in-memory vector
+ *
+ * Updates are moved out as they are pulled.
+ */
+class VectorUpdateSource : public UpdateSource {
+public:
+    explicit VectorUpdateSource(std::vector<SignalUpdate> updates)
+        : updates_(std::move(updates)) {}
+
+    size_t pull(std::vector<SignalUpdate>& out, size_t max_count) override;
+
+    /**
+     * @brief Updates not yet pulled
+     */
+    size_t remaining() const noexcept { return updates_.size() - position_; }
+
+private:
+    std::vector<SignalUpdate> updates_;
+    size_t position_ = 0;
+};
+
+} // namespace vss::types
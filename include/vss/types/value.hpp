@@ -20,6 +20,31 @@ namespace vss::types {
 
 // Forward declarations
 class StructValue;
+class EnumDictionary;
+
+/**
+ * @brief Dictionary-encoded string of a VSS allowed-values signal
+ *
+ * Stores a small code into an EnumDictionary shared by all values of the
+ * signal, instead of the string itself. Behaves as a STRING value:
+ * get_value_type() reports ValueType::STRING and values_equal() compares
+ * it with std::string by text. See enum.hpp for encoding/decoding.
+ */
+struct EnumValue {
+    std::shared_ptr<const EnumDictionary> dictionary;  ///< Allowed values, shared
+    uint16_t code = 0;                                 ///< Index into dictionary
+
+    /**
+     * @brief The string this value stands for (empty if code is out of range)
+     */
+    const std::string& str() const;
+
+    /**
+     * @brief Equality by text; O(1) when both share the same dictionary
+     */
+    bool operator==(const EnumValue& other) const;
+    bool operator!=(const EnumValue& other) const { return !(*this == other); }
+};
 
 /**
  * @brief VSS value type - supports primitives, arrays, and structs
@@ -61,7 +86,9 @@ using Value = std::variant<
     std::vector<std::string>,
     // Struct types
     std::shared_ptr<StructValue>, // Struct (heap-allocated to avoid circular dependency)
-    std::vector<std::shared_ptr<StructValue>> // Array of structs
+    std::vector<std::shared_ptr<StructValue>>, // Array of structs
+    // Dictionary-encoded string (reported as STRING)
+    EnumValue
 >;
 
 /**
@@ -212,6 +239,8 @@ bool are_types_compatible(ValueType expected, ValueType actual);
  * - Unsigned integers: uint8 ↔ uint16 ↔ uint32 ↔ uint64
  * - Floating point: float ↔ double
  * - Arrays: element-wise conversion for compatible types
+ * - Enum strings: an EnumValue converted to STRING yields a std::string
+ *   with its text, so std::get<std::string>() on the result is safe
  *
  * If value already matches target_type, returns value unchanged.
  * If types are incompatible, returns empty Value (std::monostate).
@@ -269,6 +298,7 @@ inline bool is_struct(ValueType type) {
  *
  * Performs deep comparison for all types including nested structs.
  * For structs, compares type_name and all fields recursively.
+ * EnumValue and std::string compare equal if they hold the same text.
  *
  * @param a First value
  * @param b Second value
@@ -294,6 +324,7 @@ double to_double(const Value& value);
  * For numeric types with threshold > 0, returns true if the absolute
  * difference exceeds the threshold.
  * For non-numeric types or threshold == 0, returns true if values differ.
+ * An EnumValue and a std::string with the same text are not a change.
  *
  * @param old_val Previous value
  * @param new_val New value
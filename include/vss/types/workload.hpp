@@ -0,0 +1,200 @@
+/**
+ * @file workload.hpp
+ * @brief Seeded synthetic update streams for benchmarks and capacity planning
+ *
+ * WorkloadGenerator turns a SignalCatalog (and the StructRegistry for its
+ * struct signals) into an endless, time-ordered stream of SignalUpdates
+ * that looks like a vehicle: signals update at their own rates with
+ * jitter, numeric values drift within their constraints, arrays keep a
+ * per-signal length, structs are filled field by field, and quality
+ * occasionally drops to INVALID or NOT_AVAILABLE and recovers.
+ *
+ * The stream depends only on the catalog, the registry and the profile
+ * (including its seed), so the same inputs reproduce the same updates on
+ * every platform.
+ */
+
+#pragma once
+
+#include "catalog.hpp"
+#include "struct.hpp"
+#include "update.hpp"
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace vss::types {
+
+/**
+ * @brief Update rate for the signals matching a subscription pattern
+ */
+struct RateRule {
+    std::string pattern;    ///< SubscriptionMatcher pattern, e.g. "Vehicle.Powertrain.**"
+    double rate_hz = 0.0;   ///< Updates per second; 0 = once at start, < 0 = excluded
+};
+
+/**
+ * @brief Shape of a generated workload
+ */
+struct WorkloadProfile {
+    uint64_t seed = 1;      ///< Same seed, catalog and profile give the same stream
+
+    /// Timestamp of the first update slot
+    std::chrono::system_clock::time_point start{};
+
+    /// Default rate per PriorityClass (CRITICAL, HIGH, NORMAL, LOW); attributes are sent once
+    std::array<double, PRIORITY_CLASS_COUNT> class_rate_hz{{100.0, 50.0, 10.0, 1.0}};
+
+    /// Overrides of the class rates; when several rules match a signal the last one wins
+    std::vector<RateRule> rates;
+
+    double jitter = 0.05;           ///< Period variation, as a fraction of the period (0 = exact)
+
+    size_t min_array_size = 1;      ///< Length range of array signals and struct arrays,
+    size_t max_array_size = 16;     ///< fixed per signal
+    size_t max_struct_depth = 4;    ///< Deeper nested structs are left without fields
+
+    double invalid_probability = 0.001;      ///< Per update: VALID -> INVALID
+    double unavailable_probability = 0.0005; ///< Per update: VALID -> NOT_AVAILABLE (empty value)
+    double recovery_probability = 0.2;       ///< Per update: INVALID/NOT_AVAILABLE -> VALID
+
+    uint64_t max_updates = 0;               ///< Stop after this many updates (0 = unlimited)
+    std::chrono::nanoseconds duration{0};   ///< Stop at start + duration (0 = unlimited)
+};
+
+/**
+ * @brief Deterministic synthetic update source
+ *
+ * Every signal (non-branch catalog node) of a supported type is
+ * scheduled with its profile rate; updates are produced in timestamp
+ * order (ties by catalog order), so the generator can feed UpdateMerger,
+ * ReorderBuffer, RecordingWriter or ReplayEngine-style consumers directly.
+ *
+ * Values:
+ * - numeric signals follow a bounded random walk over the signal's
+ *   min/max (or a type-dependent default range); signals with allowed
+ *   values switch between them now and then
+ * - bools toggle occasionally, strings come from a small pool of short
+ *   strings (or the allowed values, encoded as EnumValue when the node
+ *   has an enum_dictionary)
+ * - arrays have a per-signal length in [min_array_size, max_array_size]
+ * - STRUCT/STRUCT_ARRAY signals are filled from their registry
+ *   definition; signals whose struct type is unknown are not generated
+ *
+ * Producing a scalar update costs a heap step and a few random numbers,
+ * so the generator itself runs at millions of updates per second.
+ *
+ * The catalog and registry are not owned and must outlive the generator.
+ *
+ * Example:
+ * @code
+ * WorkloadProfile profile;
+ * profile.seed = 42;
+ * profile.rates = {{"Vehicle.Powertrain.**", 200.0}, {"Vehicle.Cabin.Infotainment.**", -1.0}};
+ * profile.max_updates = 1'000'000;
+ *
+ * WorkloadGenerator workload(catalog, registry, profile);
+ * std::cout << workload.total_rate_hz() << " updates per simulated second\n";
+ *
+ * std::vector<SignalUpdate> batch;
+ * while (workload.pull(batch, 4096) > 0) {
+ *     pipeline.process(batch);
+ *     batch.clear();
+ * }
+ * @endcode
+ */
+class WorkloadGenerator : public UpdateSource {
+public:
+    WorkloadGenerator(const SignalCatalog& catalog, const StructRegistry& registry,
+                      WorkloadProfile profile = {});
+
+    size_t pull(std::vector<SignalUpdate>& out, size_t max_count) override;
+
+    /**
+     * @brief Produce the next update into out
+     *
+     * @return false once max_updates or duration is reached (or no signal is scheduled)
+     */
+    bool next(SignalUpdate& out);
+
+    /**
+     * @brief Restart the stream from the beginning (same seed)
+     */
+    void reset();
+
+    /**
+     * @brief Generated signals, in catalog order
+     */
+    const std::vector<SignalId>& signals() const noexcept { return signal_ids_; }
+
+    /**
+     * @brief Rate of a signal
+     *
+     * @return Updates per second, 0 for signals sent once, negative if the
+     *         signal is not generated
+     */
+    double rate_hz(SignalId id) const noexcept;
+
+    /**
+     * @brief Sum of the periodic signal rates (updates per simulated second)
+     */
+    double total_rate_hz() const noexcept { return total_rate_hz_; }
+
+    /**
+     * @brief Updates produced since construction or the last reset()
+     */
+    uint64_t generated() const noexcept { return generated_; }
+
+    const WorkloadProfile& profile() const noexcept { return profile_; }
+
+private:
+    /// xoshiro256**, implemented here so streams do not depend on the standard library
+    struct Rng {
+        uint64_t s[4];
+
+        void seed(uint64_t seed) noexcept;
+        uint64_t next() noexcept;
+        double uniform() noexcept { return static_cast<double>(next() >> 11) * 0x1.0p-53; }
+        bool chance(double p) noexcept { return p > 0.0 && uniform() < p; }
+        size_t below(size_t n) noexcept { return n > 0 ? static_cast<size_t>(next() % n) : 0; }
+    };
+
+    struct Track {
+        SignalId id = INVALID_SIGNAL_ID;
+        const SignalNode* node = nullptr;
+        const StructDefinition* definition = nullptr;   ///< STRUCT/STRUCT_ARRAY signals
+        int64_t period_ns = 0;      ///< 0 = sent once
+        int64_t next_ns = 0;        ///< Offset of the next update from start
+        double lo = 0.0;            ///< Random walk range
+        double hi = 0.0;
+        double level = 0.0;
+        size_t array_size = 0;
+        size_t choice = 0;          ///< Current allowed value / pool string
+        bool flag = false;          ///< Current bool value
+        SignalQuality quality = SignalQuality::VALID;
+    };
+
+    void schedule();
+    bool fires_after(uint32_t a, uint32_t b) const noexcept;   ///< Heap order: later next_ns, then later track
+    void init_track(Track& track);
+    Value make_value(Track& track);
+    Value make_struct(const StructDefinition& definition, size_t depth);
+    Value make_field(const FieldDefinition& field, size_t depth);
+
+    const SignalCatalog& catalog_;
+    const StructRegistry& registry_;
+    WorkloadProfile profile_;
+
+    std::vector<SignalId> signal_ids_;
+    std::vector<double> rates_;             ///< Indexed by SignalId; < 0 = not generated
+    std::vector<Track> tracks_;
+    std::vector<uint32_t> heap_;            ///< Track indices, earliest next_ns on top
+    double total_rate_hz_ = 0.0;
+    Rng rng_{};
+    uint64_t generated_ = 0;
+};
+
+} // namespace vss::types
@@ -0,0 +1,268 @@
+/**
+ * @file catalog.cpp
+ * @brief Implementation of the VSS signal path catalog
+ */
+
+#include <vss/types/catalog.hpp>
+#include <algorithm>
+#include <cctype>
+
+namespace vss::types {
+
+const char* node_type_to_string(NodeType type) {
+    switch (type) {
+        case NodeType::BRANCH:    return "BRANCH";
+        case NodeType::SENSOR:    return "SENSOR";
+        case NodeType::ACTUATOR:  return "ACTUATOR";
+        case NodeType::ATTRIBUTE: return "ATTRIBUTE";
+        default:                  return "UNKNOWN";
+    }
+}
+
+std::optional<NodeType> node_type_from_string(const std::string& str) {
+    // Convert to uppercase for case-insensitive matching
+    std::string upper = str;
+    std::transform(upper.begin(), upper.end(), upper.begin(),
+                   [](unsigned char c){ return std::toupper(c); });
+
+    if (upper == "BRANCH") return NodeType::BRANCH;
+    if (upper == "SENSOR") return NodeType::SENSOR;
+    if (upper == "ACTUATOR") return NodeType::ACTUATOR;
+    if (upper == "ATTRIBUTE") return NodeType::ATTRIBUTE;
+
+    return std::nullopt;
+}
+
+const char* priority_class_to_string(PriorityClass priority) {
+    switch (priority) {
+        case PriorityClass::CRITICAL: return "CRITICAL";
+        case PriorityClass::HIGH:     return "HIGH";
+        case PriorityClass::NORMAL:   return "NORMAL";
+        case PriorityClass::LOW:      return "LOW";
+        default:                      return "UNKNOWN";
+    }
+}
+
+std::optional<PriorityClass> priority_class_from_string(const std::string& str) {
+    std::string upper = str;
+    std::transform(upper.begin(), upper.end(), upper.begin(),
+                   [](unsigned char c){ return std::toupper(c); });
+
+    if (upper == "CRITICAL") return PriorityClass::CRITICAL;
+    if (upper == "HIGH") return PriorityClass::HIGH;
+    if (upper == "NORMAL") return PriorityClass::NORMAL;
+    if (upper == "LOW") return PriorityClass::LOW;
+
+    return std::nullopt;
+}
+
+// SignalSet implementation
+
+size_t SignalSet::count() const noexcept {
+    size_t total = 0;
+    for (std::uint64_t word : words_) {
+#if defined(__GNUC__) || defined(__clang__)
+        total += static_cast<size_t>(__builtin_popcountll(word));
+#else
+        for (; word != 0; word &= word - 1) ++total;
+#endif
+    }
+    return total;
+}
+
+bool SignalSet::empty() const noexcept {
+    return std::all_of(words_.begin(), words_.end(), [](std::uint64_t w) { return w == 0; });
+}
+
+std::vector<SignalId> SignalSet::to_vector() const {
+    std::vector<SignalId> ids;
+    ids.reserve(count());
+    for_each([&ids](SignalId id) { ids.push_back(id); });
+    return ids;
+}
+
+SignalSet& SignalSet::operator|=(const SignalSet& other) {
+    if (other.words_.size() > words_.size()) {
+        words_.resize(other.words_.size(), 0);
+    }
+    for (size_t i = 0; i < other.words_.size(); ++i) {
+        words_[i] |= other.words_[i];
+    }
+    return *this;
+}
+
+SignalSet& SignalSet::operator&=(const SignalSet& other) {
+    for (size_t i = 0; i < words_.size(); ++i) {
+        words_[i] &= (i < other.words_.size()) ? other.words_[i] : 0;
+    }
+    return *this;
+}
+
+bool SignalSet::operator==(const SignalSet& other) const noexcept {
+    size_t common = std::min(words_.size(), other.words_.size());
+    for (size_t i = 0; i < common; ++i) {
+        if (words_[i] != other.words_[i]) return false;
+    }
+    for (size_t i = common; i < words_.size(); ++i) {
+        if (words_[i] != 0) return false;
+    }
+    for (size_t i = common; i < other.words_.size(); ++i) {
+        if (other.words_[i] != 0) return false;
+    }
+    return true;
+}
+
+// SignalCatalog implementation
+
+// Paths are non-empty, have no empty segments and no wildcard characters
+static bool is_valid_path(std::string_view path) {
+    if (path.empty() || path.front() == '.' || path.back() == '.') {
+        return false;
+    }
+    for (size_t i = 0; i < path.size(); ++i) {
+        if (path[i] == '*') return false;
+        if (path[i] == '.' && path[i + 1] == '.') return false;
+    }
+    return true;
+}
+
+SignalCatalog::SignalCatalog(const SignalCatalog& other)
+    : nodes_(other.nodes_)
+    , roots_(other.roots_) {
+    rebuild_index();
+}
+
+SignalCatalog& SignalCatalog::operator=(const SignalCatalog& other) {
+    if (this != &other) {
+        nodes_ = other.nodes_;
+        roots_ = other.roots_;
+        rebuild_index();
+    }
+    return *this;
+}
+
+std::optional<SignalId> SignalCatalog::add_branch(std::string_view path, std::string description) {
+    SignalNode branch;
+    branch.node_type = NodeType::BRANCH;
+    branch.description = std::move(description);
+    return intern(path, branch);
+}
+
+std::optional<SignalId> SignalCatalog::add_signal(
+    std::string_view path,
+    NodeType node_type,
+    ValueType type,
+    std::string struct_type_name,
+    std::string description)
+{
+    if (node_type == NodeType::BRANCH) {
+        return std::nullopt;
+    }
+    SignalNode leaf;
+    leaf.node_type = node_type;
+    leaf.type = type;
+    leaf.struct_type_name = std::move(struct_type_name);
+    leaf.description = std::move(description);
+    return intern(path, leaf);
+}
+
+bool SignalCatalog::set_constraints(SignalId id, ValueConstraints constraints) {
+    if (id >= nodes_.size() || nodes_[id].is_branch()) {
+        return false;
+    }
+    SignalNode& node = nodes_[id];
+    node.constraints = std::move(constraints);
+    node.enum_dictionary = node.type == ValueType::STRING
+        ? EnumDictionary::from_constraints(node.constraints)
+        : nullptr;
+    return true;
+}
+
+bool SignalCatalog::set_priority(SignalId id, PriorityClass priority, std::chrono::nanoseconds latency_budget) {
+    if (id >= nodes_.size() || nodes_[id].is_branch()) {
+        return false;
+    }
+    nodes_[id].priority = priority;
+    nodes_[id].latency_budget = latency_budget;
+    return true;
+}
+
+std::optional<SignalId> SignalCatalog::find(std::string_view path) const {
+    auto it = index_.find(path);
+    if (it == index_.end()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+void SignalCatalog::clear() {
+    index_.clear();
+    roots_.clear();
+    nodes_.clear();
+}
+
+std::optional<SignalId> SignalCatalog::intern(std::string_view path, const SignalNode& node) {
+    if (!is_valid_path(path)) {
+        return std::nullopt;
+    }
+
+    // Check the whole path before creating anything, so a rejected
+    // insert leaves no dangling intermediate branches behind
+    for (size_t end = path.find('.'); end != std::string_view::npos; end = path.find('.', end + 1)) {
+        auto it = index_.find(path.substr(0, end));
+        if (it != index_.end() && !nodes_[it->second].is_branch()) {
+            return std::nullopt;  // Prefix is a signal
+        }
+    }
+    auto existing = index_.find(path);
+    if (existing != index_.end()) {
+        // Re-adding a branch is a no-op, anything else is a conflict
+        if (node.is_branch() && nodes_[existing->second].is_branch()) {
+            return existing->second;
+        }
+        return std::nullopt;
+    }
+
+    SignalId parent = INVALID_SIGNAL_ID;
+    size_t start = 0;
+    while (true) {
+        size_t end = path.find('.', start);
+        bool last = (end == std::string_view::npos);
+        std::string_view prefix = last ? path : path.substr(0, end);
+
+        auto it = index_.find(prefix);
+        if (it != index_.end()) {
+            parent = it->second;
+        } else {
+            SignalId id = static_cast<SignalId>(nodes_.size());
+            SignalNode& created = nodes_.emplace_back(last ? node : SignalNode{});
+            created.id = id;
+            created.parent = parent;
+            created.path = std::string(prefix);
+            created.children.clear();
+
+            index_.emplace(std::string_view(created.path), id);
+            if (parent == INVALID_SIGNAL_ID) {
+                roots_.push_back(id);
+            } else {
+                nodes_[parent].children.push_back(id);
+            }
+            parent = id;
+        }
+
+        if (last) {
+            return parent;
+        }
+        start = end + 1;
+    }
+}
+
+void SignalCatalog::rebuild_index() {
+    index_.clear();
+    index_.reserve(nodes_.size());
+    for (const auto& node : nodes_) {
+        index_.emplace(std::string_view(node.path), node.id);
+    }
+}
+
+} // namespace vss::types
@@ -0,0 +1,22 @@
+/**
+ * @file clock.cpp
+ * @brief Implementation of the pluggable clock
+ */
+
+#include <vss/types/clock.hpp>
+
+namespace vss::types {
+
+namespace detail {
+std::atomic<const ClockSource*> active_clock_source{nullptr};
+} // namespace detail
+
+const ClockSource* set_clock_source(const ClockSource* source) noexcept {
+    return detail::active_clock_source.exchange(source, std::memory_order_acq_rel);
+}
+
+const ClockSource* clock_source() noexcept {
+    return detail::active_clock_source.load(std::memory_order_acquire);
+}
+
+} // namespace vss::types
@@ -0,0 +1,350 @@
+/**
+ * @file constraints.cpp
+ * @brief Implementation of value constraints
+ */
+
+#include <vss/types/constraints.hpp>
+#include <vss/types/clock.hpp>
+#include <vss/types/latency.hpp>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <type_traits>
+
+namespace vss::types {
+
+namespace {
+
+// Flags are computed through fixed-size stack blocks when the caller
+// does not need them
+constexpr size_t BLOCK_SIZE = 256;
+
+template<typename T>
+constexpr bool is_numeric_v = std::is_arithmetic_v<T> && !std::is_same_v<T, bool>;
+
+template<typename T>
+struct is_vector : std::false_type {};
+
+template<typename T>
+struct is_vector<std::vector<T>> : std::true_type {
+    using element_type = T;
+};
+
+template<typename T>
+void range_flags(const T* values, size_t count, T lo, T hi, uint8_t* flags) {
+    for (size_t i = 0; i < count; ++i) {
+        flags[i] = static_cast<uint8_t>((values[i] >= lo) & (values[i] <= hi));
+    }
+}
+
+template<typename T>
+void range_flags_wide(const T* values, size_t count, double lo, double hi, uint8_t* flags) {
+    for (size_t i = 0; i < count; ++i) {
+        double v = static_cast<double>(values[i]);
+        flags[i] = static_cast<uint8_t>((v >= lo) & (v <= hi));
+    }
+}
+
+size_t count_zero(const uint8_t* flags, size_t count) {
+    size_t ok = 0;
+    for (size_t i = 0; i < count; ++i) {
+        ok += flags[i];
+    }
+    return count - ok;
+}
+
+template<typename T>
+void append_element(std::ostringstream& oss, const T& v) {
+    if constexpr (std::is_same_v<T, bool>) {
+        oss << (v ? "true" : "false");
+    } else if constexpr (std::is_same_v<T, std::string>) {
+        oss << "'" << v << "'";
+    } else if constexpr (std::is_integral_v<T>) {
+        oss << +v;
+    } else {
+        oss << v;
+    }
+}
+
+} // namespace
+
+ConstraintChecker::ConstraintChecker(const ValueConstraints& constraints) {
+    if (constraints.min.has_value() || constraints.max.has_value()) {
+        has_range_ = true;
+        min_ = constraints.min.value_or(-std::numeric_limits<double>::infinity());
+        max_ = constraints.max.value_or(std::numeric_limits<double>::infinity());
+    }
+
+    restricted_ = !constraints.allowed.empty();
+    for (const auto& allowed : constraints.allowed) {
+        std::visit([this](auto&& val) {
+            using T = std::decay_t<decltype(val)>;
+            auto add = [this](const auto& element) {
+                using E = std::decay_t<decltype(element)>;
+                if constexpr (std::is_same_v<E, bool>) {
+                    (element ? allow_true_ : allow_false_) = true;
+                } else if constexpr (is_numeric_v<E>) {
+                    allowed_numbers_.push_back(static_cast<double>(element));
+                } else if constexpr (std::is_same_v<E, std::string>) {
+                    allowed_strings_.insert(element);
+                } else if constexpr (std::is_same_v<E, EnumValue>) {
+                    allowed_strings_.insert(element.str());
+                }
+            };
+
+            if constexpr (is_vector<T>::value) {
+                if constexpr (!std::is_same_v<typename is_vector<T>::element_type,
+                                              std::shared_ptr<StructValue>>) {
+                    for (const auto& element : val) {
+                        add(static_cast<typename is_vector<T>::element_type>(element));
+                    }
+                }
+            } else {
+                add(val);
+            }
+        }, allowed);
+    }
+
+    std::sort(allowed_numbers_.begin(), allowed_numbers_.end());
+    allowed_numbers_.erase(std::unique(allowed_numbers_.begin(), allowed_numbers_.end()),
+                           allowed_numbers_.end());
+}
+
+template<typename T>
+size_t ConstraintChecker::check_range(const T* values, size_t count, uint8_t* valid) const {
+    static_assert(is_numeric_v<T>, "T must be an integer or floating point type");
+
+    // Convert the bounds into T once, so the range test runs on native
+    // elements. An empty intersection with T's range rejects everything.
+    bool reject_all = false;
+    T lo = std::numeric_limits<T>::lowest();
+    T hi = std::numeric_limits<T>::max();
+    if constexpr (std::is_integral_v<T>) {
+        if (has_range_) {
+            // type_limit is max + 1 (a power of two, exact as double)
+            constexpr double type_min = static_cast<double>(std::numeric_limits<T>::min());
+            constexpr double type_limit = (static_cast<double>(std::numeric_limits<T>::max() / 2) + 1.0) * 2.0;
+            // Round first: a bound just past T's range still rounds out of it
+            const double min_ceil = std::ceil(min_);
+            const double max_floor = std::floor(max_);
+            if (!(min_ceil <= max_floor) || min_ceil >= type_limit || max_floor < type_min) {
+                reject_all = true;
+            } else {
+                if (min_ceil > type_min) {
+                    lo = static_cast<T>(min_ceil);
+                }
+                if (max_floor < type_limit) {
+                    hi = static_cast<T>(max_floor);
+                }
+            }
+        }
+    }
+
+    uint8_t block[BLOCK_SIZE];
+    size_t bad = 0;
+
+    for (size_t base = 0; base < count; base += BLOCK_SIZE) {
+        const size_t n = std::min(BLOCK_SIZE, count - base);
+        const T* in = values + base;
+        uint8_t* flags = valid ? valid + base : block;
+
+        if (reject_all) {
+            std::fill(flags, flags + n, uint8_t{0});
+        } else if constexpr (std::is_integral_v<T>) {
+            range_flags(in, n, lo, hi, flags);
+        } else if (has_range_) {
+            range_flags_wide(in, n, min_, max_, flags);
+        } else {
+            std::fill(flags, flags + n, uint8_t{1});
+        }
+
+        if (restricted_) {
+            for (size_t i = 0; i < n; ++i) {
+                if (flags[i]) {
+                    flags[i] = std::binary_search(allowed_numbers_.begin(), allowed_numbers_.end(),
+                                                  static_cast<double>(in[i]));
+                }
+            }
+        }
+
+        bad += count_zero(flags, n);
+    }
+    return bad;
+}
+
+size_t ConstraintChecker::check_strings(const std::string* values, size_t count, uint8_t* valid) const {
+    if (!restricted_) {
+        if (valid) {
+            std::fill(valid, valid + count, uint8_t{1});
+        }
+        return 0;
+    }
+
+    size_t bad = 0;
+    for (size_t i = 0; i < count; ++i) {
+        bool ok = allowed_strings_.find(values[i]) != allowed_strings_.end();
+        if (valid) {
+            valid[i] = ok;
+        }
+        bad += !ok;
+    }
+    return bad;
+}
+
+size_t ConstraintChecker::check(const Value& value, std::vector<uint8_t>& valid) const {
+    return std::visit([&](auto&& val) -> size_t {
+        using T = std::decay_t<decltype(val)>;
+
+        if constexpr (is_numeric_v<T>) {
+            valid.resize(1);
+            return check_range(&val, 1, valid.data());
+        } else if constexpr (std::is_same_v<T, bool>) {
+            valid.assign(1, allows(val));
+            return valid[0] ? 0 : 1;
+        } else if constexpr (std::is_same_v<T, std::string>) {
+            valid.resize(1);
+            return check_strings(&val, 1, valid.data());
+        } else if constexpr (std::is_same_v<T, EnumValue>) {
+            valid.resize(1);
+            return check_strings(&val.str(), 1, valid.data());
+        } else if constexpr (is_vector<T>::value) {
+            using E = typename is_vector<T>::element_type;
+            if constexpr (is_numeric_v<E>) {
+                valid.resize(val.size());
+                return check_range(val.data(), val.size(), valid.data());
+            } else if constexpr (std::is_same_v<E, bool>) {
+                valid.resize(val.size());
+                size_t bad = 0;
+                for (size_t i = 0; i < val.size(); ++i) {
+                    valid[i] = allows(val[i]);
+                    bad += !valid[i];
+                }
+                return bad;
+            } else if constexpr (std::is_same_v<E, std::string>) {
+                valid.resize(val.size());
+                return check_strings(val.data(), val.size(), valid.data());
+            } else {
+                valid.clear();
+                return 0;
+            }
+        } else {
+            valid.clear();
+            return 0;
+        }
+    }, value);
+}
+
+size_t ConstraintChecker::count_violations(const Value& value) const {
+    if (empty()) {
+        return 0;
+    }
+
+    return std::visit([&](auto&& val) -> size_t {
+        using T = std::decay_t<decltype(val)>;
+
+        if constexpr (is_numeric_v<T>) {
+            return check_range(&val, 1, nullptr);
+        } else if constexpr (std::is_same_v<T, bool>) {
+            return allows(val) ? 0 : 1;
+        } else if constexpr (std::is_same_v<T, std::string>) {
+            return check_strings(&val, 1, nullptr);
+        } else if constexpr (std::is_same_v<T, EnumValue>) {
+            return check_strings(&val.str(), 1, nullptr);
+        } else if constexpr (is_vector<T>::value) {
+            using E = typename is_vector<T>::element_type;
+            if constexpr (is_numeric_v<E>) {
+                return check_range(val.data(), val.size(), nullptr);
+            } else if constexpr (std::is_same_v<E, bool>) {
+                size_t bad = 0;
+                for (bool b : val) {
+                    bad += !allows(b);
+                }
+                return bad;
+            } else if constexpr (std::is_same_v<E, std::string>) {
+                return check_strings(val.data(), val.size(), nullptr);
+            } else {
+                return 0;
+            }
+        } else {
+            return 0;
+        }
+    }, value);
+}
+
+size_t ConstraintChecker::apply(DynamicQualifiedValue* slots, size_t count) const {
+    if (LatencyRecorder* recorder = stage_recorder(PipelineStage::VALIDATION)) {
+        recorder->record_ages(slots, count, vss::types::now());
+    }
+
+    size_t downgraded = 0;
+    for (size_t i = 0; i < count; ++i) {
+        if (slots[i].quality == SignalQuality::VALID && count_violations(slots[i].value) > 0) {
+            slots[i].quality = SignalQuality::INVALID;
+            ++downgraded;
+        }
+    }
+    return downgraded;
+}
+
+std::optional<std::string> check_constraints(
+    const Value& value,
+    const ValueConstraints& constraints)
+{
+    ConstraintChecker checker{constraints};
+    std::vector<uint8_t> valid;
+    if (checker.check(value, valid) == 0) {
+        return std::nullopt;
+    }
+
+    size_t index = static_cast<size_t>(std::find(valid.begin(), valid.end(), 0) - valid.begin());
+
+    std::ostringstream oss;
+    std::visit([&](auto&& val) {
+        using T = std::decay_t<decltype(val)>;
+        if constexpr (is_vector<T>::value) {
+            using E = typename is_vector<T>::element_type;
+            if constexpr (!std::is_same_v<E, std::shared_ptr<StructValue>>) {
+                oss << "Element " << index << " (";
+                append_element(oss, static_cast<E>(val[index]));
+                oss << ")";
+            }
+        } else if constexpr (std::is_arithmetic_v<T> || std::is_same_v<T, std::string>) {
+            oss << "Value ";
+            append_element(oss, val);
+        } else if constexpr (std::is_same_v<T, EnumValue>) {
+            oss << "Value ";
+            append_element(oss, val.str());
+        }
+    }, value);
+
+    oss << " violates constraints (";
+    const char* sep = "";
+    if (constraints.min.has_value()) {
+        oss << "min " << *constraints.min;
+        sep = ", ";
+    }
+    if (constraints.max.has_value()) {
+        oss << sep << "max " << *constraints.max;
+        sep = ", ";
+    }
+    if (!constraints.allowed.empty()) {
+        oss << sep << constraints.allowed.size() << " allowed values";
+    }
+    oss << ")";
+    return oss.str();
+}
+
+// Explicit instantiations for all numeric element types
+template size_t ConstraintChecker::check_range<int8_t>(const int8_t*, size_t, uint8_t*) const;
+template size_t ConstraintChecker::check_range<int16_t>(const int16_t*, size_t, uint8_t*) const;
+template size_t ConstraintChecker::check_range<int32_t>(const int32_t*, size_t, uint8_t*) const;
+template size_t ConstraintChecker::check_range<int64_t>(const int64_t*, size_t, uint8_t*) const;
+template size_t ConstraintChecker::check_range<uint8_t>(const uint8_t*, size_t, uint8_t*) const;
+template size_t ConstraintChecker::check_range<uint16_t>(const uint16_t*, size_t, uint8_t*) const;
+template size_t ConstraintChecker::check_range<uint32_t>(const uint32_t*, size_t, uint8_t*) const;
+template size_t ConstraintChecker::check_range<uint64_t>(const uint64_t*, size_t, uint8_t*) const;
+template size_t ConstraintChecker::check_range<float>(const float*, size_t, uint8_t*) const;
+template size_t ConstraintChecker::check_range<double>(const double*, size_t, uint8_t*) const;
+
+} // namespace vss::types
@@ -0,0 +1,352 @@
+/**
+ * @file decoder.cpp
+ * @brief Implementation of table-driven frame decoding
+ */
+
+#include <vss/types/decoder.hpp>
+#include <vss/types/clock.hpp>
+#include <vss/types/latency.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+namespace vss::types {
+
+// Fields are read through a 9-byte window, so the working copy of a frame
+// carries 8 bytes of zero padding behind MAX_FRAME_SIZE
+static constexpr size_t PADDED_FRAME_SIZE = MAX_FRAME_SIZE + 16;
+
+// Signals are processed in blocks so intermediate arrays live on the stack
+static constexpr size_t BLOCK_SIZE = 64;
+
+static inline uint64_t load_le64(const uint8_t* p) {
+    uint64_t v = 0;
+    for (int i = 7; i >= 0; --i) {
+        v = (v << 8) | p[i];
+    }
+    return v;
+}
+
+static inline uint64_t load_be64(const uint8_t* p) {
+    uint64_t v = 0;
+    for (int i = 0; i < 8; ++i) {
+        v = (v << 8) | p[i];
+    }
+    return v;
+}
+
+static bool is_decodable_type(ValueType type) {
+    switch (type) {
+        case ValueType::BOOL:
+        case ValueType::INT8:
+        case ValueType::INT16:
+        case ValueType::INT32:
+        case ValueType::INT64:
+        case ValueType::UINT8:
+        case ValueType::UINT16:
+        case ValueType::UINT32:
+        case ValueType::UINT64:
+        case ValueType::FLOAT:
+        case ValueType::DOUBLE:
+            return true;
+        default:
+            return false;
+    }
+}
+
+std::optional<FrameDecoder::Field> FrameDecoder::compile_field(const SignalDescriptor& descriptor) {
+    if (descriptor.length == 0 || descriptor.length > 64) {
+        return std::nullopt;
+    }
+
+    Field field{};
+    field.length = descriptor.length;
+    field.motorola = (descriptor.byte_order == ByteOrder::MOTOROLA);
+
+    size_t first_bit;   // Linear position of the first bit in read order
+    if (field.motorola) {
+        // Sawtooth MSB position → linear big-endian bit index (bit 0 = MSB of byte 0)
+        first_bit = (descriptor.start_bit / 8) * 8 + (7 - descriptor.start_bit % 8);
+    } else {
+        first_bit = descriptor.start_bit;
+    }
+
+    size_t last_bit = first_bit + descriptor.length - 1;
+    if (last_bit >= MAX_FRAME_SIZE * 8) {
+        return std::nullopt;
+    }
+
+    field.byte_index = static_cast<uint16_t>(first_bit / 8);
+    field.bit_offset = static_cast<uint8_t>(first_bit % 8);
+    field.last_byte = static_cast<uint16_t>(last_bit / 8);
+    return field;
+}
+
+// Read a field from a padded frame; branch-free apart from byte order
+static inline uint64_t read_field(const uint8_t* frame, uint16_t byte_index, uint8_t bit_offset,
+                                  uint8_t length, bool motorola) {
+    const uint8_t* p = frame + byte_index;
+    uint64_t next = p[8];
+    if (motorola) {
+        // 72-bit big-endian window, drop leading bit_offset bits, keep top length bits
+        uint64_t window = (load_be64(p) << bit_offset) | (next >> (8 - bit_offset));
+        return window >> (64 - length);
+    }
+    // 72-bit little-endian window, drop trailing bit_offset bits, keep low length bits
+    uint64_t window = (load_le64(p) >> bit_offset) | ((next << 1) << (63 - bit_offset));
+    uint64_t mask = (length == 64) ? ~uint64_t{0} : ((uint64_t{1} << length) - 1);
+    return window & mask;
+}
+
+std::optional<uint64_t> extract_bits(
+    const uint8_t* data,
+    size_t size,
+    uint16_t start_bit,
+    uint8_t length,
+    ByteOrder byte_order)
+{
+    uint8_t frame[PADDED_FRAME_SIZE] = {};
+    size = std::min(size, MAX_FRAME_SIZE);
+    std::memcpy(frame, data, size);
+
+    size_t first_bit = (byte_order == ByteOrder::MOTOROLA)
+        ? (start_bit / 8) * 8 + (7 - start_bit % 8)
+        : start_bit;
+    if (length == 0 || length > 64 || first_bit + length > size * 8) {
+        return std::nullopt;
+    }
+    return read_field(frame, static_cast<uint16_t>(first_bit / 8), static_cast<uint8_t>(first_bit % 8),
+                      length, byte_order == ByteOrder::MOTOROLA);
+}
+
+bool FrameDecoder::add_signal(const SignalDescriptor& descriptor) {
+    auto field = compile_field(descriptor);
+    if (!field.has_value()) {
+        return false;
+    }
+    bool is_enum = descriptor.target_type == ValueType::STRING && descriptor.value_table;
+    if (!is_enum && !is_decodable_type(descriptor.target_type)) {
+        return false;
+    }
+
+    if (tables_.empty()) {
+        tables_.emplace_back();  // Non-multiplexed signals
+    }
+
+    // tables_[1..] are kept sorted by multiplexor value
+    Table* table = &tables_[0];
+    if (descriptor.multiplex_value.has_value()) {
+        uint64_t mux = *descriptor.multiplex_value;
+        auto it = std::lower_bound(tables_.begin() + 1, tables_.end(), mux,
+            [](const Table& t, uint64_t value) { return *t.multiplex_value < value; });
+        if (it == tables_.end() || *it->multiplex_value != mux) {
+            it = tables_.emplace(it);
+            it->multiplex_value = mux;
+        }
+        table = &*it;
+    }
+
+    table->fields.push_back(*field);
+    table->sign_bits.push_back(descriptor.is_signed ? (uint64_t{1} << (descriptor.length - 1)) : 0);
+    table->scales.push_back(descriptor.scale);
+    table->offsets.push_back(descriptor.offset);
+    table->targets.push_back(descriptor.target_type);
+    table->slots.push_back(descriptor.slot);
+    table->identity.push_back(descriptor.scale == 1.0 && descriptor.offset == 0.0);
+    table->value_tables.push_back(is_enum ? descriptor.value_table : nullptr);
+
+    slot_count_ = std::max(slot_count_, descriptor.slot + 1);
+    return true;
+}
+
+bool FrameDecoder::set_multiplexor(const SignalDescriptor& descriptor) {
+    auto field = compile_field(descriptor);
+    if (!field.has_value()) {
+        return false;
+    }
+    multiplexor_ = field;
+    return true;
+}
+
+size_t FrameDecoder::signal_count() const noexcept {
+    size_t count = 0;
+    for (const auto& table : tables_) {
+        count += table.fields.size();
+    }
+    return count;
+}
+
+void FrameDecoder::clear() {
+    tables_.clear();
+    multiplexor_.reset();
+    slot_count_ = 0;
+}
+
+size_t FrameDecoder::decode(
+    const uint8_t* data,
+    size_t size,
+    std::vector<DynamicQualifiedValue>& slots,
+    std::chrono::system_clock::time_point timestamp) const
+{
+    if (tables_.empty()) {
+        return 0;
+    }
+    if (slots.size() < slot_count_) {
+        slots.resize(slot_count_);
+    }
+
+    uint8_t frame[PADDED_FRAME_SIZE] = {};
+    size = std::min(size, MAX_FRAME_SIZE);
+    std::memcpy(frame, data, size);
+
+    size_t written = decode_table(tables_[0], frame, size, slots, timestamp);
+
+    if (multiplexor_.has_value() && multiplexor_->last_byte < size && tables_.size() > 1) {
+        uint64_t mux = read_field(frame, multiplexor_->byte_index, multiplexor_->bit_offset,
+                                  multiplexor_->length, multiplexor_->motorola);
+        auto it = std::lower_bound(tables_.begin() + 1, tables_.end(), mux,
+            [](const Table& t, uint64_t value) { return *t.multiplex_value < value; });
+        if (it != tables_.end() && *it->multiplex_value == mux) {
+            written += decode_table(*it, frame, size, slots, timestamp);
+        }
+    }
+
+    if (LatencyRecorder* recorder = stage_recorder(PipelineStage::DECODE)) {
+        recorder->record_age(timestamp, vss::types::now(), written);
+    }
+    return written;
+}
+
+template<typename T>
+static inline bool store_rounded(Value& out, double physical) {
+    // Bounds are powers of two, exactly representable as double
+    // (signed: 2^(N-1), unsigned: 2^N)
+    constexpr double limit = (static_cast<double>(std::numeric_limits<T>::max() / 2) + 1.0) * 2.0;
+    constexpr double lower = std::is_signed_v<T> ? -limit : 0.0;
+
+    double rounded = std::nearbyint(physical);
+    if (!(rounded >= lower && rounded < limit)) {
+        return false;  // Out of range or NaN
+    }
+    out = static_cast<T>(rounded);
+    return true;
+}
+
+template<typename T>
+static inline bool store_exact(Value& out, int64_t signed_raw, uint64_t raw, bool is_signed) {
+    if (is_signed) {
+        if (signed_raw < static_cast<int64_t>(std::numeric_limits<T>::min()) ||
+            (signed_raw > 0 && static_cast<uint64_t>(signed_raw) > static_cast<uint64_t>(std::numeric_limits<T>::max()))) {
+            return false;
+        }
+        out = static_cast<T>(signed_raw);
+    } else {
+        if (raw > static_cast<uint64_t>(std::numeric_limits<T>::max())) {
+            return false;
+        }
+        out = static_cast<T>(raw);
+    }
+    return true;
+}
+
+template<typename T>
+static inline bool store_integer(Value& out, bool identity, int64_t signed_raw, uint64_t raw,
+                                 bool is_signed, double physical) {
+    return identity ? store_exact<T>(out, signed_raw, raw, is_signed)
+                    : store_rounded<T>(out, physical);
+}
+
+static inline bool store_enum(Value& out, const std::shared_ptr<const EnumDictionary>& table, uint64_t raw) {
+    if (raw >= table->size()) {
+        return false;
+    }
+    // Reuse the slot's dictionary reference when possible
+    if (auto e = std::get_if<EnumValue>(&out); e && e->dictionary == table) {
+        e->code = static_cast<uint16_t>(raw);
+    } else {
+        out = EnumValue{table, static_cast<uint16_t>(raw)};
+    }
+    return true;
+}
+
+size_t FrameDecoder::decode_table(
+    const Table& table,
+    const uint8_t* frame,
+    size_t size,
+    std::vector<DynamicQualifiedValue>& slots,
+    std::chrono::system_clock::time_point timestamp) const
+{
+    uint64_t raw[BLOCK_SIZE];
+    int64_t signed_raw[BLOCK_SIZE];
+    double physical[BLOCK_SIZE];
+
+    const size_t count = table.fields.size();
+    for (size_t base = 0; base < count; base += BLOCK_SIZE) {
+        const size_t n = std::min(BLOCK_SIZE, count - base);
+        const Field* fields = table.fields.data() + base;
+        const uint64_t* sign_bits = table.sign_bits.data() + base;
+        const double* scales = table.scales.data() + base;
+        const double* offsets = table.offsets.data() + base;
+
+        // Pass 1: extract raw bits
+        for (size_t i = 0; i < n; ++i) {
+            raw[i] = read_field(frame, fields[i].byte_index, fields[i].bit_offset,
+                                fields[i].length, fields[i].motorola);
+        }
+
+        // Pass 2: sign-extend ((x ^ s) - s is a no-op when s == 0) and scale
+        for (size_t i = 0; i < n; ++i) {
+            uint64_t s = sign_bits[i];
+            signed_raw[i] = static_cast<int64_t>((raw[i] ^ s) - s);
+        }
+        for (size_t i = 0; i < n; ++i) {
+            double x = sign_bits[i] ? static_cast<double>(signed_raw[i])
+                                    : static_cast<double>(raw[i]);
+            physical[i] = x * scales[i] + offsets[i];
+        }
+
+        // Pass 3: store into slots
+        for (size_t i = 0; i < n; ++i) {
+            DynamicQualifiedValue& slot = slots[table.slots[base + i]];
+            slot.timestamp = timestamp;
+
+            if (fields[i].last_byte >= size) {
+                slot.value = std::monostate{};
+                slot.quality = SignalQuality::NOT_AVAILABLE;
+                continue;
+            }
+
+            bool identity = table.identity[base + i];
+            bool is_signed = sign_bits[i] != 0;
+            bool ok = true;
+            switch (table.targets[base + i]) {
+                case ValueType::BOOL:   slot.value = (physical[i] != 0.0); break;
+                case ValueType::FLOAT:  slot.value = static_cast<float>(physical[i]); break;
+                case ValueType::DOUBLE: slot.value = physical[i]; break;
+                case ValueType::INT8:   ok = store_integer<int8_t>(slot.value, identity, signed_raw[i], raw[i], is_signed, physical[i]); break;
+                case ValueType::INT16:  ok = store_integer<int16_t>(slot.value, identity, signed_raw[i], raw[i], is_signed, physical[i]); break;
+                case ValueType::INT32:  ok = store_integer<int32_t>(slot.value, identity, signed_raw[i], raw[i], is_signed, physical[i]); break;
+                case ValueType::INT64:  ok = store_integer<int64_t>(slot.value, identity, signed_raw[i], raw[i], is_signed, physical[i]); break;
+                case ValueType::UINT8:  ok = store_integer<uint8_t>(slot.value, identity, signed_raw[i], raw[i], is_signed, physical[i]); break;
+                case ValueType::UINT16: ok = store_integer<uint16_t>(slot.value, identity, signed_raw[i], raw[i], is_signed, physical[i]); break;
+                case ValueType::UINT32: ok = store_integer<uint32_t>(slot.value, identity, signed_raw[i], raw[i], is_signed, physical[i]); break;
+                case ValueType::UINT64: ok = store_integer<uint64_t>(slot.value, identity, signed_raw[i], raw[i], is_signed, physical[i]); break;
+                case ValueType::STRING: ok = store_enum(slot.value, table.value_tables[base + i], raw[i]); break;
+                default:                ok = false; break;
+            }
+
+            if (ok) {
+                slot.quality = SignalQuality::VALID;
+            } else {
+                slot.value = std::monostate{};
+                slot.quality = SignalQuality::INVALID;
+            }
+        }
+    }
+
+    return count;
+}
+
+} // namespace vss::types
@@ -0,0 +1,377 @@
+/**
+ * @file derived.cpp
+ * @brief Implementation of the derived-signal graph
+ */
+
+#include <vss/types/derived.hpp>
+#include <algorithm>
+#include <limits>
+
+namespace vss::types {
+
+namespace {
+
+// Order of quality severity used to combine input qualities
+int severity(SignalQuality quality) {
+    switch (quality) {
+        case SignalQuality::VALID:          return 0;
+        case SignalQuality::UNKNOWN:        return 1;
+        case SignalQuality::NOT_AVAILABLE:  return 2;
+        case SignalQuality::INVALID:        return 3;
+    }
+    return 1;
+}
+
+SignalQuality worse(SignalQuality a, SignalQuality b) {
+    return severity(b) > severity(a) ? b : a;
+}
+
+} // namespace
+
+DerivedGraph::DerivedGraph(size_t threads) {
+    if (threads > 0) {
+        pool_ = std::make_unique<WorkStealingPool>(threads);
+    }
+}
+
+std::optional<size_t> DerivedGraph::add_node(DerivedNode node) {
+    if (node.output == INVALID_SIGNAL_ID || !node.compute) {
+        return std::nullopt;
+    }
+    for (SignalId input : node.inputs) {
+        if (input == INVALID_SIGNAL_ID || input == node.output) {
+            return std::nullopt;
+        }
+    }
+
+    ensure_signal(node.output);
+    if (producer_[node.output] != NO_NODE) {
+        return std::nullopt;
+    }
+
+    producer_[node.output] = nodes_.size();
+    nodes_.push_back(std::move(node));
+    built_ = false;
+    return nodes_.size() - 1;
+}
+
+bool DerivedGraph::build() {
+    built_ = false;
+    const size_t n = nodes_.size();
+    for (const auto& node : nodes_) {
+        for (SignalId input : node.inputs) {
+            ensure_signal(input);
+        }
+    }
+
+    // Signal -> consuming nodes, and node -> successor nodes (CSR)
+    const size_t signals = values_.size();
+    consumer_offsets_.assign(signals + 1, 0);
+    successor_offsets_.assign(n + 1, 0);
+    std::vector<size_t> indegree(n, 0);
+    for (size_t i = 0; i < n; ++i) {
+        for (SignalId input : nodes_[i].inputs) {
+            ++consumer_offsets_[input + 1];
+            if (producer_[input] != NO_NODE) {
+                ++successor_offsets_[producer_[input] + 1];
+                ++indegree[i];
+            }
+        }
+    }
+    for (size_t s = 0; s < signals; ++s) {
+        consumer_offsets_[s + 1] += consumer_offsets_[s];
+    }
+    for (size_t i = 0; i < n; ++i) {
+        successor_offsets_[i + 1] += successor_offsets_[i];
+    }
+    consumers_.resize(consumer_offsets_[signals]);
+    successors_.resize(successor_offsets_[n]);
+    {
+        std::vector<size_t> consumer_fill(consumer_offsets_.begin(), consumer_offsets_.end() - 1);
+        std::vector<size_t> successor_fill(successor_offsets_.begin(), successor_offsets_.end() - 1);
+        for (size_t i = 0; i < n; ++i) {
+            for (SignalId input : nodes_[i].inputs) {
+                consumers_[consumer_fill[input]++] = i;
+                if (producer_[input] != NO_NODE) {
+                    successors_[successor_fill[producer_[input]]++] = i;
+                }
+            }
+        }
+    }
+
+    // Kahn's algorithm; nodes left over are part of a cycle
+    rank_.assign(n, 0);
+    std::vector<size_t> ready;
+    ready.reserve(n);
+    for (size_t i = 0; i < n; ++i) {
+        if (indegree[i] == 0) {
+            ready.push_back(i);
+        }
+    }
+    for (size_t head = 0; head < ready.size(); ++head) {
+        const size_t node = ready[head];
+        rank_[node] = static_cast<uint32_t>(head);
+        for (size_t k = successor_offsets_[node]; k < successor_offsets_[node + 1]; ++k) {
+            if (--indegree[successors_[k]] == 0) {
+                ready.push_back(successors_[k]);
+            }
+        }
+    }
+    if (ready.size() != n) {
+        return false;
+    }
+
+    dirty_.assign(n, 1);
+    dirty_nodes_ = std::move(ready);
+    queued_.assign(n, 0);
+    changed_.assign(n, 0);
+    queue_.clear();
+    queue_.reserve(n);
+    affected_.clear();
+    affected_.reserve(n);
+    pending_ = std::make_unique<std::atomic<uint32_t>[]>(n);
+    built_ = true;
+    return true;
+}
+
+void DerivedGraph::set_threshold(SignalId id, double threshold) {
+    if (id == INVALID_SIGNAL_ID) {
+        return;
+    }
+    ensure_signal(id);
+    thresholds_[id] = threshold;
+}
+
+bool DerivedGraph::update(SignalId id, const DynamicQualifiedValue& sample) {
+    if (id == INVALID_SIGNAL_ID) {
+        return false;
+    }
+    ensure_signal(id);
+    if (!store(id, sample) || !built_ || id + 1 >= consumer_offsets_.size()) {
+        return false;
+    }
+
+    bool marked = false;
+    for (size_t k = consumer_offsets_[id]; k < consumer_offsets_[id + 1]; ++k) {
+        const size_t node = consumers_[k];
+        marked = true;
+        if (!dirty_[node]) {
+            dirty_[node] = 1;
+            dirty_nodes_.push_back(node);
+        }
+    }
+    return marked;
+}
+
+size_t DerivedGraph::evaluate(std::vector<SignalUpdate>* changed) {
+    if (!built_ && !build()) {
+        return 0;
+    }
+    if (dirty_nodes_.empty()) {
+        return 0;
+    }
+
+    const size_t evaluated = pool_ ? evaluate_parallel() : evaluate_serial();
+
+    // affected_ holds the visited nodes in topological order
+    for (size_t node : affected_) {
+        if (changed && changed_[node]) {
+            const SignalId output = nodes_[node].output;
+            changed->emplace_back(output, values_[output]);
+        }
+        changed_[node] = 0;
+    }
+    affected_.clear();
+    return evaluated;
+}
+
+const DynamicQualifiedValue* DerivedGraph::value(SignalId id) const noexcept {
+    if (id >= known_.size() || !known_[id]) {
+        return nullptr;
+    }
+    return &values_[id];
+}
+
+size_t DerivedGraph::dirty_count() const noexcept {
+    return dirty_nodes_.size();
+}
+
+void DerivedGraph::ensure_signal(SignalId id) {
+    if (id < values_.size()) {
+        return;
+    }
+    const size_t size = static_cast<size_t>(id) + 1;
+    values_.resize(size, DynamicQualifiedValue{Value{}, SignalQuality::UNKNOWN,
+                                               std::chrono::system_clock::time_point{}});
+    known_.resize(size, 0);
+    thresholds_.resize(size, 0.0);
+    producer_.resize(size, NO_NODE);
+}
+
+double DerivedGraph::threshold(SignalId id) const noexcept {
+    return thresholds_[id];
+}
+
+bool DerivedGraph::store(SignalId id, const DynamicQualifiedValue& sample) {
+    DynamicQualifiedValue& current = values_[id];
+    if (known_[id] && current.quality == sample.quality &&
+        !value_changed_beyond_threshold(current.value, sample.value, threshold(id))) {
+        current.timestamp = sample.timestamp;
+        return false;
+    }
+    current = sample;
+    known_[id] = 1;
+    return true;
+}
+
+bool DerivedGraph::evaluate_node(size_t index) {
+    const DerivedNode& node = nodes_[index];
+
+    SignalQuality quality = SignalQuality::VALID;
+    auto timestamp = std::chrono::system_clock::time_point::min();
+    for (SignalId input : node.inputs) {
+        if (!known_[input]) {
+            quality = worse(quality, SignalQuality::NOT_AVAILABLE);
+            continue;
+        }
+        quality = worse(quality, values_[input].quality);
+        timestamp = std::max(timestamp, values_[input].timestamp);
+    }
+    if (timestamp == std::chrono::system_clock::time_point::min()) {
+        timestamp = vss::types::now();
+    }
+
+    Value result;
+    if (quality == SignalQuality::VALID || !node.require_valid) {
+        result = node.compute(DerivedInputs{values_.data(), node.inputs.data(), node.inputs.size()});
+    }
+    if (is_empty(result) && quality == SignalQuality::VALID) {
+        quality = SignalQuality::NOT_AVAILABLE;
+    }
+
+    DynamicQualifiedValue& current = values_[node.output];
+    if (known_[node.output] && current.quality == quality &&
+        !value_changed_beyond_threshold(current.value, result, threshold(node.output))) {
+        current.timestamp = timestamp;
+        return false;
+    }
+    current.value = std::move(result);
+    current.quality = quality;
+    current.timestamp = timestamp;
+    known_[node.output] = 1;
+    return true;
+}
+
+size_t DerivedGraph::evaluate_serial() {
+    // Min-heap on topological rank: every node is evaluated after all of
+    // its dirty predecessors, and only nodes reached by a change are visited
+    const auto later = [this](size_t a, size_t b) { return rank_[a] > rank_[b]; };
+
+    queue_.clear();
+    for (size_t node : dirty_nodes_) {
+        queued_[node] = 1;
+        queue_.push_back(node);
+    }
+    dirty_nodes_.clear();
+    std::make_heap(queue_.begin(), queue_.end(), later);
+
+    size_t evaluated = 0;
+    while (!queue_.empty()) {
+        std::pop_heap(queue_.begin(), queue_.end(), later);
+        const size_t node = queue_.back();
+        queue_.pop_back();
+        queued_[node] = 0;
+        dirty_[node] = 0;
+        affected_.push_back(node);
+
+        ++evaluated;
+        if (!evaluate_node(node)) {
+            continue;
+        }
+        changed_[node] = 1;
+        for (size_t k = successor_offsets_[node]; k < successor_offsets_[node + 1]; ++k) {
+            const size_t next = successors_[k];
+            if (!queued_[next]) {
+                queued_[next] = 1;
+                queue_.push_back(next);
+                std::push_heap(queue_.begin(), queue_.end(), later);
+            }
+        }
+    }
+    return evaluated;
+}
+
+size_t DerivedGraph::evaluate_parallel() {
+    // Everything reachable from a dirty node may need evaluation; whether
+    // it actually does is decided once its predecessors are done
+    queue_.assign(dirty_nodes_.begin(), dirty_nodes_.end());
+    dirty_nodes_.clear();
+    while (!queue_.empty()) {
+        const size_t node = queue_.back();
+        queue_.pop_back();
+        if (queued_[node]) {
+            continue;
+        }
+        queued_[node] = 1;
+        affected_.push_back(node);
+        for (size_t k = successor_offsets_[node]; k < successor_offsets_[node + 1]; ++k) {
+            if (!queued_[successors_[k]]) {
+                queue_.push_back(successors_[k]);
+            }
+        }
+    }
+
+    for (size_t node : affected_) {
+        pending_[node].store(0, std::memory_order_relaxed);
+    }
+    for (size_t node : affected_) {
+        for (size_t k = successor_offsets_[node]; k < successor_offsets_[node + 1]; ++k) {
+            pending_[successors_[k]].fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    // Collect the roots before submitting any: running tasks already
+    // bring other pending counts to zero
+    queue_.clear();
+    for (size_t node : affected_) {
+        if (pending_[node].load(std::memory_order_relaxed) == 0) {
+            queue_.push_back(node);
+        }
+    }
+    evaluated_.store(0, std::memory_order_relaxed);
+    for (size_t node : queue_) {
+        pool_->submit([this, node] { run_parallel(node); });
+    }
+    pool_->wait();
+
+    std::sort(affected_.begin(), affected_.end(),
+              [this](size_t a, size_t b) { return rank_[a] < rank_[b]; });
+    for (size_t node : affected_) {
+        queued_[node] = 0;
+        dirty_[node] = 0;
+    }
+    return evaluated_.load(std::memory_order_relaxed);
+}
+
+void DerivedGraph::run_parallel(size_t node) {
+    // Predecessors have finished (pending_ reached zero), so their
+    // changed_ flags and outputs are visible here
+    bool run = dirty_[node] != 0;
+    for (size_t i = 0; !run && i < nodes_[node].inputs.size(); ++i) {
+        const size_t producer = producer_[nodes_[node].inputs[i]];
+        run = producer != NO_NODE && changed_[producer];
+    }
+    if (run) {
+        evaluated_.fetch_add(1, std::memory_order_relaxed);
+        changed_[node] = evaluate_node(node) ? 1 : 0;
+    }
+
+    for (size_t k = successor_offsets_[node]; k < successor_offsets_[node + 1]; ++k) {
+        const size_t next = successors_[k];
+        if (pending_[next].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            pool_->submit([this, next] { run_parallel(next); });
+        }
+    }
+}
+
+} // namespace vss::types
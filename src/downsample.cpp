@@ -0,0 +1,298 @@
+/**
+ * @file downsample.cpp
+ * @brief Implementation of signal history downsampling
+ */
+
+#include <vss/types/downsample.hpp>
+#include <vss/types/clock.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cmath>
+#include <limits>
+#include <thread>
+
+namespace vss::types {
+
+namespace {
+
+using detail::to_ns;
+using detail::from_ns;
+
+using TimePoint = std::chrono::system_clock::time_point;
+
+bool usable(const SeriesView& in, size_t i) noexcept {
+    return in.quality(i) == SignalQuality::VALID && !std::isnan(in.values[i]);
+}
+
+void append_sample(const SeriesView& in, size_t i, SignalSeries& out) {
+    out.append(in.timestamps[i], in.values[i], in.quality(i));
+}
+
+size_t copy_all(const SeriesView& in, SignalSeries& out) {
+    out.reserve(out.size() + in.size);
+    for (size_t i = 0; i < in.size; ++i) {
+        append_sample(in, i, out);
+    }
+    return in.size;
+}
+
+int64_t floor_div(int64_t a, int64_t b) noexcept {
+    int64_t q = a / b;
+    return (a % b != 0 && (a < 0) != (b < 0)) ? q - 1 : q;
+}
+
+} // namespace
+
+const char* downsample_method_to_string(DownsampleMethod method) {
+    switch (method) {
+        case DownsampleMethod::LTTB:    return "LTTB";
+        case DownsampleMethod::MIN_MAX: return "MIN_MAX";
+        case DownsampleMethod::AVERAGE: return "AVERAGE";
+        default:                        return "UNKNOWN";
+    }
+}
+
+std::optional<DownsampleMethod> downsample_method_from_string(const std::string& str) {
+    // Convert to uppercase for case-insensitive matching
+    std::string upper = str;
+    std::transform(upper.begin(), upper.end(), upper.begin(),
+                   [](unsigned char c){ return std::toupper(c); });
+
+    if (upper == "LTTB") return DownsampleMethod::LTTB;
+    if (upper == "MIN_MAX" || upper == "MINMAX") return DownsampleMethod::MIN_MAX;
+    if (upper == "AVERAGE" || upper == "AVG") return DownsampleMethod::AVERAGE;
+
+    return std::nullopt;
+}
+
+size_t downsample_lttb(const SeriesView& in, size_t threshold, SignalSeries& out) {
+    const size_t n = in.size;
+    if (threshold >= n || threshold < 3) {
+        return copy_all(in, out);
+    }
+
+    // Time as double nanoseconds relative to the first sample keeps the
+    // triangle areas well conditioned
+    const TimePoint origin = in.timestamps[0];
+    auto x = [&](size_t i) {
+        return static_cast<double>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(in.timestamps[i] - origin).count());
+    };
+
+    out.reserve(out.size() + threshold);
+    append_sample(in, 0, out);
+
+    const size_t buckets = threshold - 2;
+    const double every = static_cast<double>(n - 2) / static_cast<double>(buckets);
+    auto bucket_start = [&](size_t b) {
+        return std::min(static_cast<size_t>(static_cast<double>(b) * every) + 1, n - 1);
+    };
+
+    // Previously selected point
+    double ax = x(0);
+    double ay = in.values[0];
+    bool a_valid = usable(in, 0);
+
+    for (size_t b = 0; b < buckets; ++b) {
+        const size_t start = bucket_start(b);
+        const size_t end = (b + 1 == buckets) ? n - 1 : bucket_start(b + 1);
+
+        // Average of the next bucket (the last point after the final bucket)
+        const size_t next_start = end;
+        const size_t next_end = (b + 1 == buckets) ? n : std::max(bucket_start(b + 2), next_start + 1);
+        double sx = 0.0;
+        double sy = 0.0;
+        size_t valid = 0;
+        for (size_t i = next_start; i < next_end; ++i) {
+            if (usable(in, i)) {
+                sx += x(i);
+                sy += in.values[i];
+                ++valid;
+            }
+        }
+
+        double cx;
+        double cy;
+        if (valid > 0) {
+            cx = sx / static_cast<double>(valid);
+            cy = sy / static_cast<double>(valid);
+        } else {
+            // Nothing to aim at: a flat line through the previous point
+            cx = x(next_end - 1);
+            cy = ay;
+        }
+        // Without a valid previous point, rank by distance from the next average
+        const double ref_y = a_valid ? ay : cy;
+
+        size_t best = n;
+        double best_area = -1.0;
+        for (size_t i = start; i < end; ++i) {
+            if (!usable(in, i)) {
+                continue;
+            }
+            double area = std::fabs((ax - cx) * (in.values[i] - ref_y) - (ax - x(i)) * (cy - ref_y));
+            if (area > best_area) {
+                best_area = area;
+                best = i;
+            }
+        }
+
+        if (best == n) {
+            // Gap: keep one sample so the missing data remains visible
+            append_sample(in, start, out);
+            continue;
+        }
+
+        append_sample(in, best, out);
+        ax = x(best);
+        ay = in.values[best];
+        a_valid = true;
+    }
+
+    append_sample(in, n - 1, out);
+    return threshold;
+}
+
+size_t downsample_min_max(const SeriesView& in, size_t max_points, SignalSeries& out) {
+    const size_t n = in.size;
+    if (max_points >= n || max_points < 2) {
+        return copy_all(in, out);
+    }
+
+    const size_t buckets = max_points / 2;
+    const double every = static_cast<double>(n) / static_cast<double>(buckets);
+    const size_t before = out.size();
+    out.reserve(before + 2 * buckets);
+
+    size_t start = 0;
+    for (size_t b = 0; b < buckets; ++b) {
+        const size_t end = (b + 1 == buckets) ? n : static_cast<size_t>(static_cast<double>(b + 1) * every);
+
+        size_t min_i = n;
+        size_t max_i = n;
+        double lo = std::numeric_limits<double>::infinity();
+        double hi = -std::numeric_limits<double>::infinity();
+        for (size_t i = start; i < end; ++i) {
+            if (!usable(in, i)) {
+                continue;
+            }
+            const double v = in.values[i];
+            if (v < lo) {
+                lo = v;
+                min_i = i;
+            }
+            if (v > hi) {
+                hi = v;
+                max_i = i;
+            }
+        }
+
+        if (min_i == n) {
+            if (start < end) {
+                append_sample(in, start, out);
+            }
+        } else if (min_i == max_i) {
+            append_sample(in, min_i, out);
+        } else {
+            append_sample(in, std::min(min_i, max_i), out);
+            append_sample(in, std::max(min_i, max_i), out);
+        }
+        start = end;
+    }
+
+    return out.size() - before;
+}
+
+size_t downsample_average(const SeriesView& in, std::chrono::nanoseconds bucket_width, SignalSeries& out) {
+    const size_t n = in.size;
+    const int64_t width = bucket_width.count();
+    if (width <= 0) {
+        return copy_all(in, out);
+    }
+    if (n == 0) {
+        return 0;
+    }
+
+    const size_t before = out.size();
+    int64_t bucket = floor_div(to_ns(in.timestamps[0]), width);
+    double sum = 0.0;
+    size_t count = 0;
+    SignalQuality first_quality = in.quality(0);
+
+    auto emit = [&]() {
+        const TimePoint start = from_ns(bucket * width);
+        if (count > 0) {
+            out.append(start, sum / static_cast<double>(count), SignalQuality::VALID);
+        } else {
+            out.append(start, std::numeric_limits<double>::quiet_NaN(),
+                       first_quality == SignalQuality::VALID ? SignalQuality::NOT_AVAILABLE : first_quality);
+        }
+    };
+
+    for (size_t i = 0; i < n; ++i) {
+        const int64_t k = floor_div(to_ns(in.timestamps[i]), width);
+        if (k != bucket) {
+            emit();
+            bucket = k;
+            sum = 0.0;
+            count = 0;
+            first_quality = in.quality(i);
+        }
+        if (usable(in, i)) {
+            sum += in.values[i];
+            ++count;
+        }
+    }
+    emit();
+
+    return out.size() - before;
+}
+
+size_t downsample(const SeriesView& in, const DownsampleSpec& spec, SignalSeries& out) {
+    switch (spec.method) {
+        case DownsampleMethod::LTTB:    return downsample_lttb(in, spec.points, out);
+        case DownsampleMethod::MIN_MAX: return downsample_min_max(in, spec.points, out);
+        case DownsampleMethod::AVERAGE: return downsample_average(in, spec.bucket_width, out);
+        default:                        return copy_all(in, out);
+    }
+}
+
+std::vector<SignalSeries> downsample_many(
+    const std::vector<SeriesView>& inputs,
+    const DownsampleSpec& spec,
+    size_t threads) {
+
+    std::vector<SignalSeries> results(inputs.size());
+    if (inputs.empty()) {
+        return results;
+    }
+
+    if (threads == 0) {
+        threads = std::max<size_t>(1, std::thread::hardware_concurrency());
+    }
+    threads = std::min(threads, inputs.size());
+
+    // Signals are handed out one at a time, so long histories balance out
+    std::atomic<size_t> next{0};
+    auto worker = [&]() {
+        for (size_t i = next.fetch_add(1, std::memory_order_relaxed); i < inputs.size();
+             i = next.fetch_add(1, std::memory_order_relaxed)) {
+            downsample(inputs[i], spec, results[i]);
+        }
+    };
+
+    std::vector<std::thread> pool;
+    pool.reserve(threads - 1);
+    for (size_t t = 1; t < threads; ++t) {
+        pool.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : pool) {
+        thread.join();
+    }
+
+    return results;
+}
+
+} // namespace vss::types
@@ -0,0 +1,101 @@
+/**
+ * @file enum.cpp
+ * @brief Implementation of dictionary-encoded strings
+ */
+
+#include <vss/types/enum.hpp>
+
+namespace vss::types {
+
+static const std::string EMPTY_STRING;
+
+const std::string& EnumValue::str() const {
+    return dictionary ? dictionary->name(code) : EMPTY_STRING;
+}
+
+bool EnumValue::operator==(const EnumValue& other) const {
+    if (dictionary == other.dictionary) {
+        return code == other.code;
+    }
+    return str() == other.str();
+}
+
+EnumDictionary::EnumDictionary(std::vector<std::string> values)
+    : values_(std::move(values))
+{
+    index_.reserve(values_.size());
+    for (size_t i = 0; i < values_.size(); ++i) {
+        index_.emplace(values_[i], static_cast<uint16_t>(i));
+    }
+}
+
+std::shared_ptr<const EnumDictionary> EnumDictionary::create(std::vector<std::string> values) {
+    if (values.empty() || values.size() > MAX_SIZE) {
+        return nullptr;
+    }
+    // Constructor is private, so make_shared is not available
+    std::shared_ptr<EnumDictionary> dictionary{new EnumDictionary(std::move(values))};
+    if (dictionary->index_.size() != dictionary->values_.size()) {
+        return nullptr;  // Duplicates
+    }
+    return dictionary;
+}
+
+std::shared_ptr<const EnumDictionary> EnumDictionary::from_constraints(const ValueConstraints& constraints) {
+    std::vector<std::string> values;
+    for (const auto& allowed : constraints.allowed) {
+        if (auto s = std::get_if<std::string>(&allowed)) {
+            values.push_back(*s);
+        } else if (auto e = std::get_if<EnumValue>(&allowed)) {
+            values.push_back(e->str());
+        } else if (auto list = std::get_if<std::vector<std::string>>(&allowed)) {
+            values.insert(values.end(), list->begin(), list->end());
+        }
+    }
+    return create(std::move(values));
+}
+
+std::optional<uint16_t> EnumDictionary::code(std::string_view text) const {
+    auto it = index_.find(text);
+    if (it == index_.end()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+const std::string& EnumDictionary::name(uint16_t code) const noexcept {
+    return code < values_.size() ? values_[code] : EMPTY_STRING;
+}
+
+Value EnumDictionary::encode(std::string_view text) const {
+    auto c = code(text);
+    if (!c.has_value()) {
+        return Value{std::monostate{}};
+    }
+    return Value{EnumValue{shared_from_this(), *c}};
+}
+
+Value encode_enum(const Value& value, const std::shared_ptr<const EnumDictionary>& dictionary) {
+    if (!dictionary) {
+        return Value{std::monostate{}};
+    }
+    if (auto e = std::get_if<EnumValue>(&value)) {
+        if (e->dictionary == dictionary) {
+            return value;
+        }
+        return dictionary->encode(e->str());
+    }
+    if (auto s = std::get_if<std::string>(&value)) {
+        return dictionary->encode(*s);
+    }
+    return Value{std::monostate{}};
+}
+
+Value decode_enum(const Value& value) {
+    if (auto e = std::get_if<EnumValue>(&value)) {
+        return Value{e->str()};
+    }
+    return value;
+}
+
+} // namespace vss::types
@@ -0,0 +1,1316 @@
+/**
+ * @file expression.cpp
+ * @brief Implementation of the expression compiler and evaluator
+ */
+
+#include <vss/types/expression.hpp>
+#include <vss/types/enum.hpp>
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <type_traits>
+
+#if !defined(__cpp_lib_to_chars)
+#include <locale>
+#include <sstream>
+#endif
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define VSS_TYPES_EXPRESSION_AVX2 1
+#endif
+
+namespace vss::types {
+
+using Op = Expression::Op;
+
+namespace {
+
+// Deepest evaluation stack an expression may need
+constexpr size_t MAX_STACK = 64;
+
+// Deepest unary/parenthesis nesting the recursive-descent parser accepts
+constexpr size_t MAX_NESTING = 256;
+
+// Tallest syntax tree; bounds the recursion of emit() and of ~Node()
+constexpr size_t MAX_HEIGHT = 4096;
+
+// Rows evaluated per instruction in batch mode
+constexpr size_t BLOCK_SIZE = 256;
+
+// Static type during compilation; STRING only appears as a comparison operand
+enum class Type { BOOL, NUMBER, STRING };
+
+const char* type_name(Type type) {
+    switch (type) {
+        case Type::BOOL:    return "bool";
+        case Type::NUMBER:  return "number";
+        case Type::STRING:  return "string";
+    }
+    return "unknown";
+}
+
+int severity(SignalQuality quality) {
+    switch (quality) {
+        case SignalQuality::VALID:          return 0;
+        case SignalQuality::UNKNOWN:        return 1;
+        case SignalQuality::NOT_AVAILABLE:  return 2;
+        case SignalQuality::INVALID:        return 3;
+    }
+    return 1;
+}
+
+void degrade(SignalQuality& worst, SignalQuality quality) {
+    if (severity(quality) > severity(worst)) {
+        worst = quality;
+    }
+}
+
+// ============================================================================
+// Lexer
+// ============================================================================
+
+enum class Token {
+    END, NUMBER, STRING, IDENT, LPAREN, RPAREN, COMMA,
+    PLUS, MINUS, STAR, SLASH, BANG, AND, OR,
+    LT, LE, GT, GE, EQ, NE, ERROR
+};
+
+struct Lexeme {
+    Token token = Token::END;
+    size_t position = 0;
+    std::string_view text;
+    double number = 0.0;
+};
+
+// Decimal literal already delimited by the lexer; independent of the C locale
+bool parse_decimal(std::string_view text, double& out) {
+#if defined(__cpp_lib_to_chars)
+    const auto result = std::from_chars(text.data(), text.data() + text.size(), out);
+    return result.ec == std::errc() && result.ptr == text.data() + text.size();
+#else
+    std::istringstream in{std::string(text)};
+    in.imbue(std::locale::classic());
+    in >> out;
+    return !in.fail() && in.peek() == std::char_traits<char>::eof();
+#endif
+}
+
+class Lexer {
+public:
+    explicit Lexer(std::string_view source) : source_(source) {}
+
+    Lexeme next() {
+        while (pos_ < source_.size() && std::isspace(static_cast<unsigned char>(source_[pos_]))) {
+            ++pos_;
+        }
+        Lexeme lex;
+        lex.position = pos_;
+        if (pos_ >= source_.size()) {
+            return lex;
+        }
+
+        const char c = source_[pos_];
+        auto two = [&](char second) { return pos_ + 1 < source_.size() && source_[pos_ + 1] == second; };
+        auto single = [&](Token token, size_t length) {
+            lex.token = token;
+            lex.text = source_.substr(pos_, length);
+            pos_ += length;
+            return lex;
+        };
+
+        if (std::isalpha(static_cast<unsigned char>(c)) || c == '_') {
+            // Identifier or dotted path: segments of letters, digits and '_'
+            size_t end = pos_;
+            while (end < source_.size()) {
+                const char ch = source_[end];
+                if (std::isalnum(static_cast<unsigned char>(ch)) || ch == '_') {
+                    ++end;
+                } else if (ch == '.' && end + 1 < source_.size() &&
+                           (std::isalnum(static_cast<unsigned char>(source_[end + 1])) || source_[end + 1] == '_')) {
+                    ++end;
+                } else {
+                    break;
+                }
+            }
+            return single(Token::IDENT, end - pos_);
+        }
+        if (std::isdigit(static_cast<unsigned char>(c)) || (c == '.' && pos_ + 1 < source_.size() &&
+                                                            std::isdigit(static_cast<unsigned char>(source_[pos_ + 1])))) {
+            // digits [. digits] [e [+-] digits]
+            auto digit = [&](size_t i) {
+                return i < source_.size() && std::isdigit(static_cast<unsigned char>(source_[i]));
+            };
+            size_t end = pos_;
+            while (digit(end)) {
+                ++end;
+            }
+            if (end < source_.size() && source_[end] == '.') {
+                ++end;
+                while (digit(end)) {
+                    ++end;
+                }
+            }
+            if (end < source_.size() && (source_[end] == 'e' || source_[end] == 'E')) {
+                size_t exponent = end + 1;
+                if (exponent < source_.size() && (source_[exponent] == '+' || source_[exponent] == '-')) {
+                    ++exponent;
+                }
+                if (digit(exponent)) {
+                    end = exponent;
+                    while (digit(end)) {
+                        ++end;
+                    }
+                }
+            }
+            // Hex (0x10), hex-float (0x1p3), "1.2.3" and "1e" run on into
+            // letters, digits or a dot
+            if (end < source_.size() && (std::isalnum(static_cast<unsigned char>(source_[end])) ||
+                                         source_[end] == '_' || source_[end] == '.')) {
+                return single(Token::ERROR, end - pos_ + 1);
+            }
+            if (!parse_decimal(source_.substr(pos_, end - pos_), lex.number)) {
+                return single(Token::ERROR, end - pos_);
+            }
+            return single(Token::NUMBER, end - pos_);
+        }
+        if (c == '"' || c == '\'') {
+            const size_t close = source_.find(c, pos_ + 1);
+            if (close == std::string_view::npos) {
+                return single(Token::ERROR, 1);
+            }
+            lex.token = Token::STRING;
+            lex.text = source_.substr(pos_ + 1, close - pos_ - 1);
+            pos_ = close + 1;
+            return lex;
+        }
+
+        switch (c) {
+            case '(': return single(Token::LPAREN, 1);
+            case ')': return single(Token::RPAREN, 1);
+            case ',': return single(Token::COMMA, 1);
+            case '+': return single(Token::PLUS, 1);
+            case '-': return single(Token::MINUS, 1);
+            case '*': return single(Token::STAR, 1);
+            case '/': return single(Token::SLASH, 1);
+            case '<': return two('=') ? single(Token::LE, 2) : single(Token::LT, 1);
+            case '>': return two('=') ? single(Token::GE, 2) : single(Token::GT, 1);
+            case '=': return two('=') ? single(Token::EQ, 2) : single(Token::ERROR, 1);
+            case '!': return two('=') ? single(Token::NE, 2) : single(Token::BANG, 1);
+            case '&': return two('&') ? single(Token::AND, 2) : single(Token::ERROR, 1);
+            case '|': return two('|') ? single(Token::OR, 2) : single(Token::ERROR, 1);
+            default:  return single(Token::ERROR, 1);
+        }
+    }
+
+private:
+    std::string_view source_;
+    size_t pos_ = 0;
+};
+
+// ============================================================================
+// Syntax tree
+// ============================================================================
+
+struct Node {
+    enum class Kind { LITERAL, STRING, SIGNAL, VALID, UNARY, BINARY };
+
+    Kind kind = Kind::LITERAL;
+    Type type = Type::NUMBER;
+    size_t position = 0;
+    size_t height = 1;              ///< Longest path down to a leaf
+    Op op = Op::CONST;              ///< UNARY and BINARY
+    double number = 0.0;            ///< LITERAL (bools as 0/1)
+    std::string text;               ///< STRING
+    uint32_t slot = 0;              ///< SIGNAL and VALID
+    const SignalNode* signal = nullptr;
+    std::unique_ptr<Node> left;
+    std::unique_ptr<Node> right;
+};
+
+Op load_op(ValueType type) {
+    switch (type) {
+        case ValueType::BOOL:   return Op::LOAD_BOOL;
+        case ValueType::INT8:   return Op::LOAD_INT8;
+        case ValueType::INT16:  return Op::LOAD_INT16;
+        case ValueType::INT32:  return Op::LOAD_INT32;
+        case ValueType::INT64:  return Op::LOAD_INT64;
+        case ValueType::UINT8:  return Op::LOAD_UINT8;
+        case ValueType::UINT16: return Op::LOAD_UINT16;
+        case ValueType::UINT32: return Op::LOAD_UINT32;
+        case ValueType::UINT64: return Op::LOAD_UINT64;
+        case ValueType::FLOAT:  return Op::LOAD_FLOAT;
+        default:                return Op::LOAD_DOUBLE;
+    }
+}
+
+// a OP b == b FLIP(OP) a
+Op flip(Op op) {
+    switch (op) {
+        case Op::LT: return Op::GT;
+        case Op::LE: return Op::GE;
+        case Op::GT: return Op::LT;
+        case Op::GE: return Op::LE;
+        default:     return op;
+    }
+}
+
+Op with_constant(Op op) {
+    switch (op) {
+        case Op::LT: return Op::LT_CONST;
+        case Op::LE: return Op::LE_CONST;
+        case Op::GT: return Op::GT_CONST;
+        case Op::GE: return Op::GE_CONST;
+        case Op::EQ: return Op::EQ_CONST;
+        default:     return Op::NE_CONST;
+    }
+}
+
+bool is_comparison(Op op) {
+    return op == Op::LT || op == Op::LE || op == Op::GT || op == Op::GE || op == Op::EQ || op == Op::NE;
+}
+
+} // namespace
+
+// ============================================================================
+// Compiler
+// ============================================================================
+
+/**
+ * @brief Recursive-descent parser, type checker and code generator
+ *
+ * Grammar (lowest precedence first):
+ *   or      := and ('||' and)*
+ *   and     := equality ('&&' equality)*
+ *   equality:= relation (('==' | '!=') relation)*
+ *   relation:= sum (('<' | '<=' | '>' | '>=') sum)*
+ *   sum     := product (('+' | '-') product)*
+ *   product := unary (('*' | '/') unary)*
+ *   unary   := ('-' | '!') unary | primary
+ *   primary := NUMBER | STRING | true | false | PATH | NAME '(' args ')' | '(' or ')'
+ */
+class ExpressionCompiler {
+public:
+    ExpressionCompiler(std::string_view source, const SignalCatalog& catalog, ExpressionError* error)
+        : lexer_(source), catalog_(catalog), error_(error) {
+        current_ = lexer_.next();
+    }
+
+    std::optional<Expression> run(std::string_view source) {
+        auto root = parse_or();
+        if (!root) {
+            return std::nullopt;
+        }
+        if (current_.token != Token::END) {
+            return fail(current_.position, "unexpected input after expression");
+        }
+        if (root->type == Type::STRING) {
+            return fail(root->position, "expression must be a number or bool, not a string");
+        }
+
+        expression_.source_ = std::string(source);
+        expression_.type_ = root->type == Type::BOOL ? ExpressionType::BOOL : ExpressionType::NUMBER;
+        if (!emit(*root)) {
+            return fail(0, "expression is too deeply nested");
+        }
+        return std::move(expression_);
+    }
+
+private:
+    using NodePtr = std::unique_ptr<Node>;
+
+    std::nullopt_t fail(size_t position, std::string message) {
+        if (error_ && !failed_) {
+            error_->position = position;
+            error_->message = std::move(message);
+        }
+        failed_ = true;
+        return std::nullopt;
+    }
+
+    NodePtr error(size_t position, std::string message) {
+        fail(position, std::move(message));
+        return nullptr;
+    }
+
+    void advance() { current_ = lexer_.next(); }
+
+    bool accept(Token token) {
+        if (current_.token != token) {
+            return false;
+        }
+        advance();
+        return true;
+    }
+
+    static NodePtr make(Node::Kind kind, Type type, size_t position) {
+        auto node = std::make_unique<Node>();
+        node->kind = kind;
+        node->type = type;
+        node->position = position;
+        return node;
+    }
+
+    NodePtr binary(Op op, size_t position, NodePtr left, NodePtr right) {
+        const Type lt = left->type;
+        const Type rt = right->type;
+        auto mismatch = [&](const char* what) {
+            return error(position, std::string(what) + " on " + type_name(lt) + " and " + type_name(rt));
+        };
+
+        Type result = Type::BOOL;
+        if (op == Op::AND || op == Op::OR) {
+            if (lt != Type::BOOL || rt != Type::BOOL) {
+                return mismatch(op == Op::AND ? "'&&'" : "'||'");
+            }
+        } else if (op == Op::EQ || op == Op::NE) {
+            if (lt != rt) {
+                return mismatch("comparison");
+            }
+            if (lt == Type::STRING) {
+                return string_compare(op, position, std::move(left), std::move(right));
+            }
+        } else if (is_comparison(op)) {
+            if (lt != Type::NUMBER || rt != Type::NUMBER) {
+                return mismatch("ordering comparison");
+            }
+        } else {
+            if (lt != Type::NUMBER || rt != Type::NUMBER) {
+                return mismatch("arithmetic");
+            }
+            result = Type::NUMBER;
+        }
+
+        const size_t height = std::max(left->height, right->height) + 1;
+        if (height > MAX_HEIGHT) {
+            return error(position, "expression is too deeply nested");
+        }
+        auto node = make(Node::Kind::BINARY, result, position);
+        node->op = op;
+        node->height = height;
+        node->left = std::move(left);
+        node->right = std::move(right);
+        return node;
+    }
+
+    // signal == "text": checked against the signal's allowed values
+    NodePtr string_compare(Op op, size_t position, NodePtr left, NodePtr right) {
+        if (left->kind == Node::Kind::STRING) {
+            std::swap(left, right);
+        }
+        if (left->kind != Node::Kind::SIGNAL || right->kind != Node::Kind::STRING) {
+            return error(position, "strings can only be compared between a signal and a literal");
+        }
+
+        Expression::StringConstant constant;
+        constant.text = right->text;
+        constant.slot = left->slot;
+        constant.dictionary = left->signal->enum_dictionary;
+        if (constant.dictionary) {
+            auto code = constant.dictionary->code(constant.text);
+            if (!code) {
+                return error(right->position, "\"" + constant.text + "\" is not an allowed value of " +
+                                              left->signal->path);
+            }
+            constant.code = *code;
+        }
+
+        auto node = make(Node::Kind::BINARY, Type::BOOL, position);
+        node->op = op == Op::EQ ? Op::STR_EQ : Op::STR_NE;
+        node->slot = static_cast<uint32_t>(expression_.strings_.size());
+        expression_.strings_.push_back(std::move(constant));
+        return node;
+    }
+
+    NodePtr parse_or() {
+        auto left = parse_and();
+        while (left && current_.token == Token::OR) {
+            const size_t position = current_.position;
+            advance();
+            auto right = parse_and();
+            if (!right) {
+                return nullptr;
+            }
+            left = binary(Op::OR, position, std::move(left), std::move(right));
+        }
+        return left;
+    }
+
+    NodePtr parse_and() {
+        auto left = parse_equality();
+        while (left && current_.token == Token::AND) {
+            const size_t position = current_.position;
+            advance();
+            auto right = parse_equality();
+            if (!right) {
+                return nullptr;
+            }
+            left = binary(Op::AND, position, std::move(left), std::move(right));
+        }
+        return left;
+    }
+
+    NodePtr parse_equality() {
+        auto left = parse_relation();
+        while (left && (current_.token == Token::EQ || current_.token == Token::NE)) {
+            const Op op = current_.token == Token::EQ ? Op::EQ : Op::NE;
+            const size_t position = current_.position;
+            advance();
+            auto right = parse_relation();
+            if (!right) {
+                return nullptr;
+            }
+            left = binary(op, position, std::move(left), std::move(right));
+        }
+        return left;
+    }
+
+    NodePtr parse_relation() {
+        auto left = parse_sum();
+        while (left) {
+            Op op;
+            switch (current_.token) {
+                case Token::LT: op = Op::LT; break;
+                case Token::LE: op = Op::LE; break;
+                case Token::GT: op = Op::GT; break;
+                case Token::GE: op = Op::GE; break;
+                default: return left;
+            }
+            const size_t position = current_.position;
+            advance();
+            auto right = parse_sum();
+            if (!right) {
+                return nullptr;
+            }
+            left = binary(op, position, std::move(left), std::move(right));
+        }
+        return left;
+    }
+
+    NodePtr parse_sum() {
+        auto left = parse_product();
+        while (left && (current_.token == Token::PLUS || current_.token == Token::MINUS)) {
+            const Op op = current_.token == Token::PLUS ? Op::ADD : Op::SUB;
+            const size_t position = current_.position;
+            advance();
+            auto right = parse_product();
+            if (!right) {
+                return nullptr;
+            }
+            left = binary(op, position, std::move(left), std::move(right));
+        }
+        return left;
+    }
+
+    NodePtr parse_product() {
+        auto left = parse_unary();
+        while (left && (current_.token == Token::STAR || current_.token == Token::SLASH)) {
+            const Op op = current_.token == Token::STAR ? Op::MUL : Op::DIV;
+            const size_t position = current_.position;
+            advance();
+            auto right = parse_unary();
+            if (!right) {
+                return nullptr;
+            }
+            left = binary(op, position, std::move(left), std::move(right));
+        }
+        return left;
+    }
+
+    NodePtr parse_unary() {
+        if (nesting_ == MAX_NESTING) {
+            return error(current_.position, "expression is too deeply nested");
+        }
+        ++nesting_;
+        auto node = parse_nested_unary();
+        --nesting_;
+        return node;
+    }
+
+    NodePtr parse_nested_unary() {
+        const size_t position = current_.position;
+        if (accept(Token::MINUS)) {
+            auto operand = parse_unary();
+            if (!operand) {
+                return nullptr;
+            }
+            if (operand->type != Type::NUMBER) {
+                return error(position, std::string("'-' on ") + type_name(operand->type));
+            }
+            if (operand->kind == Node::Kind::LITERAL) {
+                operand->number = -operand->number;
+                operand->position = position;
+                return operand;
+            }
+            auto node = make(Node::Kind::UNARY, Type::NUMBER, position);
+            node->op = Op::NEG;
+            node->height = operand->height + 1;
+            node->left = std::move(operand);
+            return node;
+        }
+        if (accept(Token::BANG)) {
+            auto operand = parse_unary();
+            if (!operand) {
+                return nullptr;
+            }
+            if (operand->type != Type::BOOL) {
+                return error(position, std::string("'!' on ") + type_name(operand->type));
+            }
+            auto node = make(Node::Kind::UNARY, Type::BOOL, position);
+            node->op = Op::NOT;
+            node->height = operand->height + 1;
+            node->left = std::move(operand);
+            return node;
+        }
+        return parse_primary();
+    }
+
+    NodePtr parse_primary() {
+        const Lexeme lex = current_;
+        switch (lex.token) {
+            case Token::NUMBER: {
+                advance();
+                auto node = make(Node::Kind::LITERAL, Type::NUMBER, lex.position);
+                node->number = lex.number;
+                return node;
+            }
+            case Token::STRING: {
+                advance();
+                auto node = make(Node::Kind::STRING, Type::STRING, lex.position);
+                node->text = std::string(lex.text);
+                return node;
+            }
+            case Token::LPAREN: {
+                advance();
+                auto inner = parse_or();
+                if (!inner) {
+                    return nullptr;
+                }
+                if (!accept(Token::RPAREN)) {
+                    return error(current_.position, "expected ')'");
+                }
+                return inner;
+            }
+            case Token::IDENT:
+                advance();
+                if (current_.token == Token::LPAREN) {
+                    return parse_call(lex);
+                }
+                if (lex.text == "true" || lex.text == "false") {
+                    auto node = make(Node::Kind::LITERAL, Type::BOOL, lex.position);
+                    node->number = lex.text == "true" ? 1.0 : 0.0;
+                    return node;
+                }
+                return parse_signal(lex, Node::Kind::SIGNAL);
+            case Token::END:
+                return error(lex.position, "unexpected end of expression");
+            default:
+                return error(lex.position, "unexpected '" + std::string(lex.text) + "'");
+        }
+    }
+
+    NodePtr parse_signal(const Lexeme& lex, Node::Kind kind) {
+        auto id = catalog_.find(lex.text);
+        if (!id) {
+            return error(lex.position, "unknown signal " + std::string(lex.text));
+        }
+        const SignalNode* signal = catalog_.get(*id);
+        if (signal->is_branch()) {
+            return error(lex.position, std::string(lex.text) + " is a branch, not a signal");
+        }
+
+        Type type;
+        switch (signal->type) {
+            case ValueType::BOOL:
+                type = Type::BOOL;
+                break;
+            case ValueType::STRING:
+                type = Type::STRING;
+                break;
+            case ValueType::INT8: case ValueType::INT16: case ValueType::INT32: case ValueType::INT64:
+            case ValueType::UINT8: case ValueType::UINT16: case ValueType::UINT32: case ValueType::UINT64:
+            case ValueType::FLOAT: case ValueType::DOUBLE:
+                type = Type::NUMBER;
+                break;
+            default:
+                if (kind != Node::Kind::VALID) {
+                    return error(lex.position, std::string(lex.text) + " is not a scalar signal");
+                }
+                type = Type::NUMBER;
+                break;
+        }
+
+        auto node = make(kind, kind == Node::Kind::VALID ? Type::BOOL : type, lex.position);
+        node->signal = signal;
+        node->slot = slot(*id);
+        return node;
+    }
+
+    NodePtr parse_call(const Lexeme& name) {
+        advance();  // '('
+        if (name.text == "valid") {
+            const Lexeme arg = current_;
+            if (arg.token != Token::IDENT) {
+                return error(arg.position, "valid() takes a signal path");
+            }
+            advance();
+            auto node = parse_signal(arg, Node::Kind::VALID);
+            if (node && !accept(Token::RPAREN)) {
+                return error(current_.position, "expected ')'");
+            }
+            return node;
+        }
+
+        Op op;
+        size_t arity;
+        if (name.text == "abs") {
+            op = Op::ABS;
+            arity = 1;
+        } else if (name.text == "min" || name.text == "max") {
+            op = name.text == "min" ? Op::MIN : Op::MAX;
+            arity = 2;
+        } else {
+            return error(name.position, "unknown function " + std::string(name.text));
+        }
+
+        NodePtr args[2];
+        for (size_t i = 0; i < arity; ++i) {
+            if (i > 0 && !accept(Token::COMMA)) {
+                return error(current_.position, "expected ','");
+            }
+            args[i] = parse_or();
+            if (!args[i]) {
+                return nullptr;
+            }
+            if (args[i]->type != Type::NUMBER) {
+                return error(args[i]->position, std::string(name.text) + "() takes numbers");
+            }
+        }
+        if (!accept(Token::RPAREN)) {
+            return error(current_.position, "expected ')'");
+        }
+
+        auto node = make(arity == 1 ? Node::Kind::UNARY : Node::Kind::BINARY, Type::NUMBER, name.position);
+        node->op = op;
+        node->height = std::max(args[0]->height, arity == 1 ? 0 : args[1]->height) + 1;
+        node->left = std::move(args[0]);
+        node->right = std::move(args[1]);
+        return node;
+    }
+
+    uint32_t slot(SignalId id) {
+        auto& inputs = expression_.inputs_;
+        auto it = std::find(inputs.begin(), inputs.end(), id);
+        if (it != inputs.end()) {
+            return static_cast<uint32_t>(it - inputs.begin());
+        }
+        inputs.push_back(id);
+        return static_cast<uint32_t>(inputs.size() - 1);
+    }
+
+    // ------------------------------------------------------------------------
+    // Code generation
+    // ------------------------------------------------------------------------
+
+    bool push(Op op, uint32_t arg = 0, double constant = 0.0) {
+        expression_.code_.push_back(Expression::Instruction{op, arg, constant});
+        ++depth_;
+        expression_.stack_depth_ = std::max(expression_.stack_depth_, depth_);
+        return depth_ <= MAX_STACK;
+    }
+
+    void apply(Op op, uint32_t arg = 0, double constant = 0.0, size_t pops = 0) {
+        expression_.code_.push_back(Expression::Instruction{op, arg, constant});
+        depth_ -= pops;
+    }
+
+    bool emit(const Node& node) {
+        switch (node.kind) {
+            case Node::Kind::LITERAL:
+                return push(Op::CONST, 0, node.number);
+            case Node::Kind::SIGNAL:
+                return push(load_op(node.signal->type), node.slot);
+            case Node::Kind::VALID:
+                return push(Op::VALID, node.slot);
+            case Node::Kind::STRING:
+                return false;   // Rejected by the type checker
+            case Node::Kind::UNARY:
+                if (!emit(*node.left)) {
+                    return false;
+                }
+                apply(node.op);
+                return true;
+            case Node::Kind::BINARY:
+                break;
+        }
+
+        if (node.op == Op::STR_EQ || node.op == Op::STR_NE) {
+            return push(node.op, node.slot);
+        }
+
+        if (node.op == Op::AND || node.op == Op::OR) {
+            if (!emit(*node.left)) {
+                return false;
+            }
+            const size_t skip = expression_.code_.size();
+            apply(node.op == Op::AND ? Op::AND_SKIP : Op::OR_SKIP);
+            if (!emit(*node.right)) {
+                return false;
+            }
+            apply(node.op, 0, 0.0, 1);
+            expression_.code_[skip].arg = static_cast<uint32_t>(expression_.code_.size());
+            return true;
+        }
+
+        // Comparison with a literal: one fused instruction
+        if (is_comparison(node.op)) {
+            if (node.right->kind == Node::Kind::LITERAL) {
+                if (!emit(*node.left)) {
+                    return false;
+                }
+                apply(with_constant(node.op), 0, node.right->number);
+                return true;
+            }
+            if (node.left->kind == Node::Kind::LITERAL) {
+                if (!emit(*node.right)) {
+                    return false;
+                }
+                apply(with_constant(flip(node.op)), 0, node.left->number);
+                return true;
+            }
+        }
+
+        if (!emit(*node.left) || !emit(*node.right)) {
+            return false;
+        }
+        apply(node.op, 0, 0.0, 1);
+        return true;
+    }
+
+    Lexer lexer_;
+    Lexeme current_;
+    const SignalCatalog& catalog_;
+    ExpressionError* error_;
+    bool failed_ = false;
+    Expression expression_;
+    size_t depth_ = 0;
+    size_t nesting_ = 0;
+};
+
+const char* expression_type_to_string(ExpressionType type) {
+    switch (type) {
+        case ExpressionType::BOOL:      return "BOOL";
+        case ExpressionType::NUMBER:    return "NUMBER";
+    }
+    return "UNKNOWN";
+}
+
+std::optional<Expression> Expression::compile(std::string_view source, const SignalCatalog& catalog,
+                                              ExpressionError* error) {
+    return ExpressionCompiler(source, catalog, error).run(source);
+}
+
+// ============================================================================
+// Scalar evaluation
+// ============================================================================
+
+namespace {
+
+struct Slot {
+    double number;
+    bool known;
+};
+
+// Value held in a type other than the catalog's: convert any scalar number
+Slot load_converted(const Value& value, SignalQuality& worst) {
+    const bool numeric = std::visit([](auto&& v) -> bool {
+        using T = std::decay_t<decltype(v)>;
+        return std::is_arithmetic_v<T>;
+    }, value);
+    if (!numeric) {
+        degrade(worst, is_empty(value) ? SignalQuality::NOT_AVAILABLE : SignalQuality::INVALID);
+        return Slot{0.0, false};
+    }
+    const double d = to_double(value);
+    if (std::isnan(d)) {
+        degrade(worst, SignalQuality::NOT_AVAILABLE);
+        return Slot{0.0, false};
+    }
+    return Slot{d, true};
+}
+
+template<typename T>
+Slot load(const DynamicQualifiedValue* in, SignalQuality& worst) {
+    if (!in) {
+        degrade(worst, SignalQuality::NOT_AVAILABLE);
+        return Slot{0.0, false};
+    }
+    if (in->quality != SignalQuality::VALID) {
+        degrade(worst, in->quality);
+        return Slot{0.0, false};
+    }
+    if (const T* v = std::get_if<T>(&in->value)) {
+        if constexpr (std::is_floating_point_v<T>) {
+            if (std::isnan(*v)) {
+                degrade(worst, SignalQuality::NOT_AVAILABLE);
+                return Slot{0.0, false};
+            }
+        }
+        return Slot{static_cast<double>(*v), true};
+    }
+    return load_converted(in->value, worst);
+}
+
+bool usable(const DynamicQualifiedValue* in) {
+    if (!in || in->quality != SignalQuality::VALID || is_empty(in->value)) {
+        return false;
+    }
+    if (const float* f = std::get_if<float>(&in->value)) {
+        return !std::isnan(*f);
+    }
+    if (const double* d = std::get_if<double>(&in->value)) {
+        return !std::isnan(*d);
+    }
+    return true;
+}
+
+// Kleene conjunction and disjunction on 0/1 values; branch-free so the
+// batch loops vectorize
+template<typename Known>
+inline void kleene_and(double a, Known ka, double b, Known kb, double& r, Known& k) {
+    const unsigned av = a != 0.0;
+    const unsigned bv = b != 0.0;
+    const unsigned ua = ka;
+    const unsigned ub = kb;
+    r = static_cast<double>(av & bv);
+    k = static_cast<Known>((ua & ub) | (ua & (av ^ 1u)) | (ub & (bv ^ 1u)));
+}
+
+template<typename Known>
+inline void kleene_or(double a, Known ka, double b, Known kb, double& r, Known& k) {
+    const unsigned av = a != 0.0;
+    const unsigned bv = b != 0.0;
+    const unsigned ua = ka;
+    const unsigned ub = kb;
+    r = static_cast<double>(av | bv);
+    k = static_cast<Known>((ua & ub) | (ua & av) | (ub & bv));
+}
+
+template<Op OP>
+inline bool compare(double a, double b) {
+    if constexpr (OP == Op::LT || OP == Op::LT_CONST) {
+        return a < b;
+    } else if constexpr (OP == Op::LE || OP == Op::LE_CONST) {
+        return a <= b;
+    } else if constexpr (OP == Op::GT || OP == Op::GT_CONST) {
+        return a > b;
+    } else if constexpr (OP == Op::GE || OP == Op::GE_CONST) {
+        return a >= b;
+    } else if constexpr (OP == Op::EQ || OP == Op::EQ_CONST) {
+        return a == b;
+    } else {
+        return a != b;
+    }
+}
+
+template<Op OP>
+inline double arithmetic(double a, double b) {
+    if constexpr (OP == Op::ADD) {
+        return a + b;
+    } else if constexpr (OP == Op::SUB) {
+        return a - b;
+    } else if constexpr (OP == Op::MUL) {
+        return a * b;
+    } else if constexpr (OP == Op::DIV) {
+        return a / b;
+    } else if constexpr (OP == Op::MIN) {
+        return std::min(a, b);
+    } else {
+        return std::max(a, b);
+    }
+}
+
+} // namespace
+
+bool Expression::run(const DynamicQualifiedValue* const* inputs, double& result, SignalQuality& worst) const {
+    if (code_.empty()) {
+        worst = SignalQuality::NOT_AVAILABLE;
+        return false;
+    }
+
+    Slot stack[MAX_STACK];
+    size_t sp = 0;
+    worst = SignalQuality::VALID;
+
+    for (size_t pc = 0; pc < code_.size(); ++pc) {
+        const Instruction& ins = code_[pc];
+        switch (ins.op) {
+            case Op::LOAD_BOOL:   stack[sp++] = load<bool>(inputs[ins.arg], worst); break;
+            case Op::LOAD_INT8:   stack[sp++] = load<int8_t>(inputs[ins.arg], worst); break;
+            case Op::LOAD_INT16:  stack[sp++] = load<int16_t>(inputs[ins.arg], worst); break;
+            case Op::LOAD_INT32:  stack[sp++] = load<int32_t>(inputs[ins.arg], worst); break;
+            case Op::LOAD_INT64:  stack[sp++] = load<int64_t>(inputs[ins.arg], worst); break;
+            case Op::LOAD_UINT8:  stack[sp++] = load<uint8_t>(inputs[ins.arg], worst); break;
+            case Op::LOAD_UINT16: stack[sp++] = load<uint16_t>(inputs[ins.arg], worst); break;
+            case Op::LOAD_UINT32: stack[sp++] = load<uint32_t>(inputs[ins.arg], worst); break;
+            case Op::LOAD_UINT64: stack[sp++] = load<uint64_t>(inputs[ins.arg], worst); break;
+            case Op::LOAD_FLOAT:  stack[sp++] = load<float>(inputs[ins.arg], worst); break;
+            case Op::LOAD_DOUBLE: stack[sp++] = load<double>(inputs[ins.arg], worst); break;
+
+            case Op::VALID:
+                stack[sp++] = Slot{usable(inputs[ins.arg]) ? 1.0 : 0.0, true};
+                break;
+            case Op::CONST:
+                stack[sp++] = Slot{ins.constant, true};
+                break;
+
+            case Op::STR_EQ:
+            case Op::STR_NE: {
+                const StringConstant& s = strings_[ins.arg];
+                const DynamicQualifiedValue* in = inputs[s.slot];
+                Slot result{0.0, false};
+                if (!in || in->quality != SignalQuality::VALID) {
+                    degrade(worst, in ? in->quality : SignalQuality::NOT_AVAILABLE);
+                } else if (const EnumValue* e = std::get_if<EnumValue>(&in->value)) {
+                    const bool equal = s.dictionary && e->dictionary == s.dictionary ? e->code == s.code
+                                                                                     : e->str() == s.text;
+                    result = Slot{equal ? 1.0 : 0.0, true};
+                } else if (const std::string* str = std::get_if<std::string>(&in->value)) {
+                    result = Slot{*str == s.text ? 1.0 : 0.0, true};
+                } else {
+                    degrade(worst, is_empty(in->value) ? SignalQuality::NOT_AVAILABLE : SignalQuality::INVALID);
+                }
+                if (ins.op == Op::STR_NE && result.known) {
+                    result.number = 1.0 - result.number;
+                }
+                stack[sp++] = result;
+                break;
+            }
+
+#define VSS_EXPRESSION_BINARY(OP, EXPR)                                 \
+            case Op::OP: {                                              \
+                const Slot b = stack[--sp];                             \
+                Slot& a = stack[sp - 1];                                \
+                a.number = (EXPR);                                      \
+                a.known = a.known && b.known;                           \
+                break;                                                  \
+            }
+            VSS_EXPRESSION_BINARY(ADD, arithmetic<Op::ADD>(a.number, b.number))
+            VSS_EXPRESSION_BINARY(SUB, arithmetic<Op::SUB>(a.number, b.number))
+            VSS_EXPRESSION_BINARY(MUL, arithmetic<Op::MUL>(a.number, b.number))
+            VSS_EXPRESSION_BINARY(DIV, arithmetic<Op::DIV>(a.number, b.number))
+            VSS_EXPRESSION_BINARY(MIN, arithmetic<Op::MIN>(a.number, b.number))
+            VSS_EXPRESSION_BINARY(MAX, arithmetic<Op::MAX>(a.number, b.number))
+            VSS_EXPRESSION_BINARY(LT, compare<Op::LT>(a.number, b.number) ? 1.0 : 0.0)
+            VSS_EXPRESSION_BINARY(LE, compare<Op::LE>(a.number, b.number) ? 1.0 : 0.0)
+            VSS_EXPRESSION_BINARY(GT, compare<Op::GT>(a.number, b.number) ? 1.0 : 0.0)
+            VSS_EXPRESSION_BINARY(GE, compare<Op::GE>(a.number, b.number) ? 1.0 : 0.0)
+            VSS_EXPRESSION_BINARY(EQ, compare<Op::EQ>(a.number, b.number) ? 1.0 : 0.0)
+            VSS_EXPRESSION_BINARY(NE, compare<Op::NE>(a.number, b.number) ? 1.0 : 0.0)
+#undef VSS_EXPRESSION_BINARY
+
+            case Op::LT_CONST: stack[sp - 1].number = compare<Op::LT>(stack[sp - 1].number, ins.constant); break;
+            case Op::LE_CONST: stack[sp - 1].number = compare<Op::LE>(stack[sp - 1].number, ins.constant); break;
+            case Op::GT_CONST: stack[sp - 1].number = compare<Op::GT>(stack[sp - 1].number, ins.constant); break;
+            case Op::GE_CONST: stack[sp - 1].number = compare<Op::GE>(stack[sp - 1].number, ins.constant); break;
+            case Op::EQ_CONST: stack[sp - 1].number = compare<Op::EQ>(stack[sp - 1].number, ins.constant); break;
+            case Op::NE_CONST: stack[sp - 1].number = compare<Op::NE>(stack[sp - 1].number, ins.constant); break;
+
+            case Op::NEG: stack[sp - 1].number = -stack[sp - 1].number; break;
+            case Op::ABS: stack[sp - 1].number = std::fabs(stack[sp - 1].number); break;
+            case Op::NOT: stack[sp - 1].number = stack[sp - 1].number != 0.0 ? 0.0 : 1.0; break;
+
+            case Op::AND:
+            case Op::OR: {
+                const Slot b = stack[--sp];
+                Slot& a = stack[sp - 1];
+                if (ins.op == Op::AND) {
+                    kleene_and(a.number, a.known, b.number, b.known, a.number, a.known);
+                } else {
+                    kleene_or(a.number, a.known, b.number, b.known, a.number, a.known);
+                }
+                break;
+            }
+            case Op::AND_SKIP:
+                if (stack[sp - 1].known && stack[sp - 1].number == 0.0) {
+                    pc = ins.arg - 1;
+                }
+                break;
+            case Op::OR_SKIP:
+                if (stack[sp - 1].known && stack[sp - 1].number != 0.0) {
+                    pc = ins.arg - 1;
+                }
+                break;
+        }
+    }
+
+    result = stack[0].number;
+    if (!stack[0].known && worst == SignalQuality::VALID) {
+        worst = SignalQuality::NOT_AVAILABLE;
+    }
+    return stack[0].known;
+}
+
+ExpressionResult Expression::evaluate(const DynamicQualifiedValue* const* inputs) const {
+    ExpressionResult result;
+    double number;
+    if (!run(inputs, number, result.quality)) {
+        return result;
+    }
+    result.quality = SignalQuality::VALID;
+    if (type_ == ExpressionType::BOOL) {
+        result.value = number != 0.0;
+    } else {
+        result.value = number;
+    }
+    return result;
+}
+
+bool Expression::matches(const DynamicQualifiedValue* const* inputs) const {
+    double number;
+    SignalQuality quality;
+    return run(inputs, number, quality) && number != 0.0;
+}
+
+// ============================================================================
+// Batch evaluation
+// ============================================================================
+
+namespace {
+
+#ifdef VSS_TYPES_EXPRESSION_AVX2
+template<Op OP>
+constexpr int avx_predicate() {
+    if constexpr (OP == Op::LT_CONST) {
+        return _CMP_LT_OQ;
+    } else if constexpr (OP == Op::LE_CONST) {
+        return _CMP_LE_OQ;
+    } else if constexpr (OP == Op::GT_CONST) {
+        return _CMP_GT_OQ;
+    } else if constexpr (OP == Op::GE_CONST) {
+        return _CMP_GE_OQ;
+    } else if constexpr (OP == Op::EQ_CONST) {
+        return _CMP_EQ_OQ;
+    } else {
+        return _CMP_NEQ_UQ;
+    }
+}
+#endif
+
+// x[i] = x[i] OP c ? 1 : 0
+template<Op OP>
+void compare_const_block(double* x, size_t n, double c) {
+    size_t i = 0;
+#ifdef VSS_TYPES_EXPRESSION_AVX2
+    const __m256d vc = _mm256_set1_pd(c);
+    const __m256d one = _mm256_set1_pd(1.0);
+    for (; i + 4 <= n; i += 4) {
+        const __m256d mask = _mm256_cmp_pd(_mm256_loadu_pd(x + i), vc, avx_predicate<OP>());
+        _mm256_storeu_pd(x + i, _mm256_and_pd(mask, one));
+    }
+#endif
+    for (; i < n; ++i) {
+        x[i] = compare<OP>(x[i], c) ? 1.0 : 0.0;
+    }
+}
+
+template<Op OP>
+void compare_block(double* x, uint8_t* kx, const double* y, const uint8_t* ky, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        x[i] = compare<OP>(x[i], y[i]) ? 1.0 : 0.0;
+        kx[i] &= ky[i];
+    }
+}
+
+template<Op OP>
+void arithmetic_block(double* x, uint8_t* kx, const double* y, const uint8_t* ky, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        x[i] = arithmetic<OP>(x[i], y[i]);
+        kx[i] &= ky[i];
+    }
+}
+
+void load_block(const SeriesView& column, size_t offset, size_t n, bool as_bool, double* x, uint8_t* k) {
+    const double* values = column.values + offset;
+    for (size_t i = 0; i < n; ++i) {
+        const double v = values[i];
+        x[i] = as_bool ? (v != 0.0 ? 1.0 : 0.0) : v;
+        k[i] = v == v;
+    }
+    if (column.qualities) {
+        const SignalQuality* qualities = column.qualities + offset;
+        for (size_t i = 0; i < n; ++i) {
+            k[i] &= qualities[i] == SignalQuality::VALID;
+        }
+    }
+}
+
+} // namespace
+
+template<typename Out>
+std::optional<size_t> Expression::run_batch(const std::vector<SeriesView>& columns, Out* out, size_t rows) const {
+    std::vector<double> numbers(stack_depth_ * BLOCK_SIZE);
+    std::vector<uint8_t> known(stack_depth_ * BLOCK_SIZE);
+    size_t hits = 0;
+
+    for (size_t offset = 0; offset < rows; offset += BLOCK_SIZE) {
+        const size_t n = std::min(BLOCK_SIZE, rows - offset);
+        size_t sp = 0;
+
+        for (const Instruction& ins : code_) {
+            double* x = sp > 0 ? numbers.data() + (sp - 1) * BLOCK_SIZE : nullptr;
+            uint8_t* kx = sp > 0 ? known.data() + (sp - 1) * BLOCK_SIZE : nullptr;
+            double* top = numbers.data() + sp * BLOCK_SIZE;     // Slot for a push
+            uint8_t* ktop = known.data() + sp * BLOCK_SIZE;
+
+            switch (ins.op) {
+                case Op::LOAD_BOOL:
+                case Op::LOAD_INT8: case Op::LOAD_INT16: case Op::LOAD_INT32: case Op::LOAD_INT64:
+                case Op::LOAD_UINT8: case Op::LOAD_UINT16: case Op::LOAD_UINT32: case Op::LOAD_UINT64:
+                case Op::LOAD_FLOAT: case Op::LOAD_DOUBLE:
+                    load_block(columns[ins.arg], offset, n, ins.op == Op::LOAD_BOOL, top, ktop);
+                    ++sp;
+                    break;
+                case Op::VALID:
+                    load_block(columns[ins.arg], offset, n, false, top, ktop);
+                    for (size_t i = 0; i < n; ++i) {
+                        top[i] = ktop[i] ? 1.0 : 0.0;
+                        ktop[i] = 1;
+                    }
+                    ++sp;
+                    break;
+                case Op::CONST:
+                    std::fill(top, top + n, ins.constant);
+                    std::fill(ktop, ktop + n, uint8_t{1});
+                    ++sp;
+                    break;
+
+                case Op::LT_CONST: compare_const_block<Op::LT_CONST>(x, n, ins.constant); break;
+                case Op::LE_CONST: compare_const_block<Op::LE_CONST>(x, n, ins.constant); break;
+                case Op::GT_CONST: compare_const_block<Op::GT_CONST>(x, n, ins.constant); break;
+                case Op::GE_CONST: compare_const_block<Op::GE_CONST>(x, n, ins.constant); break;
+                case Op::EQ_CONST: compare_const_block<Op::EQ_CONST>(x, n, ins.constant); break;
+                case Op::NE_CONST: compare_const_block<Op::NE_CONST>(x, n, ins.constant); break;
+
+#define VSS_EXPRESSION_BLOCK(OP, KERNEL)                                                    \
+                case Op::OP:                                                                \
+                    --sp;                                                                   \
+                    KERNEL<Op::OP>(x - BLOCK_SIZE, kx - BLOCK_SIZE, x, kx, n);              \
+                    break;
+                VSS_EXPRESSION_BLOCK(LT, compare_block)
+                VSS_EXPRESSION_BLOCK(LE, compare_block)
+                VSS_EXPRESSION_BLOCK(GT, compare_block)
+                VSS_EXPRESSION_BLOCK(GE, compare_block)
+                VSS_EXPRESSION_BLOCK(EQ, compare_block)
+                VSS_EXPRESSION_BLOCK(NE, compare_block)
+                VSS_EXPRESSION_BLOCK(ADD, arithmetic_block)
+                VSS_EXPRESSION_BLOCK(SUB, arithmetic_block)
+                VSS_EXPRESSION_BLOCK(MUL, arithmetic_block)
+                VSS_EXPRESSION_BLOCK(DIV, arithmetic_block)
+                VSS_EXPRESSION_BLOCK(MIN, arithmetic_block)
+                VSS_EXPRESSION_BLOCK(MAX, arithmetic_block)
+#undef VSS_EXPRESSION_BLOCK
+
+                case Op::NEG:
+                    for (size_t i = 0; i < n; ++i) {
+                        x[i] = -x[i];
+                    }
+                    break;
+                case Op::ABS:
+                    for (size_t i = 0; i < n; ++i) {
+                        x[i] = std::fabs(x[i]);
+                    }
+                    break;
+                case Op::NOT:
+                    for (size_t i = 0; i < n; ++i) {
+                        x[i] = x[i] != 0.0 ? 0.0 : 1.0;
+                    }
+                    break;
+
+                case Op::AND: {
+                    --sp;
+                    double* a = x - BLOCK_SIZE;
+                    uint8_t* ka = kx - BLOCK_SIZE;
+                    for (size_t i = 0; i < n; ++i) {
+                        kleene_and(a[i], ka[i], x[i], kx[i], a[i], ka[i]);
+                    }
+                    break;
+                }
+                case Op::OR: {
+                    --sp;
+                    double* a = x - BLOCK_SIZE;
+                    uint8_t* ka = kx - BLOCK_SIZE;
+                    for (size_t i = 0; i < n; ++i) {
+                        kleene_or(a[i], ka[i], x[i], kx[i], a[i], ka[i]);
+                    }
+                    break;
+                }
+
+                case Op::AND_SKIP:
+                case Op::OR_SKIP:
+                    break;  // Both sides are evaluated; three-valued AND/OR give the same result
+
+                case Op::STR_EQ:
+                case Op::STR_NE:
+                    return std::nullopt;    // Rejected by evaluate_batch()
+            }
+        }
+
+        const double* result = numbers.data();
+        const uint8_t* result_known = known.data();
+        for (size_t i = 0; i < n; ++i) {
+            if constexpr (std::is_same_v<Out, uint8_t>) {
+                const uint8_t hit = static_cast<uint8_t>(result_known[i] & (result[i] != 0.0));
+                out[offset + i] = hit;
+                hits += hit;
+            } else {
+                out[offset + i] = result_known[i] ? result[i] : std::numeric_limits<double>::quiet_NaN();
+                hits += result_known[i];
+            }
+        }
+    }
+    return hits;
+}
+
+namespace {
+
+// Column count and sizes match the inputs; returns the row count
+std::optional<size_t> batch_rows(const std::vector<SeriesView>& columns, size_t inputs) {
+    if (columns.size() != inputs) {
+        return std::nullopt;
+    }
+    const size_t rows = columns.empty() ? 0 : columns.front().size;
+    for (const auto& column : columns) {
+        if (column.size != rows || (rows > 0 && !column.values)) {
+            return std::nullopt;
+        }
+    }
+    return rows;
+}
+
+} // namespace
+
+std::optional<size_t> Expression::evaluate_batch(const std::vector<SeriesView>& columns,
+                                                 std::vector<uint8_t>& out) const {
+    auto rows = batch_rows(columns, inputs_.size());
+    if (!rows || !strings_.empty()) {
+        return std::nullopt;
+    }
+    out.resize(*rows);
+    return run_batch(columns, out.data(), *rows);
+}
+
+std::optional<size_t> Expression::evaluate_batch(const std::vector<SeriesView>& columns,
+                                                 std::vector<double>& out) const {
+    auto rows = batch_rows(columns, inputs_.size());
+    if (!rows || !strings_.empty() || type_ != ExpressionType::NUMBER) {
+        return std::nullopt;
+    }
+    out.resize(*rows);
+    return run_batch(columns, out.data(), *rows);
+}
+
+} // namespace vss::types
@@ -0,0 +1,272 @@
+/**
+ * @file footprint.cpp
+ * @brief Implementation of memory-footprint accounting
+ */
+
+#include <vss/types/footprint.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <type_traits>
+#include <unordered_set>
+#include <utility>
+
+namespace vss::types {
+
+namespace {
+
+// Reference counts in a make_shared block: libc++ uses longs, libstdc++ ints
+#if defined(_LIBCPP_VERSION)
+constexpr size_t SHARED_CONTROL_BLOCK = sizeof(void*) + 2 * sizeof(long);
+#else
+constexpr size_t SHARED_CONTROL_BLOCK = sizeof(void*) + 2 * sizeof(int);
+#endif
+
+// Red-black tree node header: color plus parent/left/right links
+constexpr size_t MAP_NODE_HEADER = 4 * sizeof(void*);
+
+// Deepest nesting built for report instances (guards recursive definitions)
+constexpr size_t MAX_INSTANCE_DEPTH = 16;
+
+bool is_small_string(const std::string& s) noexcept {
+    const auto object = reinterpret_cast<std::uintptr_t>(&s);
+    const auto data = reinterpret_cast<std::uintptr_t>(s.data());
+    return data >= object && data < object + sizeof(std::string);
+}
+
+// Adds heap usage to `usage`; the inline part is counted by the caller
+class Walker {
+public:
+    explicit Walker(MemoryUsage& usage) : usage_(usage) {}
+
+    void string(const std::string& s) {
+        if (is_small_string(s)) {
+            ++usage_.inline_strings;
+        } else {
+            ++usage_.heap_strings;
+            block(s.capacity() + 1);
+        }
+    }
+
+    template<typename T>
+    void vector(const std::vector<T>& v) {
+        if (v.capacity() > 0) {
+            block(v.capacity() * sizeof(T));
+        }
+    }
+
+    void vector(const std::vector<bool>& v) {
+        constexpr size_t WORD_BITS = 8 * sizeof(unsigned long);
+        if (v.capacity() > 0) {
+            block((v.capacity() + WORD_BITS - 1) / WORD_BITS * sizeof(unsigned long));
+        }
+    }
+
+    void value(const Value& value) {
+        std::visit([this](const auto& v) {
+            using T = std::decay_t<decltype(v)>;
+            if constexpr (std::is_same_v<T, std::string>) {
+                string(v);
+            } else if constexpr (std::is_same_v<T, std::vector<std::string>>) {
+                vector(v);
+                for (const auto& s : v) {
+                    string(s);
+                }
+            } else if constexpr (std::is_same_v<T, std::shared_ptr<StructValue>>) {
+                shared_struct(v.get());
+            } else if constexpr (std::is_same_v<T, std::vector<std::shared_ptr<StructValue>>>) {
+                vector(v);
+                for (const auto& item : v) {
+                    shared_struct(item.get());
+                }
+            } else if constexpr (is_vector<T>::value) {
+                vector(v);
+            }
+            // monostate, scalars and EnumValue own nothing
+        }, value);
+    }
+
+    void shared_struct(const StructValue* value) {
+        if (value && visited_.insert(value).second) {
+            block(SHARED_CONTROL_BLOCK + sizeof(StructValue));
+            struct_contents(*value);
+        }
+    }
+
+    void struct_contents(const StructValue& value) {
+        ++usage_.structs;
+        string(value.type_name());
+        for (const auto& [name, field] : value.fields()) {
+            block(MAP_NODE_HEADER + sizeof(std::pair<const std::string, Value>));
+            string(name);
+            this->value(field);
+        }
+    }
+
+    void definition_contents(const StructDefinition& definition) {
+        string(definition.type_name());
+        string(definition.description());
+        for (const auto& [name, field] : definition.fields()) {
+            block(MAP_NODE_HEADER + sizeof(std::pair<const std::string, FieldDefinition>));
+            string(name);
+            string(field.name);
+            string(field.description);
+            string(field.struct_type_name);
+            if (field.default_value) {
+                value(*field.default_value);
+            }
+            vector(field.constraints.allowed);
+            for (const auto& allowed : field.constraints.allowed) {
+                value(allowed);
+            }
+        }
+    }
+
+    void mark_visited(const StructValue* value) { visited_.insert(value); }
+
+private:
+    template<typename T> struct is_vector : std::false_type {};
+    template<typename T> struct is_vector<std::vector<T>> : std::true_type {};
+
+    void block(size_t bytes) {
+        usage_.heap_bytes += bytes;
+        ++usage_.allocations;
+    }
+
+    MemoryUsage& usage_;
+    std::unordered_set<const StructValue*> visited_;
+};
+
+// Empty value of a non-struct type
+Value empty_value(ValueType type) {
+    switch (type) {
+        case ValueType::STRING: return Value{std::string()};
+        case ValueType::BOOL: return Value{false};
+        case ValueType::INT8: return Value{int8_t(0)};
+        case ValueType::INT16: return Value{int16_t(0)};
+        case ValueType::INT32: return Value{int32_t(0)};
+        case ValueType::INT64: return Value{int64_t(0)};
+        case ValueType::UINT8: return Value{uint8_t(0)};
+        case ValueType::UINT16: return Value{uint16_t(0)};
+        case ValueType::UINT32: return Value{uint32_t(0)};
+        case ValueType::UINT64: return Value{uint64_t(0)};
+        case ValueType::FLOAT: return Value{0.0f};
+        case ValueType::DOUBLE: return Value{0.0};
+        case ValueType::STRING_ARRAY: return Value{std::vector<std::string>()};
+        case ValueType::BOOL_ARRAY: return Value{std::vector<bool>()};
+        case ValueType::INT8_ARRAY: return Value{std::vector<int8_t>()};
+        case ValueType::INT16_ARRAY: return Value{std::vector<int16_t>()};
+        case ValueType::INT32_ARRAY: return Value{std::vector<int32_t>()};
+        case ValueType::INT64_ARRAY: return Value{std::vector<int64_t>()};
+        case ValueType::UINT8_ARRAY: return Value{std::vector<uint8_t>()};
+        case ValueType::UINT16_ARRAY: return Value{std::vector<uint16_t>()};
+        case ValueType::UINT32_ARRAY: return Value{std::vector<uint32_t>()};
+        case ValueType::UINT64_ARRAY: return Value{std::vector<uint64_t>()};
+        case ValueType::FLOAT_ARRAY: return Value{std::vector<float>()};
+        case ValueType::DOUBLE_ARRAY: return Value{std::vector<double>()};
+        case ValueType::STRUCT_ARRAY: return Value{std::vector<std::shared_ptr<StructValue>>()};
+        default: return Value{};
+    }
+}
+
+StructValue build_instance(const StructDefinition& definition, const StructRegistry& registry, size_t depth) {
+    StructValue instance{definition.type_name()};
+    for (const auto& [name, field] : definition.fields()) {
+        if (field.default_value) {
+            instance.set_field(name, *field.default_value);
+        } else if (field.type == ValueType::STRUCT) {
+            const StructDefinition* nested = registry.get_struct(field.struct_type_name);
+            instance.set_field(name, std::make_shared<StructValue>(
+                nested && depth < MAX_INSTANCE_DEPTH ? build_instance(*nested, registry, depth + 1)
+                                                     : StructValue{field.struct_type_name}));
+        } else {
+            instance.set_field(name, empty_value(field.type));
+        }
+    }
+    return instance;
+}
+
+std::string format_bytes(size_t bytes) {
+    char buf[32];
+    if (bytes >= 10 * 1024 * 1024) {
+        std::snprintf(buf, sizeof(buf), "%zu MiB", bytes / (1024 * 1024));
+    } else if (bytes >= 10 * 1024) {
+        std::snprintf(buf, sizeof(buf), "%zu KiB", bytes / 1024);
+    } else {
+        std::snprintf(buf, sizeof(buf), "%zu B", bytes);
+    }
+    return buf;
+}
+
+} // namespace
+
+MemoryUsage memory_usage(const Value& value) {
+    MemoryUsage usage;
+    usage.inline_bytes = sizeof(Value);
+    Walker(usage).value(value);
+    return usage;
+}
+
+MemoryUsage memory_usage(const StructValue& value) {
+    MemoryUsage usage;
+    usage.inline_bytes = sizeof(StructValue);
+    Walker walker(usage);
+    walker.mark_visited(&value);
+    walker.struct_contents(value);
+    return usage;
+}
+
+MemoryUsage memory_usage(const StructDefinition& definition) {
+    MemoryUsage usage;
+    usage.inline_bytes = sizeof(StructDefinition);
+    Walker(usage).definition_contents(definition);
+    return usage;
+}
+
+RegistryMemoryReport memory_report(const StructRegistry& registry) {
+    RegistryMemoryReport report;
+    report.registry.inline_bytes = sizeof(StructRegistry);
+    Walker walker(report.registry);
+
+    for (const auto& [name, definition] : registry.all_structs()) {
+        StructMemoryEntry entry;
+        entry.type_name = name;
+        entry.field_count = definition.fields().size();
+        entry.definition = memory_usage(definition);
+        entry.instance = memory_usage(build_instance(definition, registry, 0));
+        report.structs.push_back(std::move(entry));
+
+        walker.string(name);
+        report.registry.heap_bytes += MAP_NODE_HEADER + sizeof(std::pair<const std::string, StructDefinition>);
+        ++report.registry.allocations;
+        walker.definition_contents(definition);
+    }
+    return report;
+}
+
+std::string RegistryMemoryReport::to_string() const {
+    size_t width = 11;
+    for (const auto& entry : structs) {
+        width = std::max(width, entry.type_name.size());
+    }
+
+    std::string out;
+    char line[512];
+    std::snprintf(line, sizeof(line), "%-*s %6s %12s %12s %8s %8s\n", static_cast<int>(width),
+                  "Struct type", "Fields", "Definition", "Instance", "Allocs", "Strings");
+    out += line;
+    for (const auto& entry : structs) {
+        std::snprintf(line, sizeof(line), "%-*s %6zu %12s %12s %8zu %4zu/%-3zu\n", static_cast<int>(width),
+                      entry.type_name.c_str(), entry.field_count,
+                      format_bytes(entry.definition.total_bytes()).c_str(),
+                      format_bytes(entry.instance.total_bytes()).c_str(), entry.instance.allocations,
+                      entry.instance.heap_strings, entry.instance.inline_strings + entry.instance.heap_strings);
+        out += line;
+    }
+    std::snprintf(line, sizeof(line), "Registry: %zu struct types, %s in %zu allocations\n", structs.size(),
+                  format_bytes(registry.total_bytes()).c_str(), registry.allocations);
+    out += line;
+    return out;
+}
+
+} // namespace vss::types
@@ -0,0 +1,193 @@
+/**
+ * @file history.cpp
+ * @brief Implementation of the as-of history store
+ */
+
+#include <vss/types/history.hpp>
+#include <vss/types/clock.hpp>
+#include <algorithm>
+
+namespace vss::types {
+
+namespace {
+
+using detail::to_ns;
+using detail::from_ns;
+
+using TimePoint = std::chrono::system_clock::time_point;
+
+/**
+ * @brief First index >= from with timestamps[index] > t
+ *
+ * Gallops forward from `from` in doubling steps, then binary searches the
+ * last step, so nearby answers are found in a few comparisons.
+ */
+size_t gallop_upper(const std::vector<int64_t>& timestamps, size_t from, int64_t t) noexcept {
+    const size_t n = timestamps.size();
+    if (from >= n || timestamps[from] > t) {
+        return from;
+    }
+    size_t low = from;      // timestamps[low] <= t
+    size_t step = 1;
+    while (low + step < n && timestamps[low + step] <= t) {
+        low += step;
+        step *= 2;
+    }
+    const size_t high = std::min(n, low + step);
+    return static_cast<size_t>(std::upper_bound(timestamps.begin() + static_cast<std::ptrdiff_t>(low) + 1,
+                                                timestamps.begin() + static_cast<std::ptrdiff_t>(high), t)
+                               - timestamps.begin());
+}
+
+} // namespace
+
+size_t HistoryStore::Column::find(int64_t t) const noexcept {
+    if (timestamps.empty() || timestamps.front() > t) {
+        return npos;
+    }
+    // Common case: the current value
+    if (timestamps.back() <= t) {
+        return timestamps.size() - 1;
+    }
+    auto it = std::upper_bound(timestamps.begin(), timestamps.end(), t);
+    return static_cast<size_t>(it - timestamps.begin()) - 1;
+}
+
+DynamicQualifiedValue HistoryStore::Column::sample(size_t i) const {
+    return DynamicQualifiedValue{values[i], qualities[i], from_ns(timestamps[i])};
+}
+
+bool HistoryStore::record(SignalId id, DynamicQualifiedValue sample) {
+    if (id == INVALID_SIGNAL_ID) {
+        return false;
+    }
+    if (id >= signals_.size()) {
+        signals_.resize(static_cast<size_t>(id) + 1);
+    }
+
+    Column& col = signals_[id];
+    const int64_t t = to_ns(sample.timestamp);
+    if (col.timestamps.empty() || col.timestamps.back() <= t) {
+        col.timestamps.push_back(t);
+        col.values.push_back(std::move(sample.value));
+        col.qualities.push_back(sample.quality);
+        return true;
+    }
+
+    // Out of order: insert after all samples with the same or an older timestamp
+    const auto pos = std::upper_bound(col.timestamps.begin(), col.timestamps.end(), t) - col.timestamps.begin();
+    col.timestamps.insert(col.timestamps.begin() + pos, t);
+    col.values.insert(col.values.begin() + pos, std::move(sample.value));
+    col.qualities.insert(col.qualities.begin() + pos, sample.quality);
+    return true;
+}
+
+std::optional<DynamicQualifiedValue> HistoryStore::as_of(SignalId id, TimePoint t) const {
+    const Column* col = column(id);
+    if (!col) {
+        return std::nullopt;
+    }
+    const size_t i = col->find(to_ns(t));
+    if (i == npos) {
+        return std::nullopt;
+    }
+    return col->sample(i);
+}
+
+std::vector<SignalUpdate> HistoryStore::snapshot(TimePoint t) const {
+    std::vector<SignalUpdate> result;
+    const int64_t key = to_ns(t);
+    for (size_t id = 0; id < signals_.size(); ++id) {
+        const size_t i = signals_[id].find(key);
+        if (i != npos) {
+            result.emplace_back(static_cast<SignalId>(id), signals_[id].sample(i));
+        }
+    }
+    return result;
+}
+
+std::vector<SignalUpdate> HistoryStore::snapshot(TimePoint t, const SignalSet& signals) const {
+    std::vector<SignalUpdate> result;
+    const int64_t key = to_ns(t);
+    signals.for_each([&](SignalId id) {
+        const Column* col = column(id);
+        if (!col) {
+            return;
+        }
+        const size_t i = col->find(key);
+        if (i != npos) {
+            result.emplace_back(id, col->sample(i));
+        }
+    });
+    return result;
+}
+
+AsOfTable HistoryStore::as_of_join(const std::vector<SignalId>& signals, const std::vector<TimePoint>& times) const {
+    AsOfTable table;
+    table.times = times;
+    table.signals = signals;
+    const size_t rows = times.size();
+    // Cells are emplaced with their timestamp; default construction would read the clock
+    table.cells.reserve(rows * signals.size());
+
+    std::vector<int64_t> keys(rows);
+    for (size_t r = 0; r < rows; ++r) {
+        keys[r] = to_ns(times[r]);
+    }
+    const bool sorted = std::is_sorted(keys.begin(), keys.end());
+
+    for (size_t c = 0; c < signals.size(); ++c) {
+        const Column* col = column(signals[c]);
+        size_t next = 0;    // First sample after the previous query time
+
+        for (size_t r = 0; r < rows; ++r) {
+            size_t i = npos;
+            if (col) {
+                if (sorted) {
+                    next = gallop_upper(col->timestamps, next, keys[r]);
+                    i = next > 0 ? next - 1 : npos;
+                } else {
+                    i = col->find(keys[r]);
+                }
+            }
+
+            if (i == npos) {
+                table.cells.emplace_back(Value{}, SignalQuality::NOT_AVAILABLE, times[r]);
+            } else {
+                table.cells.emplace_back(col->values[i], col->qualities[i], from_ns(col->timestamps[i]));
+            }
+        }
+    }
+
+    return table;
+}
+
+void HistoryStore::trim_before(TimePoint t) {
+    const int64_t key = to_ns(t);
+    for (Column& col : signals_) {
+        // Keep the latest sample before t: it is still the answer just after t
+        const size_t i = col.find(key - 1);
+        if (i == npos || i == 0) {
+            continue;
+        }
+        const auto n = static_cast<std::ptrdiff_t>(i);
+        col.timestamps.erase(col.timestamps.begin(), col.timestamps.begin() + n);
+        col.values.erase(col.values.begin(), col.values.begin() + n);
+        col.qualities.erase(col.qualities.begin(), col.qualities.begin() + n);
+    }
+}
+
+size_t HistoryStore::size(SignalId id) const noexcept {
+    const Column* col = column(id);
+    return col ? col->timestamps.size() : 0;
+}
+
+size_t HistoryStore::total_size() const noexcept {
+    size_t total = 0;
+    for (const Column& col : signals_) {
+        total += col.timestamps.size();
+    }
+    return total;
+}
+
+} // namespace vss::types
@@ -0,0 +1,258 @@
+/**
+ * @file instrumentation.cpp
+ * @brief Implementation of the per-thread instrumentation counters
+ */
+
+#include <vss/types/instrumentation.hpp>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+
+namespace vss::types {
+
+namespace {
+
+// ValueType values are sparse (0-12, 20-31, 40-41); counters use a dense index
+constexpr size_t TYPE_COUNT = 27;
+constexpr size_t CONVERSION_SLOTS = TYPE_COUNT * TYPE_COUNT * CONVERSION_OUTCOME_COUNT;
+
+size_t type_index(ValueType type) noexcept {
+    const int v = static_cast<int>(type);
+    if (v >= 0 && v <= 12) {
+        return static_cast<size_t>(v);
+    }
+    if (v >= 20 && v <= 31) {
+        return static_cast<size_t>(v - 7);
+    }
+    if (v == 40 || v == 41) {
+        return static_cast<size_t>(v - 15);
+    }
+    return 0;
+}
+
+ValueType type_at(size_t index) noexcept {
+    if (index <= 12) {
+        return static_cast<ValueType>(index);
+    }
+    if (index <= 24) {
+        return static_cast<ValueType>(index + 7);
+    }
+    return static_cast<ValueType>(index + 15);
+}
+
+size_t conversion_slot(ValueType from, ValueType to, ConversionOutcome outcome) noexcept {
+    return (type_index(from) * TYPE_COUNT + type_index(to)) * CONVERSION_OUTCOME_COUNT +
+           static_cast<size_t>(outcome);
+}
+
+// Plain totals, used for exited threads and the reset baseline
+struct Totals {
+    std::array<uint64_t, CONVERSION_SLOTS> conversions{};
+    std::array<uint64_t, VALIDATION_OUTCOME_COUNT> validations{};
+    uint64_t compare_calls = 0;
+    uint64_t compare_nodes = 0;
+    uint64_t compare_structs = 0;
+};
+
+// Written by its thread only (load + store, no read-modify-write);
+// atomics so snapshots can read them concurrently
+struct ThreadCounters {
+    std::array<std::atomic<uint64_t>, CONVERSION_SLOTS> conversions{};
+    std::array<std::atomic<uint64_t>, VALIDATION_OUTCOME_COUNT> validations{};
+    std::atomic<uint64_t> compare_calls{0};
+    std::atomic<uint64_t> compare_nodes{0};
+    std::atomic<uint64_t> compare_structs{0};
+
+    void add_to(Totals& totals) const noexcept {
+        for (size_t i = 0; i < CONVERSION_SLOTS; ++i) {
+            totals.conversions[i] += conversions[i].load(std::memory_order_relaxed);
+        }
+        for (size_t i = 0; i < VALIDATION_OUTCOME_COUNT; ++i) {
+            totals.validations[i] += validations[i].load(std::memory_order_relaxed);
+        }
+        totals.compare_calls += compare_calls.load(std::memory_order_relaxed);
+        totals.compare_nodes += compare_nodes.load(std::memory_order_relaxed);
+        totals.compare_structs += compare_structs.load(std::memory_order_relaxed);
+    }
+};
+
+inline void bump(std::atomic<uint64_t>& counter) noexcept {
+    counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
+// Live threads registered without reallocating `live`
+constexpr size_t RESERVED_THREADS = 64;
+
+struct Registry {
+    std::mutex mutex;
+    std::vector<const ThreadCounters*> live;
+    Totals retired;     ///< Counts of exited threads
+    Totals baseline;    ///< Totals at the last reset
+
+    Registry() { live.reserve(RESERVED_THREADS); }
+};
+
+// Never destroyed, so threads exiting during static destruction can still
+// retire their counters
+Registry& registry() {
+    static Registry* instance = new Registry();
+    return *instance;
+}
+
+// Created at load time rather than inside the first instrumented call
+const bool registry_created = (registry(), true);
+
+// Constant-initialized, so reading it needs no TLS init guard
+thread_local ThreadCounters* local_counters = nullptr;
+
+// Sink for counts made by thread_local destructors after the thread's
+// own counters are gone
+ThreadCounters& discarded() {
+    static ThreadCounters* instance = new ThreadCounters();
+    return *instance;
+}
+
+// Registers on first use and folds the counts into the registry on exit
+struct ThreadSlot {
+    ThreadCounters counters;
+
+    ThreadSlot() {
+        Registry& r = registry();
+        std::lock_guard<std::mutex> lock(r.mutex);
+        r.live.push_back(&counters);
+    }
+
+    ~ThreadSlot() {
+        Registry& r = registry();
+        std::lock_guard<std::mutex> lock(r.mutex);
+        counters.add_to(r.retired);
+        r.live.erase(std::remove(r.live.begin(), r.live.end(), &counters), r.live.end());
+        local_counters = &discarded();
+    }
+};
+
+ThreadCounters& register_thread() {
+    thread_local ThreadSlot slot;
+    local_counters = &slot.counters;
+    return slot.counters;
+}
+
+inline ThreadCounters& local() {
+    ThreadCounters* counters = local_counters;
+    return counters ? *counters : register_thread();
+}
+
+Totals totals_locked(Registry& r) {
+    Totals totals = r.retired;
+    for (const ThreadCounters* counters : r.live) {
+        counters->add_to(totals);
+    }
+    return totals;
+}
+
+} // namespace
+
+const char* conversion_outcome_to_string(ConversionOutcome outcome) {
+    switch (outcome) {
+        case ConversionOutcome::UNCHANGED: return "UNCHANGED";
+        case ConversionOutcome::CONVERTED: return "CONVERTED";
+        case ConversionOutcome::INCOMPATIBLE: return "INCOMPATIBLE";
+        case ConversionOutcome::OUT_OF_RANGE: return "OUT_OF_RANGE";
+    }
+    return "UNKNOWN";
+}
+
+const char* validation_outcome_to_string(ValidationOutcome outcome) {
+    switch (outcome) {
+        case ValidationOutcome::VALID: return "VALID";
+        case ValidationOutcome::UNKNOWN_TYPE: return "UNKNOWN_TYPE";
+        case ValidationOutcome::MISSING_FIELD: return "MISSING_FIELD";
+        case ValidationOutcome::TYPE_MISMATCH: return "TYPE_MISMATCH";
+        case ValidationOutcome::CONSTRAINT_VIOLATION: return "CONSTRAINT_VIOLATION";
+        case ValidationOutcome::EXTRA_FIELD: return "EXTRA_FIELD";
+    }
+    return "UNKNOWN";
+}
+
+uint64_t InstrumentationSnapshot::conversion_count(ValueType from, ValueType to,
+                                                   ConversionOutcome outcome) const noexcept {
+    for (const auto& c : conversions) {
+        if (c.from == from && c.to == to && c.outcome == outcome) {
+            return c.count;
+        }
+    }
+    return 0;
+}
+
+uint64_t InstrumentationSnapshot::conversion_count(ConversionOutcome outcome) const noexcept {
+    uint64_t total = 0;
+    for (const auto& c : conversions) {
+        total += c.outcome == outcome ? c.count : 0;
+    }
+    return total;
+}
+
+InstrumentationSnapshot instrumentation_snapshot() {
+    Registry& r = registry();
+    Totals totals;
+    Totals baseline;
+    {
+        std::lock_guard<std::mutex> lock(r.mutex);
+        totals = totals_locked(r);
+        baseline = r.baseline;
+    }
+
+    InstrumentationSnapshot snapshot;
+    for (size_t slot = 0; slot < CONVERSION_SLOTS; ++slot) {
+        const uint64_t n = totals.conversions[slot] - baseline.conversions[slot];
+        if (n == 0) {
+            continue;
+        }
+        const size_t pair = slot / CONVERSION_OUTCOME_COUNT;
+        ConversionCount count;
+        count.from = type_at(pair / TYPE_COUNT);
+        count.to = type_at(pair % TYPE_COUNT);
+        count.outcome = static_cast<ConversionOutcome>(slot % CONVERSION_OUTCOME_COUNT);
+        count.count = n;
+        snapshot.conversions.push_back(count);
+    }
+    for (size_t i = 0; i < VALIDATION_OUTCOME_COUNT; ++i) {
+        snapshot.validations[i] = totals.validations[i] - baseline.validations[i];
+    }
+    snapshot.compare_calls = totals.compare_calls - baseline.compare_calls;
+    snapshot.compare_nodes = totals.compare_nodes - baseline.compare_nodes;
+    snapshot.compare_structs = totals.compare_structs - baseline.compare_structs;
+    return snapshot;
+}
+
+void reset_instrumentation() {
+    Registry& r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    r.baseline = totals_locked(r);
+}
+
+namespace detail {
+
+void count_conversion(ValueType from, ValueType to, ConversionOutcome outcome) noexcept {
+    bump(local().conversions[conversion_slot(from, to, outcome)]);
+}
+
+void count_validation(ValidationOutcome outcome) noexcept {
+    bump(local().validations[static_cast<size_t>(outcome)]);
+}
+
+void count_compare_call() noexcept {
+    bump(local().compare_calls);
+}
+
+void count_compare_node() noexcept {
+    bump(local().compare_nodes);
+}
+
+void count_compare_struct() noexcept {
+    bump(local().compare_structs);
+}
+
+} // namespace detail
+
+} // namespace vss::types
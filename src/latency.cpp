@@ -0,0 +1,268 @@
+/**
+ * @file latency.cpp
+ * @brief Implementation of latency histograms and stage instrumentation
+ */
+
+#include <vss/types/latency.hpp>
+#include <vss/types/clock.hpp>
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+namespace vss::types {
+
+namespace detail {
+std::array<std::atomic<LatencyRecorder*>, PIPELINE_STAGE_COUNT> stage_recorders{};
+} // namespace detail
+
+namespace {
+
+// Threads get consecutive ids on first use, so up to shard_count threads
+// record into distinct shards
+std::atomic<size_t> next_thread_id{0};
+
+size_t thread_id() noexcept {
+    thread_local const size_t id = next_thread_id.fetch_add(1, std::memory_order_relaxed);
+    return id;
+}
+
+int64_t clamp_ns(std::chrono::nanoseconds latency) noexcept {
+    return std::max<int64_t>(0, latency.count());
+}
+
+} // namespace
+
+// ============================================================================
+// LatencyHistogram
+// ============================================================================
+
+LatencyHistogram::LatencyHistogram()
+    : counts_(BUCKET_COUNT, 0) {}
+
+void LatencyHistogram::record(std::chrono::nanoseconds latency, uint64_t n) noexcept {
+    if (n == 0) {
+        return;
+    }
+    const int64_t ns = clamp_ns(latency);
+    counts_[bucket_index(ns)] += n;
+    min_ = count_ == 0 ? ns : std::min(min_, ns);
+    max_ = std::max(max_, ns);
+    count_ += n;
+    sum_ns_ += static_cast<uint64_t>(ns) * n;
+}
+
+void LatencyHistogram::merge(const LatencyHistogram& other) noexcept {
+    if (other.count_ == 0) {
+        return;
+    }
+    for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+        counts_[i] += other.counts_[i];
+    }
+    min_ = count_ == 0 ? other.min_ : std::min(min_, other.min_);
+    max_ = std::max(max_, other.max_);
+    count_ += other.count_;
+    sum_ns_ += other.sum_ns_;
+}
+
+std::optional<std::chrono::nanoseconds> LatencyHistogram::quantile(double q) const {
+    if (count_ == 0 || !(q >= 0.0 && q <= 1.0)) {
+        return std::nullopt;
+    }
+    if (q == 0.0) {
+        return min();
+    }
+    const uint64_t rank = std::clamp<uint64_t>(static_cast<uint64_t>(std::ceil(q * static_cast<double>(count_))),
+                                               1, count_);
+    uint64_t seen = 0;
+    for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+        seen += counts_[i];
+        if (seen >= rank) {
+            return std::chrono::nanoseconds(std::clamp(bucket_upper(i), min_, max_));
+        }
+    }
+    return std::chrono::nanoseconds(max_);
+}
+
+LatencySummary LatencyHistogram::summary() const {
+    LatencySummary s;
+    s.count = count_;
+    if (count_ == 0) {
+        return s;
+    }
+    s.min = min();
+    s.mean = mean();
+    s.max = max();
+
+    // One pass for all percentiles
+    const double qs[] = {0.5, 0.9, 0.99, 0.999};
+    std::chrono::nanoseconds* outs[] = {&s.p50, &s.p90, &s.p99, &s.p999};
+    size_t next = 0;
+    uint64_t seen = 0;
+    for (size_t i = 0; i < BUCKET_COUNT && next < 4; ++i) {
+        seen += counts_[i];
+        while (next < 4) {
+            const uint64_t rank = std::max<uint64_t>(
+                1, static_cast<uint64_t>(std::ceil(qs[next] * static_cast<double>(count_))));
+            if (seen < rank) {
+                break;
+            }
+            *outs[next++] = std::chrono::nanoseconds(std::clamp(bucket_upper(i), min_, max_));
+        }
+    }
+    return s;
+}
+
+std::chrono::nanoseconds LatencyHistogram::mean() const noexcept {
+    return std::chrono::nanoseconds(count_ ? static_cast<int64_t>(sum_ns_ / count_) : 0);
+}
+
+void LatencyHistogram::clear() noexcept {
+    std::fill(counts_.begin(), counts_.end(), 0);
+    count_ = 0;
+    sum_ns_ = 0;
+    min_ = 0;
+    max_ = 0;
+}
+
+int64_t LatencyHistogram::bucket_lower(size_t index) noexcept {
+    if (index < static_cast<size_t>(2 * SUB_BUCKET_COUNT)) {
+        return static_cast<int64_t>(index);
+    }
+    const size_t shift = index / SUB_BUCKET_COUNT - 1;
+    const int64_t mantissa = static_cast<int64_t>(index - shift * SUB_BUCKET_COUNT);
+    return mantissa << shift;
+}
+
+int64_t LatencyHistogram::bucket_upper(size_t index) noexcept {
+    if (index < static_cast<size_t>(2 * SUB_BUCKET_COUNT)) {
+        return static_cast<int64_t>(index);
+    }
+    const size_t shift = index / SUB_BUCKET_COUNT - 1;
+    return bucket_lower(index) + (int64_t(1) << shift) - 1;
+}
+
+// ============================================================================
+// LatencyRecorder
+// ============================================================================
+
+LatencyRecorder::LatencyRecorder(size_t shards)
+    : shard_count_(shards ? shards : std::max(1u, std::thread::hardware_concurrency())) {
+    shards_ = std::make_unique<Shard[]>(shard_count_);
+}
+
+void LatencyRecorder::record(std::chrono::nanoseconds latency, uint64_t n) noexcept {
+    if (n == 0) {
+        return;
+    }
+    const int64_t ns = clamp_ns(latency);
+    Shard& shard = shards_[thread_id() % shard_count_];
+    shard.counts[LatencyHistogram::bucket_index(ns)].fetch_add(n, std::memory_order_relaxed);
+    add(shard, static_cast<uint64_t>(ns) * n, ns, ns);
+}
+
+void LatencyRecorder::record_age(const DynamicQualifiedValue& value) noexcept {
+    record_age(value.timestamp, vss::types::now());
+}
+
+void LatencyRecorder::record_ages(const DynamicQualifiedValue* values, size_t count,
+                                  std::chrono::system_clock::time_point now) noexcept {
+    if (count == 0) {
+        return;
+    }
+    Shard& shard = shards_[thread_id() % shard_count_];
+    uint64_t sum = 0;
+    int64_t min = INT64_MAX;
+    int64_t max = 0;
+    for (size_t i = 0; i < count; ++i) {
+        const int64_t ns = clamp_ns(std::chrono::duration_cast<std::chrono::nanoseconds>(now - values[i].timestamp));
+        shard.counts[LatencyHistogram::bucket_index(ns)].fetch_add(1, std::memory_order_relaxed);
+        sum += static_cast<uint64_t>(ns);
+        min = std::min(min, ns);
+        max = std::max(max, ns);
+    }
+    add(shard, sum, min, max);
+}
+
+void LatencyRecorder::add(Shard& shard, uint64_t sum_ns, int64_t min, int64_t max) noexcept {
+    shard.sum_ns.fetch_add(sum_ns, std::memory_order_relaxed);
+
+    // Extremes rarely change; only write when they do
+    int64_t seen = shard.min.load(std::memory_order_relaxed);
+    while (min < seen && !shard.min.compare_exchange_weak(seen, min, std::memory_order_relaxed)) {
+    }
+    seen = shard.max.load(std::memory_order_relaxed);
+    while (max > seen && !shard.max.compare_exchange_weak(seen, max, std::memory_order_relaxed)) {
+    }
+}
+
+LatencyHistogram LatencyRecorder::snapshot() const {
+    LatencyHistogram histogram;
+    bool any = false;
+    for (size_t s = 0; s < shard_count_; ++s) {
+        // count_ is the sum of the buckets read, so it stays consistent
+        // with them while other threads keep recording
+        const Shard& shard = shards_[s];
+        uint64_t count = 0;
+        size_t lowest = 0;
+        size_t highest = 0;
+        for (size_t i = 0; i < LatencyHistogram::BUCKET_COUNT; ++i) {
+            const uint64_t n = shard.counts[i].load(std::memory_order_relaxed);
+            if (n == 0) {
+                continue;
+            }
+            lowest = count == 0 ? i : lowest;
+            highest = i;
+            histogram.counts_[i] += n;
+            count += n;
+        }
+        if (count == 0) {
+            continue;
+        }
+        // A bucket count can be visible before add() has updated the
+        // extremes; fall back to the bounds of the non-empty buckets
+        int64_t min = shard.min.load(std::memory_order_relaxed);
+        int64_t max = shard.max.load(std::memory_order_relaxed);
+        if (min > max) {
+            min = LatencyHistogram::bucket_lower(lowest);
+            max = LatencyHistogram::bucket_upper(highest);
+        }
+        histogram.min_ = any ? std::min(histogram.min_, min) : min;
+        histogram.max_ = std::max(histogram.max_, max);
+        histogram.count_ += count;
+        histogram.sum_ns_ += shard.sum_ns.load(std::memory_order_relaxed);
+        any = true;
+    }
+    return histogram;
+}
+
+void LatencyRecorder::reset() noexcept {
+    for (size_t s = 0; s < shard_count_; ++s) {
+        Shard& shard = shards_[s];
+        for (auto& count : shard.counts) {
+            count.store(0, std::memory_order_relaxed);
+        }
+        shard.sum_ns.store(0, std::memory_order_relaxed);
+        shard.min.store(INT64_MAX, std::memory_order_relaxed);
+        shard.max.store(0, std::memory_order_relaxed);
+    }
+}
+
+// ============================================================================
+// Stage instrumentation
+// ============================================================================
+
+const char* pipeline_stage_to_string(PipelineStage stage) {
+    switch (stage) {
+        case PipelineStage::DECODE: return "DECODE";
+        case PipelineStage::CONVERSION: return "CONVERSION";
+        case PipelineStage::VALIDATION: return "VALIDATION";
+        case PipelineStage::DISPATCH: return "DISPATCH";
+    }
+    return "UNKNOWN";
+}
+
+LatencyRecorder* set_stage_recorder(PipelineStage stage, LatencyRecorder* recorder) noexcept {
+    return detail::stage_recorders[static_cast<size_t>(stage)].exchange(recorder, std::memory_order_acq_rel);
+}
+
+} // namespace vss::types
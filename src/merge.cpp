@@ -0,0 +1,126 @@
+/**
+ * @file merge.cpp
+ * @brief Implementation of update sources and the k-way merge
+ */
+
+#include <vss/types/merge.hpp>
+#include <vss/types/clock.hpp>
+#include <algorithm>
+#include <limits>
+
+namespace vss::types {
+
+namespace {
+
+int64_t timestamp_ns(const SignalUpdate& update) noexcept {
+    return detail::to_ns(update.value.timestamp);
+}
+
+} // namespace
+
+size_t VectorUpdateSource::pull(std::vector<SignalUpdate>& out, size_t max_count) {
+    const size_t count = std::min(max_count, updates_.size() - position_);
+    auto first = updates_.begin() + static_cast<std::ptrdiff_t>(position_);
+    out.insert(out.end(), std::make_move_iterator(first),
+               std::make_move_iterator(first + static_cast<std::ptrdiff_t>(count)));
+    position_ += count;
+    return count;
+}
+
+UpdateMerger::UpdateMerger(std::vector<UpdateSource*> sources, size_t batch_size)
+    : batch_size_(std::max<size_t>(1, batch_size)) {
+
+    sources.erase(std::remove(sources.begin(), sources.end(), nullptr), sources.end());
+    inputs_.resize(sources.size());
+    for (size_t i = 0; i < sources.size(); ++i) {
+        inputs_[i].source = sources[i];
+    }
+
+    while (leaves_ < inputs_.size()) {
+        leaves_ *= 2;
+    }
+    keys_.assign(leaves_, std::numeric_limits<int64_t>::max());
+    exhausted_.assign(leaves_, 1);
+    for (uint32_t leaf = 0; leaf < inputs_.size(); ++leaf) {
+        refill(leaf);
+    }
+
+    // Play the initial tournament bottom-up; winners[n] is the winner of subtree n
+    losers_.assign(leaves_, 0);
+    std::vector<uint32_t> winners(2 * static_cast<size_t>(leaves_));
+    for (uint32_t leaf = 0; leaf < leaves_; ++leaf) {
+        winners[leaves_ + leaf] = leaf;
+    }
+    for (uint32_t node = leaves_ - 1; node >= 1; --node) {
+        const uint32_t a = winners[2 * node];
+        const uint32_t b = winners[2 * node + 1];
+        const bool a_wins = less(a, b);
+        winners[node] = a_wins ? a : b;
+        losers_[node] = a_wins ? b : a;
+    }
+    winner_ = leaves_ > 1 ? winners[1] : 0;
+}
+
+void UpdateMerger::refill(uint32_t leaf) {
+    Input& input = inputs_[leaf];
+    input.buffer.clear();   // keeps capacity, so steady state does not allocate
+    input.position = 0;
+    if (input.source->pull(input.buffer, batch_size_) == 0 || input.buffer.empty()) {
+        keys_[leaf] = std::numeric_limits<int64_t>::max();
+        exhausted_[leaf] = 1;
+        return;
+    }
+    keys_[leaf] = timestamp_ns(input.buffer.front());
+    exhausted_[leaf] = 0;
+}
+
+void UpdateMerger::advance(uint32_t leaf) {
+    Input& input = inputs_[leaf];
+    if (++input.position < input.buffer.size()) {
+        keys_[leaf] = timestamp_ns(input.buffer[input.position]);
+    } else {
+        refill(leaf);
+    }
+
+    // Replay the path from the leaf to the root
+    uint32_t current = leaf;
+    for (uint32_t node = (leaf + leaves_) / 2; node >= 1; node /= 2) {
+        if (less(losers_[node], current)) {
+            std::swap(losers_[node], current);
+        }
+    }
+    winner_ = current;
+}
+
+bool UpdateMerger::next(SignalUpdate& out) {
+    if (done()) {
+        return false;
+    }
+    const uint32_t leaf = winner_;
+    Input& input = inputs_[leaf];
+    out = std::move(input.buffer[input.position]);
+    advance(leaf);
+    return true;
+}
+
+size_t UpdateMerger::next_batch(std::vector<SignalUpdate>& out, size_t max_count) {
+    size_t count = 0;
+    while (count < max_count && !done()) {
+        const uint32_t leaf = winner_;
+        Input& input = inputs_[leaf];
+        out.push_back(std::move(input.buffer[input.position]));
+        advance(leaf);
+        ++count;
+    }
+    return count;
+}
+
+const SignalUpdate* UpdateMerger::peek() const noexcept {
+    if (done()) {
+        return nullptr;
+    }
+    const Input& input = inputs_[winner_];
+    return &input.buffer[input.position];
+}
+
+} // namespace vss::types
@@ -0,0 +1,157 @@
+/**
+ * @file pool.cpp
+ * @brief Implementation of the work-stealing thread pool
+ */
+
+#include <vss/types/pool.hpp>
+#include <algorithm>
+#include <utility>
+
+namespace vss::types {
+
+namespace {
+
+// Queue of the current thread, if it is running tasks of a pool
+thread_local const WorkStealingPool* current_pool = nullptr;
+thread_local size_t current_queue = 0;
+
+} // namespace
+
+WorkStealingPool::WorkStealingPool(size_t threads) {
+    if (threads == 0) {
+        const size_t hardware = std::thread::hardware_concurrency();
+        threads = hardware > 1 ? hardware - 1 : 0;
+    }
+
+    queues_.reserve(threads + 1);
+    for (size_t i = 0; i < threads + 1; ++i) {
+        queues_.push_back(std::make_unique<Queue>());
+    }
+    threads_.reserve(threads);
+    for (size_t i = 0; i < threads; ++i) {
+        threads_.emplace_back([this, i] { worker_loop(i); });
+    }
+}
+
+WorkStealingPool::~WorkStealingPool() {
+    {
+        std::lock_guard<std::mutex> lock(sleep_mutex_);
+        stop_.store(true, std::memory_order_relaxed);
+    }
+    wake_.notify_all();
+    for (auto& thread : threads_) {
+        thread.join();
+    }
+}
+
+void WorkStealingPool::submit(Task task) {
+    size_t index;
+    if (current_pool == this) {
+        index = current_queue;
+    } else if (threads_.empty()) {
+        index = queues_.size() - 1;
+    } else {
+        index = next_queue_.fetch_add(1, std::memory_order_relaxed) % threads_.size();
+    }
+
+    pending_.fetch_add(1, std::memory_order_relaxed);
+    {
+        std::lock_guard<std::mutex> lock(queues_[index]->mutex);
+        queues_[index]->tasks.push_back(std::move(task));
+    }
+    {
+        // Taking the lock orders the increment with a sleeper's predicate check
+        std::lock_guard<std::mutex> lock(sleep_mutex_);
+        queued_.fetch_add(1, std::memory_order_release);
+    }
+    wake_.notify_one();
+}
+
+bool WorkStealingPool::try_run(size_t self) {
+    Task task;
+    {
+        Queue& own = *queues_[self];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.tasks.empty()) {
+            task = std::move(own.tasks.back());
+            own.tasks.pop_back();
+        }
+    }
+    for (size_t k = 1; !task && k < queues_.size(); ++k) {
+        Queue& victim = *queues_[(self + k) % queues_.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty()) {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+        }
+    }
+    if (!task) {
+        return false;
+    }
+
+    queued_.fetch_sub(1, std::memory_order_relaxed);
+    std::exception_ptr error;
+    try {
+        task();
+    } catch (...) {
+        error = std::current_exception();
+    }
+    if (error) {
+        // Kept for wait(); the task still counts as finished
+        std::lock_guard<std::mutex> lock(sleep_mutex_);
+        if (!error_) {
+            error_ = std::move(error);
+        }
+    }
+    if (pending_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        std::lock_guard<std::mutex> lock(sleep_mutex_);
+        wake_.notify_all();
+    }
+    return true;
+}
+
+void WorkStealingPool::worker_loop(size_t index) {
+    current_pool = this;
+    current_queue = index;
+    while (!stop_.load(std::memory_order_relaxed)) {
+        if (try_run(index)) {
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(sleep_mutex_);
+        wake_.wait(lock, [this] {
+            return stop_.load(std::memory_order_relaxed) || queued_.load(std::memory_order_acquire) > 0;
+        });
+    }
+}
+
+void WorkStealingPool::wait() {
+    const WorkStealingPool* outer_pool = current_pool;
+    const size_t outer_queue = current_queue;
+    const size_t self = current_pool == this ? current_queue : queues_.size() - 1;
+    current_pool = this;
+    current_queue = self;
+
+    while (pending_.load(std::memory_order_acquire) > 0) {
+        if (try_run(self)) {
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(sleep_mutex_);
+        wake_.wait(lock, [this] {
+            return pending_.load(std::memory_order_acquire) == 0 || queued_.load(std::memory_order_acquire) > 0;
+        });
+    }
+
+    current_pool = outer_pool;
+    current_queue = outer_queue;
+
+    std::exception_ptr error;
+    {
+        std::lock_guard<std::mutex> lock(sleep_mutex_);
+        error = std::exchange(error_, nullptr);
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+} // namespace vss::types
@@ -0,0 +1,657 @@
+/**
+ * @file recording.cpp
+ * @brief Implementation of the binary recording writer and mapped reader
+ */
+
+#include <vss/types/recording.hpp>
+#include <vss/types/clock.hpp>
+#include <vss/types/enum.hpp>
+#include <algorithm>
+#include <filesystem>
+#include <limits>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define VSS_TYPES_HAVE_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace vss::types {
+
+namespace {
+
+using detail::to_ns;
+using detail::from_ns;
+
+using TimePoint = std::chrono::system_clock::time_point;
+
+constexpr char FILE_MAGIC[8] = {'V', 'S', 'S', 'R', 'E', 'C', '0', '1'};
+constexpr uint32_t BYTE_ORDER_MARK = 0x01020304u;
+constexpr uint32_t FORMAT_VERSION = 1;
+constexpr uint32_t CHUNK_MAGIC = 0x4B434856u;   // "VHCK"
+
+struct FileHeader {
+    char magic[8];
+    uint32_t byte_order;
+    uint32_t version;
+};
+static_assert(sizeof(FileHeader) == 16, "FileHeader layout");
+
+struct ChunkHeader {
+    uint32_t magic;
+    uint32_t records;
+    uint64_t payload_bytes;
+    int64_t min_time;
+    int64_t max_time;
+    uint64_t ids[4];    ///< Bit (id % 256) set for every id in the chunk
+};
+static_assert(sizeof(ChunkHeader) == 64, "ChunkHeader layout");
+
+struct RecordHeader {
+    int64_t timestamp;
+    uint32_t id;
+    uint8_t quality;
+    uint8_t type;
+    uint16_t reserved;
+    uint32_t size;
+    uint32_t count;
+};
+static_assert(sizeof(RecordHeader) == 24, "RecordHeader layout");
+
+constexpr size_t padded(size_t n) noexcept {
+    return (n + 7) & ~size_t{7};
+}
+
+bool valid_file_header(const FileHeader& header) noexcept {
+    return std::memcmp(header.magic, FILE_MAGIC, sizeof(FILE_MAGIC)) == 0
+        && header.byte_order == BYTE_ORDER_MARK && header.version == FORMAT_VERSION;
+}
+
+// A chunk at `offset` whose payload lies entirely inside a file of `file_size` bytes
+bool complete_chunk(const ChunkHeader& chunk, size_t offset, size_t file_size) noexcept {
+    return chunk.magic == CHUNK_MAGIC && offset + sizeof(ChunkHeader) <= file_size
+        && chunk.payload_bytes <= file_size - offset - sizeof(ChunkHeader);
+}
+
+// Bytes per element of a fixed-size type, 0 for strings and non-recordable types
+size_t element_size(ValueType type) noexcept {
+    switch (type) {
+        case ValueType::BOOL: case ValueType::INT8: case ValueType::UINT8:
+        case ValueType::BOOL_ARRAY: case ValueType::INT8_ARRAY: case ValueType::UINT8_ARRAY:
+            return 1;   // bools are stored as one byte
+        case ValueType::INT16: case ValueType::UINT16:
+        case ValueType::INT16_ARRAY: case ValueType::UINT16_ARRAY:
+            return 2;
+        case ValueType::INT32: case ValueType::UINT32: case ValueType::FLOAT:
+        case ValueType::INT32_ARRAY: case ValueType::UINT32_ARRAY: case ValueType::FLOAT_ARRAY:
+            return 4;
+        case ValueType::INT64: case ValueType::UINT64: case ValueType::DOUBLE:
+        case ValueType::INT64_ARRAY: case ValueType::UINT64_ARRAY: case ValueType::DOUBLE_ARRAY:
+            return 8;
+        default:
+            return 0;
+    }
+}
+
+template<typename T>
+struct is_numeric_vector : std::false_type {};
+
+template<typename T>
+struct is_numeric_vector<std::vector<T>> : std::bool_constant<std::is_arithmetic_v<T>> {};
+
+void set_id_bit(uint64_t* mask, SignalId id) noexcept {
+    const uint32_t bit = id % 256;
+    mask[bit / 64] |= uint64_t{1} << (bit % 64);
+}
+
+/**
+ * @brief Append a record (header, payload, padding) to a chunk buffer
+ */
+class RecordEncoder {
+public:
+    explicit RecordEncoder(std::vector<uint8_t>& out) : out_(out) {}
+
+    bool encode(SignalId id, const DynamicQualifiedValue& sample) {
+        header_.timestamp = to_ns(sample.timestamp);
+        header_.id = id;
+        header_.quality = static_cast<uint8_t>(sample.quality);
+        header_.reserved = 0;
+        header_.count = 1;
+
+        return std::visit([&](auto&& v) -> bool {
+            using T = std::decay_t<decltype(v)>;
+            if constexpr (std::is_same_v<T, std::monostate>) {
+                return put(ValueType::UNSPECIFIED, nullptr, 0, 0);
+            } else if constexpr (std::is_arithmetic_v<T>) {
+                return put(get_value_type<T>(), &v, sizeof(T), 1);
+            } else if constexpr (std::is_same_v<T, std::string>) {
+                return put(ValueType::STRING, v.data(), v.size(), 1);
+            } else if constexpr (std::is_same_v<T, EnumValue>) {
+                const std::string& s = v.str();
+                return put(ValueType::STRING, s.data(), s.size(), 1);
+            } else if constexpr (std::is_same_v<T, std::vector<bool>>) {
+                const size_t start = begin(ValueType::BOOL_ARRAY, v.size(), v.size());
+                for (size_t i = 0; i < v.size(); ++i) {
+                    out_[start + i] = v[i] ? 1 : 0;
+                }
+                return true;
+            } else if constexpr (std::is_same_v<T, std::vector<std::string>>) {
+                return put_strings(v);
+            } else if constexpr (is_numeric_vector<T>::value) {
+                return put(get_value_type<T>(), v.data(), v.size() * sizeof(typename T::value_type), v.size());
+            } else {
+                // Structs are not recorded
+                return false;
+            }
+        }, sample.value);
+    }
+
+private:
+    /// Write the header and reserve the padded payload; returns the payload offset
+    size_t begin(ValueType type, size_t size, size_t count) {
+        header_.type = static_cast<uint8_t>(type);
+        header_.size = static_cast<uint32_t>(size);
+        header_.count = static_cast<uint32_t>(count);
+        const size_t at = out_.size();
+        out_.resize(at + sizeof(RecordHeader) + padded(size), 0);
+        std::memcpy(out_.data() + at, &header_, sizeof(RecordHeader));
+        return at + sizeof(RecordHeader);
+    }
+
+    bool put(ValueType type, const void* data, size_t size, size_t count) {
+        if (size > std::numeric_limits<uint32_t>::max()) {
+            return false;
+        }
+        const size_t start = begin(type, size, count);
+        if (size > 0) {
+            std::memcpy(out_.data() + start, data, size);
+        }
+        return true;
+    }
+
+    bool put_strings(const std::vector<std::string>& v) {
+        // Offset table (count + 1 entries) followed by the characters
+        const size_t table = (v.size() + 1) * sizeof(uint32_t);
+        size_t chars = 0;
+        for (const auto& s : v) {
+            chars += s.size();
+        }
+        if (table + chars > std::numeric_limits<uint32_t>::max()) {
+            return false;
+        }
+        const size_t start = begin(ValueType::STRING_ARRAY, table + chars, v.size());
+        uint32_t offset = 0;
+        for (size_t i = 0; i <= v.size(); ++i) {
+            std::memcpy(out_.data() + start + i * sizeof(uint32_t), &offset, sizeof(uint32_t));
+            if (i < v.size()) {
+                std::memcpy(out_.data() + start + table + offset, v[i].data(), v[i].size());
+                offset += static_cast<uint32_t>(v[i].size());
+            }
+        }
+        return true;
+    }
+
+    std::vector<uint8_t>& out_;
+    RecordHeader header_{};
+};
+
+template<typename T>
+Value copy_array(const RecordView& r) {
+    const T* first = r.array<T>();
+    return first ? Value{std::vector<T>(first, first + r.count)} : Value{};
+}
+
+template<typename T>
+Value copy_scalar(const RecordView& r) {
+    const auto v = r.scalar<T>();
+    return v ? Value{*v} : Value{};
+}
+
+template<typename T>
+std::optional<double> scalar_as_double(const RecordView& r) noexcept {
+    const auto v = r.scalar<T>();
+    return v ? std::optional<double>(static_cast<double>(*v)) : std::nullopt;
+}
+
+} // namespace
+
+// RecordingWriter
+
+RecordingWriter::RecordingWriter(RecordingOptions options)
+    : options_(options) {
+    options_.chunk_bytes = std::max<size_t>(options_.chunk_bytes, 256);
+}
+
+RecordingWriter::~RecordingWriter() {
+    close();
+}
+
+bool RecordingWriter::open(const std::string& path, bool append) {
+    close();
+
+    if (append) {
+        std::FILE* existing = std::fopen(path.c_str(), "rb");
+        if (existing) {
+            // Walk the chunks like the reader does; a chunk cut short by a
+            // crash is dropped so new chunks start on a chunk boundary
+            std::error_code ec;
+            const auto file_size = static_cast<size_t>(std::filesystem::file_size(path, ec));
+            FileHeader header{};
+            bool valid = !ec && std::fread(&header, sizeof(header), 1, existing) == 1 && valid_file_header(header);
+            size_t end = sizeof(FileHeader);
+            uint64_t records = 0;
+            ChunkHeader chunk{};
+            while (valid && end + sizeof(ChunkHeader) <= file_size
+                   && std::fseek(existing, static_cast<long>(end), SEEK_SET) == 0
+                   && std::fread(&chunk, sizeof(chunk), 1, existing) == 1
+                   && complete_chunk(chunk, end, file_size)) {
+                records += chunk.records;
+                end += sizeof(ChunkHeader) + chunk.payload_bytes;
+            }
+            std::fclose(existing);
+            if (!valid) {
+                return false;
+            }
+            if (end != file_size) {
+                std::filesystem::resize_file(path, end, ec);
+                if (ec) {
+                    return false;
+                }
+            }
+            file_ = std::fopen(path.c_str(), "ab");
+            records_ = records;
+            return file_ != nullptr;
+        }
+    }
+
+    file_ = std::fopen(path.c_str(), "wb");
+    if (!file_) {
+        return false;
+    }
+    FileHeader header{};
+    std::memcpy(header.magic, FILE_MAGIC, sizeof(FILE_MAGIC));
+    header.byte_order = BYTE_ORDER_MARK;
+    header.version = FORMAT_VERSION;
+    if (std::fwrite(&header, sizeof(header), 1, file_) != 1) {
+        std::fclose(file_);
+        file_ = nullptr;
+        return false;
+    }
+    records_ = 0;
+    return true;
+}
+
+bool RecordingWriter::write(SignalId id, const DynamicQualifiedValue& sample) {
+    if (!file_) {
+        return false;
+    }
+    if (payload_.capacity() < options_.chunk_bytes) {
+        payload_.reserve(options_.chunk_bytes + 4096);
+    }
+
+    const size_t before = payload_.size();
+    RecordEncoder encoder(payload_);
+    if (!encoder.encode(id, sample)) {
+        payload_.resize(before);
+        return false;
+    }
+
+    const int64_t t = to_ns(sample.timestamp);
+    if (chunk_records_ == 0) {
+        chunk_min_ = t;
+        chunk_max_ = t;
+    } else {
+        chunk_min_ = std::min(chunk_min_, t);
+        chunk_max_ = std::max(chunk_max_, t);
+    }
+    set_id_bit(chunk_ids_, id);
+    ++chunk_records_;
+    ++records_;
+
+    if (payload_.size() >= options_.chunk_bytes) {
+        return write_chunk();
+    }
+    return true;
+}
+
+bool RecordingWriter::write_chunk() {
+    if (chunk_records_ == 0) {
+        return true;
+    }
+
+    ChunkHeader header{};
+    header.magic = CHUNK_MAGIC;
+    header.records = chunk_records_;
+    header.payload_bytes = payload_.size();
+    header.min_time = chunk_min_;
+    header.max_time = chunk_max_;
+    std::memcpy(header.ids, chunk_ids_, sizeof(header.ids));
+
+    const bool ok = std::fwrite(&header, sizeof(header), 1, file_) == 1
+        && std::fwrite(payload_.data(), 1, payload_.size(), file_) == payload_.size();
+
+    payload_.clear();
+    chunk_records_ = 0;
+    std::fill(std::begin(chunk_ids_), std::end(chunk_ids_), 0);
+    return ok;
+}
+
+bool RecordingWriter::flush() {
+    if (!file_) {
+        return false;
+    }
+    const bool ok = write_chunk();
+    return std::fflush(file_) == 0 && ok;
+}
+
+bool RecordingWriter::close() {
+    if (!file_) {
+        return true;
+    }
+    const bool ok = flush();
+    const bool closed = std::fclose(file_) == 0;
+    file_ = nullptr;
+    return ok && closed;
+}
+
+// RecordView
+
+std::optional<double> RecordView::as_double() const noexcept {
+    switch (type) {
+        case ValueType::BOOL:   return scalar_as_double<bool>(*this);
+        case ValueType::INT8:   return scalar_as_double<int8_t>(*this);
+        case ValueType::INT16:  return scalar_as_double<int16_t>(*this);
+        case ValueType::INT32:  return scalar_as_double<int32_t>(*this);
+        case ValueType::INT64:  return scalar_as_double<int64_t>(*this);
+        case ValueType::UINT8:  return scalar_as_double<uint8_t>(*this);
+        case ValueType::UINT16: return scalar_as_double<uint16_t>(*this);
+        case ValueType::UINT32: return scalar_as_double<uint32_t>(*this);
+        case ValueType::UINT64: return scalar_as_double<uint64_t>(*this);
+        case ValueType::FLOAT:  return scalar_as_double<float>(*this);
+        case ValueType::DOUBLE: return scalar<double>();
+        default:                return std::nullopt;
+    }
+}
+
+bool RecordView::well_formed() const noexcept {
+    switch (type) {
+        case ValueType::UNSPECIFIED:
+            return size == 0;
+        case ValueType::STRING:
+            return count == 1;
+        case ValueType::STRING_ARRAY: {
+            // Offset table of count + 1 ascending entries, ending inside the payload
+            const uint64_t table = (static_cast<uint64_t>(count) + 1) * sizeof(uint32_t);
+            if (table > size) {
+                return false;
+            }
+            uint32_t previous = 0;
+            for (size_t i = 0; i <= count; ++i) {
+                uint32_t offset;
+                std::memcpy(&offset, data + i * sizeof(uint32_t), sizeof(uint32_t));
+                if (offset < previous) {
+                    return false;
+                }
+                previous = offset;
+            }
+            return previous <= size - table;
+        }
+        default: {
+            const size_t element = element_size(type);
+            if (element == 0) {
+                return false;   // Not a recordable type
+            }
+            const uint64_t elements = is_array(type) ? count : 1;
+            return (is_array(type) || count == 1) && static_cast<uint64_t>(size) == elements * element;
+        }
+    }
+}
+
+std::string_view RecordView::as_string() const noexcept {
+    if (type != ValueType::STRING) {
+        return {};
+    }
+    return std::string_view(reinterpret_cast<const char*>(data), size);
+}
+
+std::string_view RecordView::string_at(size_t i) const noexcept {
+    const size_t table = (static_cast<size_t>(count) + 1) * sizeof(uint32_t);
+    if (type != ValueType::STRING_ARRAY || i >= count || table > size) {
+        return {};
+    }
+    uint32_t from;
+    uint32_t to;
+    std::memcpy(&from, data + i * sizeof(uint32_t), sizeof(uint32_t));
+    std::memcpy(&to, data + (i + 1) * sizeof(uint32_t), sizeof(uint32_t));
+    if (from > to || to > size - table) {
+        return {};
+    }
+    return std::string_view(reinterpret_cast<const char*>(data + table + from), to - from);
+}
+
+Value RecordView::to_value() const {
+    switch (type) {
+        case ValueType::UNSPECIFIED:  return Value{};
+        case ValueType::BOOL:         return copy_scalar<bool>(*this);
+        case ValueType::INT8:         return copy_scalar<int8_t>(*this);
+        case ValueType::INT16:        return copy_scalar<int16_t>(*this);
+        case ValueType::INT32:        return copy_scalar<int32_t>(*this);
+        case ValueType::INT64:        return copy_scalar<int64_t>(*this);
+        case ValueType::UINT8:        return copy_scalar<uint8_t>(*this);
+        case ValueType::UINT16:       return copy_scalar<uint16_t>(*this);
+        case ValueType::UINT32:       return copy_scalar<uint32_t>(*this);
+        case ValueType::UINT64:       return copy_scalar<uint64_t>(*this);
+        case ValueType::FLOAT:        return copy_scalar<float>(*this);
+        case ValueType::DOUBLE:       return copy_scalar<double>(*this);
+        case ValueType::STRING:       return Value{std::string(as_string())};
+        case ValueType::BOOL_ARRAY: {
+            const bool* bytes = array<bool>();
+            if (!bytes) {
+                return Value{};
+            }
+            std::vector<bool> v(count);
+            for (size_t i = 0; i < count; ++i) {
+                v[i] = data[i] != 0;
+            }
+            return Value{std::move(v)};
+        }
+        case ValueType::INT8_ARRAY:   return copy_array<int8_t>(*this);
+        case ValueType::INT16_ARRAY:  return copy_array<int16_t>(*this);
+        case ValueType::INT32_ARRAY:  return copy_array<int32_t>(*this);
+        case ValueType::INT64_ARRAY:  return copy_array<int64_t>(*this);
+        case ValueType::UINT8_ARRAY:  return copy_array<uint8_t>(*this);
+        case ValueType::UINT16_ARRAY: return copy_array<uint16_t>(*this);
+        case ValueType::UINT32_ARRAY: return copy_array<uint32_t>(*this);
+        case ValueType::UINT64_ARRAY: return copy_array<uint64_t>(*this);
+        case ValueType::FLOAT_ARRAY:  return copy_array<float>(*this);
+        case ValueType::DOUBLE_ARRAY: return copy_array<double>(*this);
+        case ValueType::STRING_ARRAY: {
+            if (!well_formed()) {
+                return Value{};
+            }
+            std::vector<std::string> v;
+            v.reserve(count);
+            for (size_t i = 0; i < count; ++i) {
+                v.emplace_back(string_at(i));
+            }
+            return Value{std::move(v)};
+        }
+        default:                      return Value{};
+    }
+}
+
+// RecordingReader
+
+RecordingReader::~RecordingReader() {
+    close();
+}
+
+bool RecordingReader::open(const std::string& path) {
+    close();
+
+#ifdef VSS_TYPES_HAVE_MMAP
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat st{};
+    if (::fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(sizeof(FileHeader))) {
+        ::close(fd);
+        return false;
+    }
+    void* mapping = ::mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (mapping == MAP_FAILED) {
+        return false;
+    }
+    data_ = static_cast<const uint8_t*>(mapping);
+    size_ = static_cast<size_t>(st.st_size);
+    mapped_ = true;
+#else
+    std::FILE* file = std::fopen(path.c_str(), "rb");
+    if (!file) {
+        return false;
+    }
+    std::fseek(file, 0, SEEK_END);
+    const long length = std::ftell(file);
+    std::fseek(file, 0, SEEK_SET);
+    if (length < static_cast<long>(sizeof(FileHeader))) {
+        std::fclose(file);
+        return false;
+    }
+    buffer_.resize(static_cast<size_t>(length));
+    const bool read_ok = std::fread(buffer_.data(), 1, buffer_.size(), file) == buffer_.size();
+    std::fclose(file);
+    if (!read_ok) {
+        buffer_.clear();
+        return false;
+    }
+    data_ = buffer_.data();
+    size_ = buffer_.size();
+#endif
+
+    FileHeader header{};
+    std::memcpy(&header, data_, sizeof(header));
+    if (!valid_file_header(header)) {
+        close();
+        return false;
+    }
+
+    // Build the chunk index; stop at the first incomplete chunk
+    size_t offset = sizeof(FileHeader);
+    while (offset + sizeof(ChunkHeader) <= size_) {
+        ChunkHeader chunk{};
+        std::memcpy(&chunk, data_ + offset, sizeof(chunk));
+        if (!complete_chunk(chunk, offset, size_)) {
+            break;
+        }
+        chunks_.push_back(ChunkInfo{offset, chunk.payload_bytes, chunk.records,
+                                    from_ns(chunk.min_time), from_ns(chunk.max_time)});
+        chunk_ids_.push_back({chunk.ids[0], chunk.ids[1], chunk.ids[2], chunk.ids[3]});
+        offset += sizeof(ChunkHeader) + chunk.payload_bytes;
+    }
+
+    return true;
+}
+
+void RecordingReader::close() noexcept {
+#ifdef VSS_TYPES_HAVE_MMAP
+    if (mapped_ && data_) {
+        ::munmap(const_cast<uint8_t*>(data_), size_);
+    }
+#endif
+    data_ = nullptr;
+    size_ = 0;
+    mapped_ = false;
+    buffer_.clear();
+    chunks_.clear();
+    chunk_ids_.clear();
+}
+
+size_t RecordingReader::scan(const RecordQuery& query, const std::function<void(const RecordView&)>& visit) const {
+    const bool open_begin = query.begin == TimePoint::min();
+    const bool open_end = query.end == TimePoint::max();
+    const int64_t begin = open_begin ? std::numeric_limits<int64_t>::min() : to_ns(query.begin);
+    const int64_t end = open_end ? std::numeric_limits<int64_t>::max() : to_ns(query.end);
+
+    // Id mask of the query, compared against each chunk's mask
+    uint64_t wanted[4] = {};
+    if (query.signals) {
+        query.signals->for_each([&](SignalId id) { set_id_bit(wanted, id); });
+    }
+
+    size_t visited = 0;
+    RecordView view;
+    for (size_t c = 0; c < chunks_.size(); ++c) {
+        const ChunkInfo& info = chunks_[c];
+        const int64_t chunk_min = to_ns(info.min_time);
+        const int64_t chunk_max = to_ns(info.max_time);
+        if (chunk_max < begin || (!open_end && chunk_min >= end)) {
+            continue;
+        }
+        if (query.signals) {
+            const auto& ids = chunk_ids_[c];
+            if (((ids[0] & wanted[0]) | (ids[1] & wanted[1]) | (ids[2] & wanted[2]) | (ids[3] & wanted[3])) == 0) {
+                continue;
+            }
+        }
+
+        const uint8_t* p = data_ + info.offset + sizeof(ChunkHeader);
+        const uint8_t* chunk_end = p + info.payload_bytes;
+        for (uint32_t r = 0; r < info.records; ++r) {
+            if (static_cast<size_t>(chunk_end - p) < sizeof(RecordHeader)) {
+                break;
+            }
+            RecordHeader header;
+            std::memcpy(&header, p, sizeof(header));
+            p += sizeof(RecordHeader);
+            if (static_cast<size_t>(chunk_end - p) < padded(header.size)) {
+                break;
+            }
+            const uint8_t* payload = p;
+            p += padded(header.size);
+
+            if (header.timestamp < begin || (!open_end && header.timestamp >= end)) {
+                continue;
+            }
+            if (query.signals && !query.signals->contains(header.id)) {
+                continue;
+            }
+
+            view.id = header.id;
+            view.timestamp = from_ns(header.timestamp);
+            view.quality = static_cast<SignalQuality>(header.quality);
+            view.type = static_cast<ValueType>(header.type);
+            view.data = payload;
+            view.size = header.size;
+            view.count = header.count;
+            if (!view.well_formed()) {
+                continue;   // Corrupt record: size does not match type and count
+            }
+            visit(view);
+            ++visited;
+        }
+    }
+
+    return visited;
+}
+
+std::vector<SignalUpdate> RecordingReader::read(const RecordQuery& query) const {
+    std::vector<SignalUpdate> result;
+    scan(query, [&](const RecordView& record) {
+        result.emplace_back(record.id, record.to_qualified());
+    });
+    return result;
+}
+
+uint64_t RecordingReader::record_count() const noexcept {
+    uint64_t total = 0;
+    for (const auto& chunk : chunks_) {
+        total += chunk.records;
+    }
+    return total;
+}
+
+} // namespace vss::types
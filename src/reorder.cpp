@@ -0,0 +1,115 @@
+/**
+ * @file reorder.cpp
+ * @brief Implementation of the watermark reorder buffer
+ */
+
+#include <vss/types/reorder.hpp>
+#include <vss/types/clock.hpp>
+#include <algorithm>
+#include <limits>
+
+namespace vss::types {
+
+namespace {
+
+using detail::to_ns;
+using detail::from_ns;
+
+constexpr int64_t MIN_NS = std::numeric_limits<int64_t>::min();
+
+} // namespace
+
+ReorderBuffer::ReorderBuffer(std::chrono::nanoseconds max_delay, size_t capacity)
+    : max_delay_(std::max<int64_t>(0, max_delay.count()))
+    , slots_(std::max<size_t>(1, capacity))
+    , newest_(MIN_NS)
+    , watermark_(MIN_NS)
+    , frontier_(MIN_NS) {
+
+    free_.reserve(slots_.size());
+    for (size_t i = slots_.size(); i > 0; --i) {
+        free_.push_back(static_cast<uint32_t>(i - 1));
+    }
+    heap_.reserve(slots_.size());
+}
+
+bool ReorderBuffer::push(SignalUpdate update) {
+    const int64_t key = to_ns(update.value.timestamp);
+    if (key < frontier_ || key < watermark_) {
+        ++late_count_;
+        if (late_) {
+            late_(std::move(update));
+        }
+        return false;
+    }
+
+    if (key > newest_) {
+        newest_ = key;
+        // Saturate instead of overflowing near time_point::min()
+        const int64_t candidate = key < MIN_NS + max_delay_ ? MIN_NS : key - max_delay_;
+        watermark_ = std::max(watermark_, candidate);
+    }
+
+    if (free_.empty()) {
+        ++forced_count_;
+        if (key < heap_.front().key) {
+            // Older than everything buffered: it is the next update in order
+            frontier_ = std::max(frontier_, key);
+            ++released_count_;
+            if (release_) {
+                release_(std::move(update));
+            }
+            release_ready();
+            return true;
+        }
+        release_top();
+    }
+
+    const uint32_t slot = free_.back();
+    free_.pop_back();
+    slots_[slot] = std::move(update);
+    heap_.push_back(Entry{key, sequence_++, slot});
+    std::push_heap(heap_.begin(), heap_.end(), Later{});
+
+    release_ready();
+    return true;
+}
+
+void ReorderBuffer::advance_watermark(std::chrono::system_clock::time_point watermark) {
+    watermark_ = std::max(watermark_, to_ns(watermark));
+    release_ready();
+}
+
+void ReorderBuffer::flush() {
+    while (!heap_.empty()) {
+        release_top();
+    }
+}
+
+std::chrono::system_clock::time_point ReorderBuffer::watermark() const noexcept {
+    if (watermark_ == MIN_NS) {
+        return std::chrono::system_clock::time_point::min();
+    }
+    return from_ns(watermark_);
+}
+
+void ReorderBuffer::release_top() {
+    std::pop_heap(heap_.begin(), heap_.end(), Later{});
+    const Entry top = heap_.back();
+    heap_.pop_back();
+
+    frontier_ = std::max(frontier_, top.key);
+    free_.push_back(top.slot);
+    ++released_count_;
+    if (release_) {
+        release_(std::move(slots_[top.slot]));
+    }
+}
+
+void ReorderBuffer::release_ready() {
+    while (!heap_.empty() && heap_.front().key <= watermark_) {
+        release_top();
+    }
+}
+
+} // namespace vss::types
@@ -0,0 +1,131 @@
+/**
+ * @file replay.cpp
+ * @brief Implementation of the replay engine
+ */
+
+#include <vss/types/replay.hpp>
+#include <vss/types/clock.hpp>
+#include <algorithm>
+#include <optional>
+#include <thread>
+
+namespace vss::types {
+
+namespace {
+
+using detail::to_ns;
+using detail::from_ns;
+
+} // namespace
+
+ReplayEngine::ReplayEngine(ReplayOptions options)
+    : options_(options) {
+    options_.speed = std::max(0.0, options_.speed);
+    options_.batch_size = std::max<size_t>(1, options_.batch_size);
+    options_.resolution = std::max(options_.resolution, std::chrono::nanoseconds(1));
+}
+
+void ReplayEngine::begin() {
+    stats_ = ReplayStats{};
+    batch_.clear();
+    batch_.reserve(options_.batch_size);
+    wall_start_ = std::chrono::steady_clock::now();
+}
+
+bool ReplayEngine::feed(SignalUpdate&& update) {
+    const int64_t t = to_ns(update.value.timestamp);
+    if (stats_.events == 0) {
+        first_ns_ = t;
+        newest_ns_ = t;
+        clock_.set(update.value.timestamp);
+    }
+
+    if (options_.speed > 0.0) {
+        const int64_t resolution = options_.resolution.count();
+        auto due = static_cast<int64_t>(static_cast<double>(std::max<int64_t>(0, t - first_ns_)) / options_.speed);
+        due -= due % resolution;
+        // Do not hold an update that is due now behind one that is due later
+        if (!batch_.empty() && due != batch_due_ns_) {
+            dispatch();
+        }
+        batch_due_ns_ = due;
+    }
+
+    newest_ns_ = std::max(newest_ns_, t);
+    batch_.push_back(std::move(update));
+    ++stats_.events;
+
+    if (batch_.size() >= options_.batch_size) {
+        dispatch();
+    }
+    return !stop_.load(std::memory_order_relaxed);
+}
+
+void ReplayEngine::dispatch() {
+    if (batch_.empty()) {
+        return;
+    }
+    if (options_.speed > 0.0) {
+        std::this_thread::sleep_until(wall_start_ + std::chrono::nanoseconds(batch_due_ns_));
+    }
+
+    clock_.set(from_ns(newest_ns_));
+    for (const auto& consumer : consumers_) {
+        consumer(batch_);
+    }
+    ++stats_.batches;
+    batch_.clear();
+}
+
+ReplayStats ReplayEngine::finish() {
+    dispatch();
+    // Cleared here rather than in begin(), so a stop() before the run is kept
+    stats_.stopped = stop_.exchange(false, std::memory_order_relaxed);
+    stats_.recorded_span = std::chrono::nanoseconds(stats_.events > 0 ? newest_ns_ - first_ns_ : 0);
+    stats_.wall_time = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - wall_start_);
+    return stats_;
+}
+
+ReplayStats ReplayEngine::run(UpdateSource& source) {
+    std::optional<ScopedClockSource> scope;
+    if (options_.drive_clock) {
+        scope.emplace(clock_);
+    }
+    begin();
+
+    std::vector<SignalUpdate> pulled;
+    pulled.reserve(options_.batch_size);
+    bool running = !stop_.load(std::memory_order_relaxed);
+    while (running && source.pull(pulled, options_.batch_size) > 0) {
+        for (auto& update : pulled) {
+            if (!feed(std::move(update))) {
+                running = false;
+                break;
+            }
+        }
+        pulled.clear();
+    }
+
+    return finish();
+}
+
+ReplayStats ReplayEngine::run(const RecordingReader& reader, const RecordQuery& query) {
+    std::optional<ScopedClockSource> scope;
+    if (options_.drive_clock) {
+        scope.emplace(clock_);
+    }
+    begin();
+
+    // scan() cannot be interrupted, so after stop() the remaining records are skipped
+    bool running = !stop_.load(std::memory_order_relaxed);
+    reader.scan(query, [&](const RecordView& record) {
+        if (running) {
+            running = feed(SignalUpdate{record.id, record.to_qualified()});
+        }
+    });
+
+    return finish();
+}
+
+} // namespace vss::types
@@ -0,0 +1,146 @@
+/**
+ * @file resample.cpp
+ * @brief Implementation of multi-signal resampling
+ */
+
+#include <vss/types/resample.hpp>
+#include <vss/types/clock.hpp>
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <limits>
+
+namespace vss::types {
+
+namespace {
+
+using detail::to_ns;
+using detail::from_ns;
+
+using TimePoint = std::chrono::system_clock::time_point;
+
+constexpr double NaN = std::numeric_limits<double>::quiet_NaN();
+
+bool usable(const SeriesView& in, size_t i) noexcept {
+    return in.quality(i) == SignalQuality::VALID && !std::isnan(in.values[i]);
+}
+
+/**
+ * @brief Fill one column with a single forward sweep over the samples
+ */
+void resample_column(const SeriesView& in, const std::vector<int64_t>& grid, const ResampleSpec& spec,
+                     double* values, SignalQuality* qualities) {
+    const bool limit = spec.max_staleness.has_value();
+    const int64_t staleness = limit ? spec.max_staleness->count() : 0;
+    const bool linear = spec.mode == InterpolationMode::LINEAR;
+
+    size_t next = 0;    // First sample after the grid point
+    for (size_t row = 0; row < grid.size(); ++row) {
+        const int64_t t = grid[row];
+        while (next < in.size && to_ns(in.timestamps[next]) <= t) {
+            ++next;
+        }
+
+        if (next == 0) {
+            values[row] = NaN;
+            qualities[row] = SignalQuality::NOT_AVAILABLE;
+            continue;
+        }
+
+        const size_t prev = next - 1;
+        const int64_t prev_t = to_ns(in.timestamps[prev]);
+        if (limit && t - prev_t > staleness) {
+            values[row] = NaN;
+            qualities[row] = SignalQuality::NOT_AVAILABLE;
+            continue;
+        }
+
+        if (!usable(in, prev)) {
+            const SignalQuality q = in.quality(prev);
+            values[row] = NaN;
+            qualities[row] = q == SignalQuality::VALID ? SignalQuality::NOT_AVAILABLE : q;
+            continue;
+        }
+
+        double v = in.values[prev];
+        if (linear && prev_t != t && next < in.size && usable(in, next)) {
+            const int64_t next_t = to_ns(in.timestamps[next]);
+            const double f = static_cast<double>(t - prev_t) / static_cast<double>(next_t - prev_t);
+            v += f * (in.values[next] - v);
+        }
+        values[row] = v;
+        qualities[row] = SignalQuality::VALID;
+    }
+}
+
+} // namespace
+
+const char* interpolation_mode_to_string(InterpolationMode mode) {
+    switch (mode) {
+        case InterpolationMode::ZERO_ORDER_HOLD: return "ZERO_ORDER_HOLD";
+        case InterpolationMode::LINEAR:          return "LINEAR";
+        default:                                 return "UNKNOWN";
+    }
+}
+
+std::optional<InterpolationMode> interpolation_mode_from_string(const std::string& str) {
+    // Convert to uppercase for case-insensitive matching
+    std::string upper = str;
+    std::transform(upper.begin(), upper.end(), upper.begin(),
+                   [](unsigned char c){ return std::toupper(c); });
+
+    if (upper == "ZERO_ORDER_HOLD" || upper == "ZOH" || upper == "HOLD")
+        return InterpolationMode::ZERO_ORDER_HOLD;
+    if (upper == "LINEAR") return InterpolationMode::LINEAR;
+
+    return std::nullopt;
+}
+
+ResampledTable resample(const std::vector<SeriesView>& inputs, const ResampleSpec& spec) {
+    ResampledTable table;
+    table.columns = inputs.size();
+
+    const int64_t period = spec.period.count();
+    const int64_t start = to_ns(spec.start);
+    const int64_t end = to_ns(spec.end);
+    if (period <= 0 || end <= start) {
+        return table;
+    }
+
+    const size_t rows = static_cast<size_t>((end - start - 1) / period) + 1;
+    std::vector<int64_t> grid(rows);
+    table.timestamps.resize(rows);
+    for (size_t row = 0; row < rows; ++row) {
+        grid[row] = start + static_cast<int64_t>(row) * period;
+        table.timestamps[row] = from_ns(grid[row]);
+    }
+
+    table.values.resize(rows * inputs.size());
+    table.qualities.resize(rows * inputs.size());
+    for (size_t c = 0; c < inputs.size(); ++c) {
+        resample_column(inputs[c], grid, spec, table.values.data() + c * rows, table.qualities.data() + c * rows);
+    }
+
+    return table;
+}
+
+ResampledTable resample(const std::vector<std::vector<DynamicQualifiedValue>>& histories,
+                        const ResampleSpec& spec) {
+    std::vector<SignalSeries> series(histories.size());
+    std::vector<SeriesView> views;
+    views.reserve(histories.size());
+
+    for (size_t c = 0; c < histories.size(); ++c) {
+        series[c].reserve(histories[c].size());
+        for (const auto& sample : histories[c]) {
+            if (!series[c].append(sample)) {
+                series[c].append(sample.timestamp, NaN, SignalQuality::INVALID);
+            }
+        }
+        views.push_back(series[c].view());
+    }
+
+    return resample(views, spec);
+}
+
+} // namespace vss::types
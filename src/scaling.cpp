@@ -0,0 +1,236 @@
+/**
+ * @file scaling.cpp
+ * @brief Implementation of batch linear scaling
+ */
+
+#include <vss/types/scaling.hpp>
+#include <vss/types/clock.hpp>
+#include <vss/types/latency.hpp>
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+
+#if defined(__AVX2__) && defined(__FMA__)
+#include <immintrin.h>
+#define VSS_TYPES_SCALING_AVX2 1
+#endif
+
+namespace vss::types {
+
+// Samples are staged through fixed-size stack blocks
+static constexpr size_t BLOCK_SIZE = 256;
+
+// Largest magnitude a float result can hold; anything beyond it is out of range
+static constexpr double FLOAT_LIMIT = std::numeric_limits<float>::max();
+
+// y = x * factor + offset and lo <= y <= hi for a block of doubles.
+// Returns the number of samples outside [lo, hi] (NaN included).
+static size_t scale_block(
+    const double* in,
+    size_t n,
+    double factor,
+    double offset,
+    double lo,
+    double hi,
+    double* out,
+    uint8_t* ok)
+{
+    size_t i = 0;
+    size_t bad = 0;
+
+#ifdef VSS_TYPES_SCALING_AVX2
+    const __m256d vfactor = _mm256_set1_pd(factor);
+    const __m256d voffset = _mm256_set1_pd(offset);
+    const __m256d vlo = _mm256_set1_pd(lo);
+    const __m256d vhi = _mm256_set1_pd(hi);
+    for (; i + 4 <= n; i += 4) {
+        __m256d y = _mm256_fmadd_pd(_mm256_loadu_pd(in + i), vfactor, voffset);
+        _mm256_storeu_pd(out + i, y);
+        __m256d good = _mm256_and_pd(_mm256_cmp_pd(y, vlo, _CMP_GE_OQ),
+                                     _mm256_cmp_pd(y, vhi, _CMP_LE_OQ));
+        int mask = _mm256_movemask_pd(good);
+        ok[i] = mask & 1;
+        ok[i + 1] = (mask >> 1) & 1;
+        ok[i + 2] = (mask >> 2) & 1;
+        ok[i + 3] = (mask >> 3) & 1;
+        bad += 4 - static_cast<size_t>(ok[i] + ok[i + 1] + ok[i + 2] + ok[i + 3]);
+    }
+#endif
+
+    for (; i < n; ++i) {
+        double y = in[i] * factor + offset;
+        out[i] = y;
+        uint8_t good = static_cast<uint8_t>((y >= lo) & (y <= hi));
+        ok[i] = good;
+        bad += 1u - good;
+    }
+    return bad;
+}
+
+template<typename Raw, typename Out>
+size_t scale_linear(
+    const Raw* raw,
+    size_t count,
+    const ScalingParams& params,
+    Out* out,
+    SignalQuality* quality)
+{
+    static_assert(std::is_integral_v<Raw> && !std::is_same_v<Raw, bool>, "Raw must be an integer type");
+    static_assert(std::is_floating_point_v<Out>, "Out must be float or double");
+
+    double lo = params.min.value_or(-std::numeric_limits<double>::infinity());
+    double hi = params.max.value_or(std::numeric_limits<double>::infinity());
+    if constexpr (std::is_same_v<Out, float>) {
+        lo = std::max(lo, -FLOAT_LIMIT);
+        hi = std::min(hi, FLOAT_LIMIT);
+    }
+
+    double staged[BLOCK_SIZE];
+    double scaled[BLOCK_SIZE];
+    uint8_t ok[BLOCK_SIZE];
+    size_t bad = 0;
+
+    for (size_t base = 0; base < count; base += BLOCK_SIZE) {
+        const size_t n = std::min(BLOCK_SIZE, count - base);
+
+        for (size_t i = 0; i < n; ++i) {
+            staged[i] = static_cast<double>(raw[base + i]);
+        }
+
+        bad += scale_block(staged, n, params.factor, params.offset, lo, hi, scaled, ok);
+
+        if constexpr (std::is_same_v<Out, float>) {
+            // Narrowing a double beyond float's range is undefined; saturate
+            for (size_t i = 0; i < n; ++i) {
+                const double y = scaled[i];
+                out[base + i] = y > FLOAT_LIMIT ? std::numeric_limits<float>::infinity()
+                              : y < -FLOAT_LIMIT ? -std::numeric_limits<float>::infinity()
+                              : static_cast<float>(y);
+            }
+        } else {
+            for (size_t i = 0; i < n; ++i) {
+                out[base + i] = scaled[i];
+            }
+        }
+        if (quality) {
+            for (size_t i = 0; i < n; ++i) {
+                quality[base + i] = ok[i] ? SignalQuality::VALID : SignalQuality::INVALID;
+            }
+        }
+    }
+    return bad;
+}
+
+template<typename Raw>
+size_t scale_into_slots(
+    const Raw* raw,
+    size_t count,
+    const ScalingParams& params,
+    ValueType target_type,
+    DynamicQualifiedValue* slots,
+    std::chrono::system_clock::time_point timestamp)
+{
+    if (target_type != ValueType::FLOAT && target_type != ValueType::DOUBLE) {
+        return count;
+    }
+
+    // Scaled in double; FLOAT slots also reject what float cannot hold
+    ScalingParams bounded = params;
+    if (target_type == ValueType::FLOAT) {
+        bounded.min = std::max(params.min.value_or(-FLOAT_LIMIT), -FLOAT_LIMIT);
+        bounded.max = std::min(params.max.value_or(FLOAT_LIMIT), FLOAT_LIMIT);
+    }
+
+    double scaled[BLOCK_SIZE];
+    SignalQuality quality[BLOCK_SIZE];
+    size_t bad = 0;
+
+    for (size_t base = 0; base < count; base += BLOCK_SIZE) {
+        const size_t n = std::min(BLOCK_SIZE, count - base);
+        bad += scale_linear(raw + base, n, bounded, scaled, quality);
+
+        for (size_t i = 0; i < n; ++i) {
+            DynamicQualifiedValue& slot = slots[base + i];
+            slot.quality = quality[i];
+            slot.timestamp = timestamp;
+            if (quality[i] != SignalQuality::VALID) {
+                slot.value = std::monostate{};
+            } else if (target_type == ValueType::FLOAT) {
+                slot.value = static_cast<float>(scaled[i]);
+            } else {
+                slot.value = scaled[i];
+            }
+        }
+    }
+
+    if (LatencyRecorder* recorder = stage_recorder(PipelineStage::CONVERSION)) {
+        recorder->record_age(timestamp, vss::types::now(), count);
+    }
+    return bad;
+}
+
+Value scale_array(
+    const Value& raw,
+    const ScalingParams& params,
+    ValueType target_type,
+    size_t* out_of_range)
+{
+    if (target_type != ValueType::FLOAT_ARRAY && target_type != ValueType::DOUBLE_ARRAY) {
+        return Value{std::monostate{}};
+    }
+
+    return std::visit([&](auto&& val) -> Value {
+        using T = std::decay_t<decltype(val)>;
+
+        if constexpr (std::is_same_v<T, std::vector<int8_t>> ||
+                      std::is_same_v<T, std::vector<int16_t>> ||
+                      std::is_same_v<T, std::vector<int32_t>> ||
+                      std::is_same_v<T, std::vector<int64_t>> ||
+                      std::is_same_v<T, std::vector<uint8_t>> ||
+                      std::is_same_v<T, std::vector<uint16_t>> ||
+                      std::is_same_v<T, std::vector<uint32_t>> ||
+                      std::is_same_v<T, std::vector<uint64_t>>) {
+            size_t bad;
+            Value result;
+            if (target_type == ValueType::FLOAT_ARRAY) {
+                std::vector<float> out(val.size());
+                bad = scale_linear(val.data(), val.size(), params, out.data(), nullptr);
+                result = std::move(out);
+            } else {
+                std::vector<double> out(val.size());
+                bad = scale_linear(val.data(), val.size(), params, out.data(), nullptr);
+                result = std::move(out);
+            }
+            if (out_of_range) {
+                *out_of_range = bad;
+            }
+            return result;
+        } else {
+            return Value{std::monostate{}};
+        }
+    }, raw);
+}
+
+// Explicit instantiations for all integer raw types
+
+#define VSS_TYPES_INSTANTIATE_SCALING(Raw)                                              \
+    template size_t scale_linear<Raw, float>(const Raw*, size_t, const ScalingParams&,  \
+                                             float*, SignalQuality*);                   \
+    template size_t scale_linear<Raw, double>(const Raw*, size_t, const ScalingParams&, \
+                                              double*, SignalQuality*);                 \
+    template size_t scale_into_slots<Raw>(const Raw*, size_t, const ScalingParams&,     \
+                                          ValueType, DynamicQualifiedValue*,            \
+                                          std::chrono::system_clock::time_point);
+
+VSS_TYPES_INSTANTIATE_SCALING(int8_t)
+VSS_TYPES_INSTANTIATE_SCALING(int16_t)
+VSS_TYPES_INSTANTIATE_SCALING(int32_t)
+VSS_TYPES_INSTANTIATE_SCALING(int64_t)
+VSS_TYPES_INSTANTIATE_SCALING(uint8_t)
+VSS_TYPES_INSTANTIATE_SCALING(uint16_t)
+VSS_TYPES_INSTANTIATE_SCALING(uint32_t)
+VSS_TYPES_INSTANTIATE_SCALING(uint64_t)
+
+#undef VSS_TYPES_INSTANTIATE_SCALING
+
+} // namespace vss::types
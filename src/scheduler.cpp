@@ -0,0 +1,134 @@
+/**
+ * @file scheduler.cpp
+ * @brief Implementation of priority-aware update scheduling
+ */
+
+#include <vss/types/scheduler.hpp>
+#include <vss/types/clock.hpp>
+#include <vss/types/latency.hpp>
+#include <algorithm>
+
+namespace vss::types {
+
+namespace {
+
+using detail::to_ns;
+
+} // namespace
+
+UpdateScheduler::UpdateScheduler(const SignalCatalog& catalog, SchedulerOptions options)
+    : options_(options) {
+    classes_.assign(catalog.size(), static_cast<uint8_t>(PriorityClass::NORMAL));
+    budgets_ns_.assign(catalog.size(), 0);
+    for (SignalId id = 0; id < catalog.size(); ++id) {
+        const SignalNode* node = catalog.get(id);
+        classes_[id] = static_cast<uint8_t>(node->priority);
+        budgets_ns_[id] = std::max<int64_t>(0, node->latency_budget.count());
+    }
+
+    for (auto& weight : options_.weights) {
+        weight = std::max<uint32_t>(weight, 1);
+    }
+    for (auto& queue : queues_) {
+        queue = std::make_unique<MpmcQueue<SignalUpdate>>(options_.queue_capacity);
+    }
+}
+
+bool UpdateScheduler::submit(SignalUpdate update) {
+    const size_t c = static_cast<size_t>(priority(update.id));
+    if (!queues_[c]->try_push(std::move(update))) {
+        counters_[c].dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    counters_[c].submitted.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+size_t UpdateScheduler::dispatch(std::vector<SignalUpdate>& out, size_t max_count) {
+    // One clock read per call; counters are flushed once at the end
+    const int64_t now_ns = to_ns(vss::types::now());
+    LatencyRecorder* recorder = stage_recorder(PipelineStage::DISPATCH);
+    std::array<uint64_t, PRIORITY_CLASS_COUNT> dispatched{};
+    std::array<uint64_t, PRIORITY_CLASS_COUNT> misses{};
+    std::array<int64_t, PRIORITY_CLASS_COUNT> max_latency{};
+
+    size_t count = 0;
+    size_t idle = 0;    // Consecutive classes found empty
+    SignalUpdate update;
+    while (count < max_count && idle < PRIORITY_CLASS_COUNT) {
+        if (credit_ == 0) {
+            credit_ = options_.weights[cursor_];
+        }
+        if (!queues_[cursor_]->try_pop(update)) {
+            credit_ = 0;
+            cursor_ = (cursor_ + 1) % PRIORITY_CLASS_COUNT;
+            ++idle;
+            continue;
+        }
+        idle = 0;
+
+        const int64_t latency = std::max<int64_t>(0, now_ns - to_ns(update.value.timestamp));
+        const int64_t budget = update.id < budgets_ns_.size() ? budgets_ns_[update.id] : 0;
+        misses[cursor_] += budget > 0 && latency > budget;
+        max_latency[cursor_] = std::max(max_latency[cursor_], latency);
+        ++dispatched[cursor_];
+        if (recorder) {
+            recorder->record(std::chrono::nanoseconds(latency));
+        }
+
+        out.push_back(std::move(update));
+        ++count;
+        if (--credit_ == 0) {
+            cursor_ = (cursor_ + 1) % PRIORITY_CLASS_COUNT;
+        }
+    }
+
+    for (size_t c = 0; c < PRIORITY_CLASS_COUNT; ++c) {
+        if (dispatched[c] == 0) {
+            continue;
+        }
+        Counters& counters = counters_[c];
+        counters.dispatched.fetch_add(dispatched[c], std::memory_order_relaxed);
+        counters.deadline_misses.fetch_add(misses[c], std::memory_order_relaxed);
+        int64_t seen = counters.max_latency_ns.load(std::memory_order_relaxed);
+        while (max_latency[c] > seen &&
+               !counters.max_latency_ns.compare_exchange_weak(seen, max_latency[c], std::memory_order_relaxed)) {
+        }
+    }
+    return count;
+}
+
+size_t UpdateScheduler::pending() const noexcept {
+    size_t total = 0;
+    for (const auto& queue : queues_) {
+        total += queue->size();
+    }
+    return total;
+}
+
+size_t UpdateScheduler::pending(PriorityClass priority) const noexcept {
+    return queues_[static_cast<size_t>(priority)]->size();
+}
+
+PriorityStats UpdateScheduler::stats(PriorityClass priority) const noexcept {
+    const Counters& counters = counters_[static_cast<size_t>(priority)];
+    PriorityStats stats;
+    stats.submitted = counters.submitted.load(std::memory_order_relaxed);
+    stats.dispatched = counters.dispatched.load(std::memory_order_relaxed);
+    stats.dropped = counters.dropped.load(std::memory_order_relaxed);
+    stats.deadline_misses = counters.deadline_misses.load(std::memory_order_relaxed);
+    stats.max_latency = std::chrono::nanoseconds(counters.max_latency_ns.load(std::memory_order_relaxed));
+    return stats;
+}
+
+void UpdateScheduler::reset_stats() noexcept {
+    for (auto& counters : counters_) {
+        counters.submitted.store(0, std::memory_order_relaxed);
+        counters.dispatched.store(0, std::memory_order_relaxed);
+        counters.dropped.store(0, std::memory_order_relaxed);
+        counters.deadline_misses.store(0, std::memory_order_relaxed);
+        counters.max_latency_ns.store(0, std::memory_order_relaxed);
+    }
+}
+
+} // namespace vss::types
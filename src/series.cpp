@@ -0,0 +1,65 @@
+/**
+ * @file series.cpp
+ * @brief Implementation of columnar signal history
+ */
+
+#include <vss/types/series.hpp>
+#include <algorithm>
+#include <limits>
+
+namespace vss::types {
+
+SeriesView SeriesView::subview(size_t offset, size_t count) const noexcept {
+    offset = std::min(offset, size);
+    count = std::min(count, size - offset);
+    return SeriesView{
+        timestamps ? timestamps + offset : nullptr,
+        values ? values + offset : nullptr,
+        qualities ? qualities + offset : nullptr,
+        count
+    };
+}
+
+bool SignalSeries::append(const DynamicQualifiedValue& sample) {
+    if (is_empty(sample.value)) {
+        append_missing(sample.timestamp, sample.quality);
+        return true;
+    }
+
+    bool numeric = std::visit([](auto&& v) -> bool {
+        using T = std::decay_t<decltype(v)>;
+        return std::is_arithmetic_v<T>;
+    }, sample.value);
+    if (!numeric) {
+        return false;
+    }
+
+    append(sample.timestamp, to_double(sample.value), sample.quality);
+    return true;
+}
+
+void SignalSeries::append_missing(std::chrono::system_clock::time_point timestamp, SignalQuality quality) {
+    append(timestamp, std::numeric_limits<double>::quiet_NaN(),
+           quality == SignalQuality::VALID ? SignalQuality::NOT_AVAILABLE : quality);
+}
+
+void SignalSeries::reserve(size_t count) {
+    timestamps_.reserve(count);
+    values_.reserve(count);
+    qualities_.reserve(count);
+}
+
+void SignalSeries::clear() noexcept {
+    timestamps_.clear();
+    values_.clear();
+    qualities_.clear();
+}
+
+void SignalSeries::erase_front(size_t count) {
+    count = std::min(count, values_.size());
+    timestamps_.erase(timestamps_.begin(), timestamps_.begin() + static_cast<std::ptrdiff_t>(count));
+    values_.erase(values_.begin(), values_.begin() + static_cast<std::ptrdiff_t>(count));
+    qualities_.erase(qualities_.begin(), qualities_.begin() + static_cast<std::ptrdiff_t>(count));
+}
+
+} // namespace vss::types
@@ -0,0 +1,501 @@
+/**
+ * @file stats.cpp
+ * @brief Implementation of streaming windowed statistics
+ */
+
+#include <vss/types/stats.hpp>
+#include <vss/types/clock.hpp>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace vss::types {
+
+namespace {
+
+using detail::to_ns;
+using detail::from_ns;
+
+// Runs are reduced through fixed-size stack blocks
+constexpr size_t BLOCK_SIZE = 256;
+
+// Independent accumulators, so the reductions do not serialize on one
+// floating point dependency chain
+constexpr size_t LANES = 4;
+
+int64_t floor_to(int64_t t, int64_t step) {
+    int64_t q = t / step;
+    if (t % step < 0) {
+        --q;
+    }
+    return q * step;
+}
+
+} // namespace
+
+// ============================================================================
+// RunningStats
+// ============================================================================
+
+void RunningStats::add(double x) noexcept {
+    if (count == 0) {
+        min = max = x;
+    } else {
+        min = std::min(min, x);
+        max = std::max(max, x);
+    }
+    ++count;
+    double delta = x - mean;
+    mean += delta / static_cast<double>(count);
+    m2 += delta * (x - mean);
+}
+
+void RunningStats::merge(const RunningStats& other) noexcept {
+    if (other.count == 0) {
+        return;
+    }
+    if (count == 0) {
+        *this = other;
+        return;
+    }
+    double na = static_cast<double>(count);
+    double nb = static_cast<double>(other.count);
+    double n = na + nb;
+    double delta = other.mean - mean;
+    mean += delta * nb / n;
+    m2 += other.m2 + delta * delta * na * nb / n;
+    count += other.count;
+    min = std::min(min, other.min);
+    max = std::max(max, other.max);
+}
+
+double RunningStats::stddev() const noexcept {
+    return std::sqrt(variance());
+}
+
+// ============================================================================
+// QuantileSketch
+// ============================================================================
+
+// Smallest magnitude with its own bucket; anything below counts as zero
+static const double MIN_INDEXABLE = std::numeric_limits<double>::min() * 4.0;
+
+QuantileSketch::QuantileSketch(double relative_accuracy, size_t max_buckets)
+    : relative_accuracy_(relative_accuracy > 0.0 && relative_accuracy < 1.0 ? relative_accuracy : 0.01)
+    , gamma_((1.0 + relative_accuracy_) / (1.0 - relative_accuracy_))
+    , log_gamma_(std::log(gamma_))
+    , max_buckets_(std::max<size_t>(max_buckets, 16))
+{
+}
+
+int32_t QuantileSketch::key(double magnitude) const {
+    return static_cast<int32_t>(std::ceil(std::log(magnitude) / log_gamma_));
+}
+
+double QuantileSketch::value(int32_t key) const {
+    // Midpoint of (gamma^(key-1), gamma^key] with relative error bound
+    return std::exp(static_cast<double>(key) * log_gamma_) * 2.0 / (gamma_ + 1.0);
+}
+
+void QuantileSketch::Store::add(int32_t key, uint64_t n) {
+    const int32_t size = static_cast<int32_t>(bins.size());
+
+    if (total == 0) {
+        offset = key - size / 2;
+    } else if (key < offset || key >= offset + size) {
+        // Occupied key range after adding key
+        const int32_t lo = std::min(offset + static_cast<int32_t>(first), key);
+        const int32_t hi = std::max(offset + static_cast<int32_t>(last), key);
+
+        // Center the occupied range if it fits, otherwise keep the highest
+        // keys and collapse everything below into the lowest bucket
+        const int32_t new_offset = (hi - lo < size) ? lo - (size - 1 - (hi - lo)) / 2 : hi - size + 1;
+
+        std::vector<uint64_t> shifted(bins.size(), 0);
+        size_t new_first = bins.size();
+        size_t new_last = 0;
+        for (size_t i = first; i <= last; ++i) {
+            if (bins[i] == 0) {
+                continue;
+            }
+            int32_t k = std::max(offset + static_cast<int32_t>(i), new_offset);
+            size_t index = static_cast<size_t>(k - new_offset);
+            shifted[index] += bins[i];
+            new_first = std::min(new_first, index);
+            new_last = std::max(new_last, index);
+        }
+        bins.swap(shifted);
+        offset = new_offset;
+        first = new_first;
+        last = new_last;
+    }
+
+    const size_t index = static_cast<size_t>(std::max(key, offset) - offset);
+    bins[index] += n;
+    if (total == 0) {
+        first = last = index;
+    } else {
+        first = std::min(first, index);
+        last = std::max(last, index);
+    }
+    total += n;
+}
+
+void QuantileSketch::Store::clear() noexcept {
+    if (total != 0) {
+        std::fill(bins.begin() + static_cast<std::ptrdiff_t>(first),
+                  bins.begin() + static_cast<std::ptrdiff_t>(last) + 1, 0);
+    }
+    total = 0;
+    offset = 0;
+    first = last = 0;
+}
+
+void QuantileSketch::add(double x) {
+    if (std::isnan(x)) {
+        return;
+    }
+    if (count_ == 0) {
+        min_ = max_ = x;
+    } else {
+        min_ = std::min(min_, x);
+        max_ = std::max(max_, x);
+    }
+    ++count_;
+
+    double magnitude = std::abs(x);
+    if (magnitude < MIN_INDEXABLE) {
+        ++zero_count_;
+        return;
+    }
+    Store& store = x > 0 ? positive_ : negative_;
+    if (store.bins.empty()) {
+        store.bins.assign(max_buckets_, 0);
+    }
+    store.add(key(magnitude), 1);
+}
+
+bool QuantileSketch::merge(const QuantileSketch& other) {
+    if (other.relative_accuracy_ != relative_accuracy_ || other.max_buckets_ != max_buckets_) {
+        return false;
+    }
+    if (other.count_ == 0) {
+        return true;
+    }
+
+    auto merge_store = [this](Store& into, const Store& from) {
+        if (from.total == 0) {
+            return;
+        }
+        if (into.bins.empty()) {
+            into.bins.assign(max_buckets_, 0);
+        }
+        if (into.total == 0) {
+            // Adopt the layout directly
+            std::copy(from.bins.begin() + static_cast<std::ptrdiff_t>(from.first),
+                      from.bins.begin() + static_cast<std::ptrdiff_t>(from.last) + 1,
+                      into.bins.begin() + static_cast<std::ptrdiff_t>(from.first));
+            into.offset = from.offset;
+            into.total = from.total;
+            into.first = from.first;
+            into.last = from.last;
+            return;
+        }
+        for (size_t i = from.first; i <= from.last; ++i) {
+            if (from.bins[i] != 0) {
+                into.add(from.offset + static_cast<int32_t>(i), from.bins[i]);
+            }
+        }
+    };
+    merge_store(positive_, other.positive_);
+    merge_store(negative_, other.negative_);
+
+    if (count_ == 0) {
+        min_ = other.min_;
+        max_ = other.max_;
+    } else {
+        min_ = std::min(min_, other.min_);
+        max_ = std::max(max_, other.max_);
+    }
+    zero_count_ += other.zero_count_;
+    count_ += other.count_;
+    return true;
+}
+
+std::optional<double> QuantileSketch::quantile(double q) const {
+    if (count_ == 0 || !(q >= 0.0 && q <= 1.0)) {
+        return std::nullopt;
+    }
+    if (q == 0.0) {
+        return min_;
+    }
+    if (q == 1.0) {
+        return max_;
+    }
+
+    const double rank = q * static_cast<double>(count_ - 1);
+    double cumulative = 0.0;
+    double result = 0.0;
+    bool found = false;
+
+    // Most negative values first: negative store from the highest key down
+    if (negative_.total != 0) {
+        for (size_t i = negative_.last + 1; i-- > negative_.first && !found;) {
+            cumulative += static_cast<double>(negative_.bins[i]);
+            if (cumulative > rank) {
+                result = -value(negative_.offset + static_cast<int32_t>(i));
+                found = true;
+            }
+        }
+    }
+    if (!found) {
+        cumulative += static_cast<double>(zero_count_);
+        if (cumulative > rank) {
+            result = 0.0;
+            found = true;
+        }
+    }
+    if (!found && positive_.total != 0) {
+        for (size_t i = positive_.first; i <= positive_.last && !found; ++i) {
+            cumulative += static_cast<double>(positive_.bins[i]);
+            if (cumulative > rank) {
+                result = value(positive_.offset + static_cast<int32_t>(i));
+                found = true;
+            }
+        }
+    }
+    if (!found) {
+        result = max_;
+    }
+    return std::clamp(result, min_, max_);
+}
+
+void QuantileSketch::clear() noexcept {
+    positive_.clear();
+    negative_.clear();
+    zero_count_ = 0;
+    count_ = 0;
+    min_ = max_ = 0.0;
+}
+
+// ============================================================================
+// WindowAggregator
+// ============================================================================
+
+WindowAggregator::WindowAggregator(WindowSpec spec)
+    : spec_(std::move(spec))
+    , merged_(spec_.relative_accuracy, spec_.max_buckets)
+{
+    if (spec_.width.count() <= 0) {
+        spec_.width = std::chrono::seconds(1);
+    }
+    if (spec_.slide.count() <= 0 || spec_.width.count() % spec_.slide.count() != 0) {
+        spec_.slide = spec_.width;
+    }
+    slide_ns_ = spec_.slide.count();
+
+    size_t pane_count = static_cast<size_t>(spec_.width.count() / slide_ns_);
+    panes_.reserve(pane_count);
+    for (size_t i = 0; i < pane_count; ++i) {
+        panes_.push_back(Pane{RunningStats{}, QuantileSketch{spec_.relative_accuracy, spec_.max_buckets}, 0});
+    }
+    result_.percentiles.resize(spec_.percentiles.size());
+}
+
+void WindowAggregator::start(int64_t t) {
+    pane_start_ = floor_to(t, slide_ns_);
+    started_ = true;
+}
+
+void WindowAggregator::advance_to(int64_t t) {
+    while (t >= pane_start_ + slide_ns_) {
+        bool any = std::any_of(panes_.begin(), panes_.end(), [](const Pane& p) { return !p.empty(); });
+        if (!any) {
+            // Nothing left to report: jump over the gap
+            pane_start_ = floor_to(t, slide_ns_);
+            return;
+        }
+        close_pane();
+    }
+}
+
+void WindowAggregator::close_pane() {
+    emit(pane_start_ + slide_ns_);
+
+    head_ = (head_ + 1) % panes_.size();
+    Pane& next = panes_[head_];
+    next.stats.clear();
+    next.sketch.clear();
+    next.excluded = 0;
+    pane_start_ += slide_ns_;
+}
+
+void WindowAggregator::emit(int64_t window_end) {
+    result_.stats.clear();
+    result_.excluded = 0;
+    merged_.clear();
+    for (const Pane& pane : panes_) {
+        result_.stats.merge(pane.stats);
+        result_.excluded += pane.excluded;
+        if (!spec_.percentiles.empty()) {
+            merged_.merge(pane.sketch);
+        }
+    }
+    if (result_.stats.count == 0 && result_.excluded == 0) {
+        return;
+    }
+
+    for (size_t i = 0; i < spec_.percentiles.size(); ++i) {
+        result_.percentiles[i] = merged_.quantile(spec_.percentiles[i])
+                                     .value_or(std::numeric_limits<double>::quiet_NaN());
+    }
+    result_.start = from_ns(window_end - spec_.width.count());
+    result_.end = from_ns(window_end);
+
+    if (callback_) {
+        callback_(result_);
+    }
+}
+
+void WindowAggregator::add(std::chrono::system_clock::time_point timestamp, double value, SignalQuality quality) {
+    int64_t t = to_ns(timestamp);
+    if (!started_) {
+        start(t);
+    }
+    if (t < pane_start_) {
+        ++late_;
+        return;
+    }
+    advance_to(t);
+
+    Pane& pane = current();
+    if (quality == SignalQuality::VALID && !std::isnan(value)) {
+        pane.stats.add(value);
+        if (!spec_.percentiles.empty()) {
+            pane.sketch.add(value);
+        }
+    } else {
+        ++pane.excluded;
+    }
+}
+
+void WindowAggregator::add(const DynamicQualifiedValue& sample) {
+    bool numeric = std::visit([](auto&& v) -> bool {
+        using T = std::decay_t<decltype(v)>;
+        return std::is_arithmetic_v<T>;
+    }, sample.value);
+
+    if (numeric) {
+        add(sample.timestamp, to_double(sample.value), sample.quality);
+    } else {
+        add(sample.timestamp, 0.0, SignalQuality::NOT_AVAILABLE);
+    }
+}
+
+void WindowAggregator::add_batch(const SeriesView& samples) {
+    size_t i = 0;
+    while (i < samples.size) {
+        int64_t t = to_ns(samples.timestamps[i]);
+        if (!started_) {
+            start(t);
+        }
+        if (t < pane_start_) {
+            ++late_;
+            ++i;
+            continue;
+        }
+        advance_to(t);
+
+        // Extend the run while samples stay inside the current pane
+        const int64_t pane_end = pane_start_ + slide_ns_;
+        size_t j = i + 1;
+        while (j < samples.size) {
+            int64_t tj = to_ns(samples.timestamps[j]);
+            if (tj < pane_start_ || tj >= pane_end) {
+                break;
+            }
+            ++j;
+        }
+
+        add_run(samples.values + i, samples.qualities ? samples.qualities + i : nullptr, j - i);
+        i = j;
+    }
+}
+
+void WindowAggregator::add_run(const double* values, const SignalQuality* qualities, size_t count) {
+    Pane& pane = current();
+    uint8_t ok[BLOCK_SIZE];
+    const double inf = std::numeric_limits<double>::infinity();
+
+    for (size_t base = 0; base < count; base += BLOCK_SIZE) {
+        const size_t n = std::min(BLOCK_SIZE, count - base);
+        const double* v = values + base;
+
+        // Pass 1: validity mask (VALID and not NaN)
+        if (qualities) {
+            const SignalQuality* q = qualities + base;
+            for (size_t k = 0; k < n; ++k) {
+                ok[k] = static_cast<uint8_t>((q[k] == SignalQuality::VALID) & (v[k] == v[k]));
+            }
+        } else {
+            for (size_t k = 0; k < n; ++k) {
+                ok[k] = static_cast<uint8_t>(v[k] == v[k]);
+            }
+        }
+
+        // Pass 2: count, sum, min, max over masked values
+        size_t valid = 0;
+        double sum[LANES] = {};
+        double lo[LANES] = {inf, inf, inf, inf};
+        double hi[LANES] = {-inf, -inf, -inf, -inf};
+        for (size_t k = 0; k < n; ++k) {
+            const size_t lane = k % LANES;
+            const bool use = ok[k] != 0;
+            valid += ok[k];
+            sum[lane] += use ? v[k] : 0.0;
+            lo[lane] = std::min(lo[lane], use ? v[k] : inf);
+            hi[lane] = std::max(hi[lane], use ? v[k] : -inf);
+        }
+
+        pane.excluded += n - valid;
+        if (valid == 0) {
+            continue;
+        }
+
+        // Pass 3: squared deviations from the block mean
+        const double mean = (sum[0] + sum[1] + sum[2] + sum[3]) / static_cast<double>(valid);
+        double m2[LANES] = {};
+        for (size_t k = 0; k < n; ++k) {
+            const double d = ok[k] ? v[k] - mean : 0.0;
+            m2[k % LANES] += d * d;
+        }
+
+        RunningStats block;
+        block.count = valid;
+        block.mean = mean;
+        block.m2 = m2[0] + m2[1] + m2[2] + m2[3];
+        block.min = std::min(std::min(lo[0], lo[1]), std::min(lo[2], lo[3]));
+        block.max = std::max(std::max(hi[0], hi[1]), std::max(hi[2], hi[3]));
+        pane.stats.merge(block);
+
+        if (!spec_.percentiles.empty()) {
+            for (size_t k = 0; k < n; ++k) {
+                if (ok[k]) {
+                    pane.sketch.add(v[k]);
+                }
+            }
+        }
+    }
+}
+
+void WindowAggregator::flush() {
+    if (!started_) {
+        return;
+    }
+    while (std::any_of(panes_.begin(), panes_.end(), [](const Pane& p) { return !p.empty(); })) {
+        close_pane();
+    }
+    started_ = false;
+}
+
+} // namespace vss::types
@@ -4,6 +4,7 @@
  */
 
 #include <vss/types/struct.hpp>
+#include <vss/types/instrumentation.hpp>
 #include <sstream>
 
 namespace vss::types {
@@ -30,17 +31,54 @@ void StructValue::set_field(std::string field_name, Value value) {
     fields_[std::move(field_name)] = std::move(value);
 }
 
-const Value* StructValue::get_field(const std::string& field_name) const {
+Value& StructValue::field_slot(std::string_view field_name) {
+    auto it = fields_.lower_bound(field_name);
+    if (it == fields_.end() || it->first != field_name) {
+        it = fields_.emplace_hint(it, std::string(field_name), Value{});
+    }
+    return it->second;
+}
+
+Value& StructValue::assign_field(std::string_view field_name, const Value& value) {
+    Value& slot = field_slot(field_name);
+    slot = value;  // Same alternative: copy-assigns into the existing buffer
+    return slot;
+}
+
+Value& StructValue::assign_field(std::string_view field_name, Value&& value) {
+    Value& slot = field_slot(field_name);
+    slot = std::move(value);
+    return slot;
+}
+
+void StructValue::set_fields(std::initializer_list<std::pair<std::string_view, Value>> fields) {
+    for (const auto& [name, value] : fields) {
+        assign_field(name, value);
+    }
+}
+
+void StructValue::set_fields(const std::vector<std::pair<std::string, Value>>& fields) {
+    for (const auto& [name, value] : fields) {
+        assign_field(name, value);
+    }
+}
+
+const Value* StructValue::get_field(std::string_view field_name) const {
     auto it = fields_.find(field_name);
     return (it != fields_.end()) ? &it->second : nullptr;
 }
 
-bool StructValue::has_field(const std::string& field_name) const {
+bool StructValue::has_field(std::string_view field_name) const {
     return fields_.find(field_name) != fields_.end();
 }
 
-bool StructValue::remove_field(const std::string& field_name) {
-    return fields_.erase(field_name) > 0;
+bool StructValue::remove_field(std::string_view field_name) {
+    auto it = fields_.find(field_name);
+    if (it == fields_.end()) {
+        return false;
+    }
+    fields_.erase(it);
+    return true;
 }
 
 void StructValue::clear() {
@@ -73,14 +111,17 @@ void StructRegistry::clear() {
 
 // Validation and utility functions
 
-std::optional<std::string> validate_struct(
+// Validation with the kind of the first error found
+static std::optional<std::string> validate_struct_impl(
     const StructValue& value,
     const StructRegistry& registry,
-    bool strict)
+    bool strict,
+    ValidationOutcome& outcome)
 {
     // Check if struct type is registered
     const auto* definition = registry.get_struct(value.type_name());
     if (!definition) {
+        outcome = ValidationOutcome::UNKNOWN_TYPE;
         return "Struct type '" + value.type_name() + "' not found in registry";
     }
 
@@ -89,6 +130,7 @@ std::optional<std::string> validate_struct(
         if (!value.has_field(field_name)) {
             // Check if field has a default value
             if (!field_def.default_value.has_value()) {
+                outcome = ValidationOutcome::MISSING_FIELD;
                 return "Required field '" + field_name + "' missing in struct '" +
                        value.type_name() + "'";
             }
@@ -98,6 +140,7 @@ std::optional<std::string> validate_struct(
             if (field_value) {
                 ValueType actual_type = get_value_type(*field_value);
                 if (!are_types_compatible(field_def.type, actual_type)) {
+                    outcome = ValidationOutcome::TYPE_MISMATCH;
                     std::ostringstream oss;
                     oss << "Field '" << field_name << "' in struct '" << value.type_name()
                         << "' has type " << value_type_to_string(actual_type)
@@ -105,11 +148,20 @@ std::optional<std::string> validate_struct(
                     return oss.str();
                 }
 
+                if (!field_def.constraints.empty()) {
+                    auto constraint_error = check_constraints(*field_value, field_def.constraints);
+                    if (constraint_error.has_value()) {
+                        outcome = ValidationOutcome::CONSTRAINT_VIOLATION;
+                        return "Field '" + field_name + "' in struct '" + value.type_name() +
+                               "': " + *constraint_error;
+                    }
+                }
+
                 // If field is a nested struct, validate recursively
                 if (field_def.type == ValueType::STRUCT) {
                     if (auto struct_ptr = std::get_if<std::shared_ptr<StructValue>>(field_value)) {
                         if (*struct_ptr) {
-                            auto nested_error = validate_struct(**struct_ptr, registry, strict);
+                            auto nested_error = validate_struct_impl(**struct_ptr, registry, strict, outcome);
                             if (nested_error.has_value()) {
                                 return "Nested struct field '" + field_name + "': " + *nested_error;
                             }
@@ -124,6 +176,7 @@ std::optional<std::string> validate_struct(
     if (strict) {
         for (const auto& [field_name, _] : value.fields()) {
             if (!definition->has_field(field_name)) {
+                outcome = ValidationOutcome::EXTRA_FIELD;
                 return "Extra field '" + field_name + "' not defined in struct type '" +
                        value.type_name() + "'";
             }
@@ -133,6 +186,17 @@ std::optional<std::string> validate_struct(
     return std::nullopt;  // Valid
 }
 
+std::optional<std::string> validate_struct(
+    const StructValue& value,
+    const StructRegistry& registry,
+    bool strict)
+{
+    ValidationOutcome outcome = ValidationOutcome::VALID;
+    auto error = validate_struct_impl(value, registry, strict, outcome);
+    VSS_TYPES_INSTRUMENT(detail::count_validation(outcome));
+    return error;
+}
+
 std::optional<StructValue> create_default_struct(
     const std::string& type_name,
     const StructRegistry& registry)
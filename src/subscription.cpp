@@ -0,0 +1,226 @@
+/**
+ * @file subscription.cpp
+ * @brief Implementation of wildcard path subscriptions
+ */
+
+#include <vss/types/subscription.hpp>
+#include <algorithm>
+#include <deque>
+#include <map>
+
+namespace vss::types {
+
+static const std::string WILDCARD_ONE = "*";
+static const std::string WILDCARD_ANY = "**";
+
+SubscriptionMatcher::SubscriptionMatcher(const SignalCatalog& catalog)
+    : catalog_(catalog) {
+    compile();
+}
+
+std::optional<PatternId> SubscriptionMatcher::add_pattern(std::string_view pattern) {
+    if (pattern.empty()) {
+        return std::nullopt;
+    }
+
+    // Split into segments; wildcards must span a whole segment
+    std::vector<std::string> segments;
+    size_t start = 0;
+    while (true) {
+        size_t end = pattern.find('.', start);
+        std::string_view segment = pattern.substr(start, end == std::string_view::npos ? end : end - start);
+        if (segment.empty()) {
+            return std::nullopt;
+        }
+        if (segment.find('*') != std::string_view::npos &&
+            segment != WILDCARD_ONE && segment != WILDCARD_ANY) {
+            return std::nullopt;
+        }
+        segments.emplace_back(segment);
+        if (end == std::string_view::npos) {
+            break;
+        }
+        start = end + 1;
+    }
+
+    PatternId id = static_cast<PatternId>(patterns_.size());
+    patterns_.push_back(Pattern{std::string(pattern), std::move(segments), 0});
+    compile();
+    return id;
+}
+
+void SubscriptionMatcher::refresh() {
+    for (size_t id = node_state_.size(); id < catalog_.size(); ++id) {
+        evaluate(static_cast<SignalId>(id));
+    }
+}
+
+const SignalSet& SubscriptionMatcher::signals(PatternId pattern) const noexcept {
+    static const SignalSet empty;
+    return pattern < matches_.size() ? matches_[pattern] : empty;
+}
+
+const std::vector<PatternId>& SubscriptionMatcher::match(SignalId id) const noexcept {
+    static const std::vector<PatternId> none;
+    if (id >= node_state_.size() || catalog_.get(id)->is_branch()) {
+        return none;
+    }
+    return dfa_[node_state_[id]].accepts;
+}
+
+const std::vector<PatternId>& SubscriptionMatcher::match(std::string_view path) const noexcept {
+    uint32_t state = start_;
+    size_t start = 0;
+    while (state != 0) {
+        size_t end = path.find('.', start);
+        state = step(state, path.substr(start, end == std::string_view::npos ? end : end - start));
+        if (end == std::string_view::npos) {
+            break;
+        }
+        start = end + 1;
+    }
+    return dfa_[state].accepts;
+}
+
+void SubscriptionMatcher::evaluate(SignalId id) {
+    const SignalNode* node = catalog_.get(id);
+    uint32_t parent_state = (node->parent == INVALID_SIGNAL_ID) ? start_ : node_state_[node->parent];
+    uint32_t state = step(parent_state, node->name());
+    node_state_.push_back(state);
+
+    if (!node->is_branch()) {
+        for (PatternId pattern : dfa_[state].accepts) {
+            matches_[pattern].insert(id);
+        }
+    }
+}
+
+uint32_t SubscriptionMatcher::step(uint32_t state, std::string_view segment) const noexcept {
+    const auto& next = dfa_[state].literal_next;
+    auto it = std::lower_bound(next.begin(), next.end(), segment,
+        [](const std::pair<std::string, uint32_t>& entry, std::string_view key) {
+            return std::string_view(entry.first) < key;
+        });
+    if (it != next.end() && it->first == segment) {
+        return it->second;
+    }
+    return dfa_[state].other_next;
+}
+
+std::vector<uint32_t> SubscriptionMatcher::closure(std::vector<uint32_t> states) const {
+    // "**" may match zero segments: being before it implies being after it
+    for (size_t i = 0; i < states.size(); ++i) {
+        uint32_t s = states[i];
+        const Pattern& p = patterns_[nfa_pattern_[s]];
+        size_t pos = s - p.first_state;
+        if (pos < p.segments.size() && p.segments[pos] == WILDCARD_ANY) {
+            states.push_back(s + 1);
+        }
+    }
+    std::sort(states.begin(), states.end());
+    states.erase(std::unique(states.begin(), states.end()), states.end());
+    return states;
+}
+
+std::vector<uint32_t> SubscriptionMatcher::advance(
+    const std::vector<uint32_t>& states,
+    const std::string* literal) const
+{
+    // literal == nullptr stands for "any segment no pattern names explicitly"
+    std::vector<uint32_t> next;
+    for (uint32_t s : states) {
+        const Pattern& p = patterns_[nfa_pattern_[s]];
+        size_t pos = s - p.first_state;
+        if (pos >= p.segments.size()) {
+            continue;
+        }
+        const std::string& segment = p.segments[pos];
+        if (segment == WILDCARD_ANY) {
+            next.push_back(s);
+        } else if (segment == WILDCARD_ONE || (literal && segment == *literal)) {
+            next.push_back(s + 1);
+        }
+    }
+    return closure(std::move(next));
+}
+
+void SubscriptionMatcher::compile() {
+    // Number the NFA states: pattern p at position i is first_state + i
+    nfa_pattern_.clear();
+    for (PatternId p = 0; p < patterns_.size(); ++p) {
+        patterns_[p].first_state = static_cast<uint32_t>(nfa_pattern_.size());
+        nfa_pattern_.insert(nfa_pattern_.end(), patterns_[p].segments.size() + 1, p);
+    }
+
+    // Subset construction; state 0 is dead (no NFA states)
+    dfa_.clear();
+    std::map<std::vector<uint32_t>, uint32_t> known;
+    std::deque<uint32_t> pending;
+
+    auto intern = [&](std::vector<uint32_t> nfa) -> uint32_t {
+        auto it = known.find(nfa);
+        if (it != known.end()) {
+            return it->second;
+        }
+        uint32_t index = static_cast<uint32_t>(dfa_.size());
+        known.emplace(nfa, index);
+        DfaState state;
+        state.nfa = std::move(nfa);
+        dfa_.push_back(std::move(state));
+        pending.push_back(index);
+        return index;
+    };
+
+    intern({});
+    std::vector<uint32_t> start;
+    for (const auto& p : patterns_) {
+        start.push_back(p.first_state);
+    }
+    start_ = intern(closure(std::move(start)));
+
+    while (!pending.empty()) {
+        uint32_t index = pending.front();
+        pending.pop_front();
+
+        // Copy: intern() may reallocate dfa_
+        std::vector<uint32_t> nfa = dfa_[index].nfa;
+
+        std::vector<PatternId> accepts;
+        std::vector<const std::string*> literals;
+        for (uint32_t s : nfa) {
+            const Pattern& p = patterns_[nfa_pattern_[s]];
+            size_t pos = s - p.first_state;
+            if (pos == p.segments.size()) {
+                accepts.push_back(nfa_pattern_[s]);
+            } else if (p.segments[pos] != WILDCARD_ONE && p.segments[pos] != WILDCARD_ANY) {
+                literals.push_back(&p.segments[pos]);
+            }
+        }
+        std::sort(literals.begin(), literals.end(),
+                  [](const std::string* a, const std::string* b) { return *a < *b; });
+        literals.erase(std::unique(literals.begin(), literals.end(),
+                                   [](const std::string* a, const std::string* b) { return *a == *b; }),
+                       literals.end());
+
+        std::vector<std::pair<std::string, uint32_t>> literal_next;
+        for (const std::string* literal : literals) {
+            literal_next.emplace_back(*literal, intern(advance(nfa, literal)));
+        }
+        uint32_t other_next = intern(advance(nfa, nullptr));
+
+        std::sort(accepts.begin(), accepts.end());
+        accepts.erase(std::unique(accepts.begin(), accepts.end()), accepts.end());
+
+        DfaState& state = dfa_[index];
+        state.accepts = std::move(accepts);
+        state.literal_next = std::move(literal_next);
+        state.other_next = other_next;
+    }
+
+    // Re-evaluate every catalog node against the new automaton
+    node_state_.clear();
+    matches_.assign(patterns_.size(), SignalSet(catalog_.size()));
+    refresh();
+}
+
+} // namespace vss::types
@@ -5,6 +5,7 @@
 
 #include <vss/types/value.hpp>
 #include <vss/types/struct.hpp>
+#include <vss/types/instrumentation.hpp>
 #include <algorithm>
 #include <cctype>
 #include <cmath>
@@ -68,6 +69,8 @@ ValueType get_value_type(const Value& value) {
             return ValueType::STRUCT;
         } else if constexpr (std::is_same_v<T, std::vector<std::shared_ptr<StructValue>>>) {
             return ValueType::STRUCT_ARRAY;
+        } else if constexpr (std::is_same_v<T, EnumValue>) {
+            return ValueType::STRING;
         } else {
             return ValueType::UNSPECIFIED;
         }
@@ -196,26 +199,8 @@ bool are_types_compatible(ValueType expected, ValueType actual) {
     return false;
 }
 
-Value convert_value_type(const Value& value, ValueType target_type) {
-    // Get current type
-    ValueType current_type = get_value_type(value);
-
-    // If already the right type, return unchanged
-    if (current_type == target_type) {
-        return value;
-    }
-
-    // If empty, return empty
-    if (current_type == ValueType::UNSPECIFIED) {
-        return value;
-    }
-
-    // Check if types are compatible
-    if (!are_types_compatible(target_type, current_type)) {
-        return Value{std::monostate{}};
-    }
-
-    // Perform conversion based on target type
+// Convert between compatible types; empty if a value is out of range
+static Value convert_compatible(const Value& value, ValueType target_type) {
     return std::visit([target_type](auto&& val) -> Value {
         using T = std::decay_t<decltype(val)>;
 
@@ -445,13 +430,59 @@ Value convert_value_type(const Value& value, ValueType target_type) {
     }, value);
 }
 
+Value convert_value_type(const Value& value, ValueType target_type) {
+    // Get current type
+    ValueType current_type = get_value_type(value);
+
+    // An EnumValue reports STRING; callers asking for STRING get its text
+    if (target_type == ValueType::STRING) {
+        if (auto e = std::get_if<EnumValue>(&value)) {
+            VSS_TYPES_INSTRUMENT(detail::count_conversion(current_type, target_type, ConversionOutcome::CONVERTED));
+            return Value{e->str()};
+        }
+    }
+
+    // If already the right type, or empty, return unchanged
+    if (current_type == target_type || current_type == ValueType::UNSPECIFIED) {
+        VSS_TYPES_INSTRUMENT(detail::count_conversion(current_type, target_type, ConversionOutcome::UNCHANGED));
+        return value;
+    }
+
+    // Check if types are compatible
+    if (!are_types_compatible(target_type, current_type)) {
+        VSS_TYPES_INSTRUMENT(detail::count_conversion(current_type, target_type, ConversionOutcome::INCOMPATIBLE));
+        return Value{std::monostate{}};
+    }
+
+    // Perform conversion based on target type
+    Value converted = convert_compatible(value, target_type);
+    VSS_TYPES_INSTRUMENT(detail::count_conversion(current_type, target_type,
+        is_empty(converted) ? ConversionOutcome::OUT_OF_RANGE : ConversionOutcome::CONVERTED));
+    return converted;
+}
+
 // Forward declaration for recursive struct comparison
 static bool structs_equal(const StructValue& a, const StructValue& b);
 
+// Text of a STRING value (std::string or EnumValue), nullptr otherwise
+static const std::string* string_of(const Value& value) {
+    if (auto s = std::get_if<std::string>(&value)) {
+        return s;
+    }
+    if (auto e = std::get_if<EnumValue>(&value)) {
+        return &e->str();
+    }
+    return nullptr;
+}
+
 // Helper for recursive value comparison
 static bool values_equal_impl(const Value& a, const Value& b) {
+    VSS_TYPES_INSTRUMENT(detail::count_compare_node());
     if (a.index() != b.index()) {
-        return false;
+        // Enum-coded and plain strings compare by text
+        const std::string* text_a = string_of(a);
+        const std::string* text_b = string_of(b);
+        return text_a && text_b && *text_a == *text_b;
     }
 
     return std::visit([&b](auto&& val_a) -> bool {
@@ -479,6 +510,8 @@ static bool values_equal_impl(const Value& a, const Value& b) {
 }
 
 static bool structs_equal(const StructValue& a, const StructValue& b) {
+    VSS_TYPES_INSTRUMENT(detail::count_compare_struct());
+
     // Compare type names
     if (a.type_name() != b.type_name()) {
         return false;
@@ -506,6 +539,7 @@ static bool structs_equal(const StructValue& a, const StructValue& b) {
 }
 
 bool values_equal(const Value& a, const Value& b) {
+    VSS_TYPES_INSTRUMENT(detail::count_compare_call());
     return values_equal_impl(a, b);
 }
 
@@ -533,9 +567,10 @@ double to_double(const Value& value) {
 }
 
 bool value_changed_beyond_threshold(const Value& old_val, const Value& new_val, double threshold) {
-    // If types differ, it's a change
+    // If types differ, it's a change (unless enum-coded vs plain string
+    // with the same text)
     if (old_val.index() != new_val.index()) {
-        return true;
+        return !values_equal(old_val, new_val);
     }
 
     // For numeric types, check threshold
@@ -0,0 +1,458 @@
+/**
+ * @file workload.cpp
+ * @brief Implementation of the synthetic workload generator
+ */
+
+#include <vss/types/workload.hpp>
+#include <vss/types/subscription.hpp>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+
+namespace vss::types {
+
+namespace {
+
+// Short enough for the small-string optimization, so string signals do
+// not allocate per update
+const std::array<std::string, 16> STRING_POOL = {
+    "OFF", "ON", "IDLE", "ACTIVE", "NORMAL", "SPORT", "ECO", "COMFORT",
+    "PARK", "DRIVE", "REVERSE", "NEUTRAL", "OPEN", "CLOSED", "LOCKED", "UNLOCKED",
+};
+
+constexpr double WALK_STEP = 0.01;      ///< Random walk step, fraction of the range
+constexpr double ARRAY_SPREAD = 0.05;   ///< Element spread around the level, fraction of the range
+constexpr double SWITCH_PROBABILITY = 0.05;  ///< Per update: bool toggles, enum switches
+
+uint64_t rotl(uint64_t x, int k) noexcept {
+    return (x << k) | (x >> (64 - k));
+}
+
+ValueType element_type(ValueType type) noexcept {
+    return is_array(type) && type != ValueType::STRUCT_ARRAY
+        ? static_cast<ValueType>(static_cast<int>(type) - 19)
+        : type;
+}
+
+bool is_unsigned(ValueType scalar) noexcept {
+    return scalar == ValueType::UINT8 || scalar == ValueType::UINT16 ||
+           scalar == ValueType::UINT32 || scalar == ValueType::UINT64;
+}
+
+struct Range {
+    double lo;
+    double hi;
+};
+
+// min/max of the constraints, else a moderate default for the type
+Range range_for(ValueType scalar, const ValueConstraints& constraints) {
+    Range range = is_unsigned(scalar) ? Range{0.0, 200.0} : Range{-100.0, 100.0};
+    if (constraints.min && constraints.max) {
+        range = {*constraints.min, *constraints.max};
+    } else if (constraints.min) {
+        range = {*constraints.min, *constraints.min + (range.hi - range.lo)};
+    } else if (constraints.max) {
+        range = {*constraints.max - (range.hi - range.lo), *constraints.max};
+    }
+    if (range.lo > range.hi) {
+        std::swap(range.lo, range.hi);
+    }
+    return range;
+}
+
+template<typename T>
+T to_numeric(double x) noexcept {
+    if constexpr (std::is_floating_point_v<T>) {
+        return static_cast<T>(x);
+    } else {
+        const double lo = static_cast<double>(std::numeric_limits<T>::min());
+        const double hi = static_cast<double>(std::numeric_limits<T>::max());
+        x = std::round(x);
+        if (x <= lo) return std::numeric_limits<T>::min();
+        if (x >= hi) return std::numeric_limits<T>::max();
+        return static_cast<T>(x);
+    }
+}
+
+Value numeric_scalar(ValueType scalar, double x) {
+    switch (scalar) {
+        case ValueType::INT8: return Value{to_numeric<int8_t>(x)};
+        case ValueType::INT16: return Value{to_numeric<int16_t>(x)};
+        case ValueType::INT32: return Value{to_numeric<int32_t>(x)};
+        case ValueType::INT64: return Value{to_numeric<int64_t>(x)};
+        case ValueType::UINT8: return Value{to_numeric<uint8_t>(x)};
+        case ValueType::UINT16: return Value{to_numeric<uint16_t>(x)};
+        case ValueType::UINT32: return Value{to_numeric<uint32_t>(x)};
+        case ValueType::UINT64: return Value{to_numeric<uint64_t>(x)};
+        case ValueType::FLOAT: return Value{to_numeric<float>(x)};
+        case ValueType::DOUBLE: return Value{x};
+        default: return Value{};
+    }
+}
+
+template<typename T, typename Gen>
+Value fill_array(size_t n, Gen& gen) {
+    std::vector<T> v(n);
+    for (size_t i = 0; i < n; ++i) {
+        v[i] = to_numeric<T>(gen());
+    }
+    return Value{std::move(v)};
+}
+
+// Array of n numbers drawn from gen()
+template<typename Gen>
+Value numeric_array(ValueType scalar, size_t n, Gen&& gen) {
+    switch (scalar) {
+        case ValueType::INT8: return fill_array<int8_t>(n, gen);
+        case ValueType::INT16: return fill_array<int16_t>(n, gen);
+        case ValueType::INT32: return fill_array<int32_t>(n, gen);
+        case ValueType::INT64: return fill_array<int64_t>(n, gen);
+        case ValueType::UINT8: return fill_array<uint8_t>(n, gen);
+        case ValueType::UINT16: return fill_array<uint16_t>(n, gen);
+        case ValueType::UINT32: return fill_array<uint32_t>(n, gen);
+        case ValueType::UINT64: return fill_array<uint64_t>(n, gen);
+        case ValueType::FLOAT: return fill_array<float>(n, gen);
+        case ValueType::DOUBLE: return fill_array<double>(n, gen);
+        default: return Value{};
+    }
+}
+
+} // namespace
+
+// ============================================================================
+// Rng
+// ============================================================================
+
+void WorkloadGenerator::Rng::seed(uint64_t seed) noexcept {
+    // splitmix64 expands the seed into the four state words
+    for (auto& word : s) {
+        uint64_t z = (seed += 0x9e3779b97f4a7c15ULL);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        word = z ^ (z >> 31);
+    }
+}
+
+uint64_t WorkloadGenerator::Rng::next() noexcept {
+    const uint64_t result = rotl(s[1] * 5, 7) * 9;
+    const uint64_t t = s[1] << 17;
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = rotl(s[3], 45);
+    return result;
+}
+
+// ============================================================================
+// WorkloadGenerator
+// ============================================================================
+
+WorkloadGenerator::WorkloadGenerator(const SignalCatalog& catalog, const StructRegistry& registry,
+                                     WorkloadProfile profile)
+    : catalog_(catalog)
+    , registry_(registry)
+    , profile_(std::move(profile)) {
+
+    profile_.max_array_size = std::max(profile_.min_array_size, profile_.max_array_size);
+
+    rates_.assign(catalog_.size(), -1.0);
+    for (SignalId id = 0; id < catalog_.size(); ++id) {
+        const SignalNode* node = catalog_.get(id);
+        if (node->is_branch() || node->type == ValueType::UNSPECIFIED) {
+            continue;
+        }
+        rates_[id] = node->node_type == NodeType::ATTRIBUTE
+            ? 0.0
+            : profile_.class_rate_hz[static_cast<size_t>(node->priority)];
+    }
+
+    if (!profile_.rates.empty()) {
+        SubscriptionMatcher matcher(catalog_);
+        for (const auto& rule : profile_.rates) {
+            auto pattern = matcher.add_pattern(rule.pattern);
+            if (!pattern) {
+                continue;
+            }
+            matcher.signals(*pattern).for_each([&](SignalId id) { rates_[id] = rule.rate_hz; });
+        }
+    }
+
+    for (SignalId id = 0; id < catalog_.size(); ++id) {
+        const SignalNode* node = catalog_.get(id);
+        if (node->is_branch() || node->type == ValueType::UNSPECIFIED || rates_[id] < 0.0) {
+            rates_[id] = -1.0;
+            continue;
+        }
+        Track track;
+        track.id = id;
+        track.node = node;
+        if (is_struct(node->type)) {
+            track.definition = registry_.get_struct(node->struct_type_name);
+            if (!track.definition) {
+                rates_[id] = -1.0;
+                continue;
+            }
+        }
+        if (rates_[id] > 0.0) {
+            track.period_ns = std::max<int64_t>(1, std::llround(1e9 / rates_[id]));
+            total_rate_hz_ += rates_[id];
+        }
+        signal_ids_.push_back(id);
+        tracks_.push_back(track);
+    }
+
+    reset();
+}
+
+double WorkloadGenerator::rate_hz(SignalId id) const noexcept {
+    return id < rates_.size() ? rates_[id] : -1.0;
+}
+
+void WorkloadGenerator::reset() {
+    rng_.seed(profile_.seed);
+    generated_ = 0;
+    for (auto& track : tracks_) {
+        init_track(track);
+    }
+    schedule();
+}
+
+void WorkloadGenerator::init_track(Track& track) {
+    // Periodic signals start at a random phase so they do not all fire at once
+    track.next_ns = track.period_ns > 0
+        ? static_cast<int64_t>(rng_.below(static_cast<size_t>(track.period_ns)))
+        : 0;
+
+    const Range range = range_for(element_type(track.node->type), track.node->constraints);
+    track.lo = range.lo;
+    track.hi = range.hi;
+    track.level = range.lo + (range.hi - range.lo) * rng_.uniform();
+    track.array_size = profile_.min_array_size +
+                       rng_.below(profile_.max_array_size - profile_.min_array_size + 1);
+    track.choice = rng_.below(std::max(track.node->constraints.allowed.size(), STRING_POOL.size()));
+    track.flag = rng_.chance(0.5);
+    track.quality = SignalQuality::VALID;
+}
+
+bool WorkloadGenerator::fires_after(uint32_t a, uint32_t b) const noexcept {
+    return tracks_[a].next_ns != tracks_[b].next_ns ? tracks_[a].next_ns > tracks_[b].next_ns : a > b;
+}
+
+void WorkloadGenerator::schedule() {
+    heap_.resize(tracks_.size());
+    for (uint32_t i = 0; i < heap_.size(); ++i) {
+        heap_[i] = i;
+    }
+    auto later = [this](uint32_t a, uint32_t b) { return fires_after(a, b); };
+    std::make_heap(heap_.begin(), heap_.end(), later);
+}
+
+bool WorkloadGenerator::next(SignalUpdate& out) {
+    if (heap_.empty() || (profile_.max_updates > 0 && generated_ >= profile_.max_updates)) {
+        return false;
+    }
+    auto later = [this](uint32_t a, uint32_t b) { return fires_after(a, b); };
+
+    const uint32_t index = heap_.front();
+    Track& track = tracks_[index];
+    if (profile_.duration.count() > 0 && track.next_ns >= profile_.duration.count()) {
+        return false;
+    }
+
+    out.id = track.id;
+    Value value = make_value(track);
+    out.value = DynamicQualifiedValue(std::move(value), track.quality,
+                                      profile_.start + std::chrono::nanoseconds(track.next_ns));
+    ++generated_;
+
+    std::pop_heap(heap_.begin(), heap_.end(), later);
+    if (track.period_ns == 0) {
+        heap_.pop_back();
+    } else {
+        double period = static_cast<double>(track.period_ns);
+        if (profile_.jitter > 0.0) {
+            period *= 1.0 + profile_.jitter * (2.0 * rng_.uniform() - 1.0);
+        }
+        track.next_ns += std::max<int64_t>(1, std::llround(period));
+        std::push_heap(heap_.begin(), heap_.end(), later);
+    }
+    return true;
+}
+
+size_t WorkloadGenerator::pull(std::vector<SignalUpdate>& out, size_t max_count) {
+    size_t count = 0;
+    SignalUpdate update;
+    while (count < max_count && next(update)) {
+        out.push_back(std::move(update));
+        ++count;
+    }
+    return count;
+}
+
+Value WorkloadGenerator::make_value(Track& track) {
+    // Quality: VALID drops out now and then and recovers after a few updates
+    if (track.quality == SignalQuality::VALID) {
+        const double u = rng_.uniform();
+        if (u < profile_.invalid_probability) {
+            track.quality = SignalQuality::INVALID;
+        } else if (u < profile_.invalid_probability + profile_.unavailable_probability) {
+            track.quality = SignalQuality::NOT_AVAILABLE;
+        }
+    } else if (rng_.chance(profile_.recovery_probability)) {
+        track.quality = SignalQuality::VALID;
+    }
+    if (track.quality == SignalQuality::NOT_AVAILABLE) {
+        return Value{};
+    }
+
+    const SignalNode& node = *track.node;
+    const ValueType scalar = element_type(node.type);
+    const auto& allowed = node.constraints.allowed;
+
+    if (scalar == ValueType::BOOL) {
+        if (rng_.chance(SWITCH_PROBABILITY)) {
+            track.flag = !track.flag;
+        }
+    } else if (scalar == ValueType::STRING) {
+        if (rng_.chance(SWITCH_PROBABILITY)) {
+            track.choice = rng_.below(allowed.empty() ? STRING_POOL.size() : allowed.size());
+        }
+    } else if (!is_struct(node.type)) {
+        const double width = track.hi - track.lo;
+        track.level += width * WALK_STEP * (2.0 * rng_.uniform() - 1.0);
+        if (track.level < track.lo) track.level = 2.0 * track.lo - track.level;
+        if (track.level > track.hi) track.level = 2.0 * track.hi - track.level;
+        track.level = std::clamp(track.level, track.lo, track.hi);
+        if (!allowed.empty() && rng_.chance(SWITCH_PROBABILITY)) {
+            track.choice = rng_.below(allowed.size());
+        }
+    }
+
+    switch (node.type) {
+        case ValueType::BOOL:
+            return Value{track.flag};
+        case ValueType::STRING:
+            if (allowed.empty()) {
+                return Value{STRING_POOL[track.choice % STRING_POOL.size()]};
+            }
+            if (node.enum_dictionary) {
+                return Value{EnumValue{node.enum_dictionary,
+                                       static_cast<uint16_t>(track.choice % node.enum_dictionary->size())}};
+            }
+            return allowed[track.choice % allowed.size()];
+        case ValueType::STRING_ARRAY: {
+            std::vector<std::string> strings(track.array_size);
+            for (size_t i = 0; i < strings.size(); ++i) {
+                strings[i] = STRING_POOL[(track.choice + i) % STRING_POOL.size()];
+            }
+            return Value{std::move(strings)};
+        }
+        case ValueType::BOOL_ARRAY: {
+            std::vector<bool> bits(track.array_size);
+            for (size_t i = 0; i < bits.size(); ++i) {
+                bits[i] = track.flag != rng_.chance(SWITCH_PROBABILITY);
+            }
+            return Value{std::move(bits)};
+        }
+        case ValueType::STRUCT:
+            return make_struct(*track.definition, 1);
+        case ValueType::STRUCT_ARRAY: {
+            std::vector<std::shared_ptr<StructValue>> items(track.array_size);
+            for (auto& item : items) {
+                item = std::get<std::shared_ptr<StructValue>>(make_struct(*track.definition, 1));
+            }
+            return Value{std::move(items)};
+        }
+        default:
+            break;
+    }
+
+    if (is_array(node.type)) {
+        const double spread = (track.hi - track.lo) * ARRAY_SPREAD;
+        return numeric_array(scalar, track.array_size, [&] {
+            return std::clamp(track.level + spread * (2.0 * rng_.uniform() - 1.0), track.lo, track.hi);
+        });
+    }
+    if (!allowed.empty()) {
+        Value choice = convert_value_type(allowed[track.choice % allowed.size()], scalar);
+        if (!is_empty(choice)) {
+            return choice;
+        }
+    }
+    return numeric_scalar(scalar, track.level);
+}
+
+Value WorkloadGenerator::make_struct(const StructDefinition& definition, size_t depth) {
+    auto value = std::make_shared<StructValue>(definition.type_name());
+    if (depth <= profile_.max_struct_depth) {
+        for (const auto& [name, field] : definition.fields()) {
+            value->set_field(name, make_field(field, depth));
+        }
+    }
+    return Value{std::move(value)};
+}
+
+Value WorkloadGenerator::make_field(const FieldDefinition& field, size_t depth) {
+    const size_t length = profile_.min_array_size +
+                          rng_.below(profile_.max_array_size - profile_.min_array_size + 1);
+
+    if (is_struct(field.type)) {
+        const StructDefinition* nested = registry_.get_struct(field.struct_type_name);
+        auto make_one = [&] {
+            return nested ? std::get<std::shared_ptr<StructValue>>(make_struct(*nested, depth + 1))
+                          : std::make_shared<StructValue>(field.struct_type_name);
+        };
+        if (field.type == ValueType::STRUCT) {
+            return Value{make_one()};
+        }
+        std::vector<std::shared_ptr<StructValue>> items(length);
+        for (auto& item : items) {
+            item = make_one();
+        }
+        return Value{std::move(items)};
+    }
+
+    const ValueType scalar = element_type(field.type);
+    const auto& allowed = field.constraints.allowed;
+    if (!is_array(field.type) && !allowed.empty()) {
+        Value choice = convert_value_type(allowed[rng_.below(allowed.size())], scalar);
+        if (!is_empty(choice)) {
+            return choice;
+        }
+    }
+
+    switch (field.type) {
+        case ValueType::BOOL:
+            return Value{rng_.chance(0.5)};
+        case ValueType::STRING:
+            return Value{STRING_POOL[rng_.below(STRING_POOL.size())]};
+        case ValueType::STRING_ARRAY: {
+            std::vector<std::string> strings(length);
+            for (auto& s : strings) {
+                s = STRING_POOL[rng_.below(STRING_POOL.size())];
+            }
+            return Value{std::move(strings)};
+        }
+        case ValueType::BOOL_ARRAY: {
+            std::vector<bool> bits(length);
+            for (size_t i = 0; i < bits.size(); ++i) {
+                bits[i] = rng_.chance(0.5);
+            }
+            return Value{std::move(bits)};
+        }
+        default:
+            break;
+    }
+
+    const Range range = range_for(scalar, field.constraints);
+    auto uniform = [&] { return range.lo + (range.hi - range.lo) * rng_.uniform(); };
+    if (is_array(field.type)) {
+        return numeric_array(scalar, length, uniform);
+    }
+    return numeric_scalar(scalar, uniform());
+}
+
+} // namespace vss::types
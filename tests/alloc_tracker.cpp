@@ -0,0 +1,225 @@
+/**
+ * @file alloc_tracker.cpp
+ * @brief Counting replacements of the global operator new/delete
+ *
+ * Linked into every test binary and the benchmark (see alloc_tracker.hpp).
+ */
+
+#include "alloc_tracker.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <mutex>
+#include <new>
+
+namespace vss::types::test {
+
+namespace {
+
+struct Counters {
+    uint64_t allocations;
+    uint64_t deallocations;
+    uint64_t bytes;
+};
+
+// Trivial type: no TLS init guard, usable from operator new at any time
+thread_local Counters local_counts{};
+
+std::atomic<uint64_t> global_allocations{0};
+std::atomic<uint64_t> global_deallocations{0};
+std::atomic<uint64_t> global_bytes{0};
+
+AllocationStats read(AllocationScope::Threads threads) {
+    AllocationStats stats;
+    if (threads == AllocationScope::THIS_THREAD) {
+        stats.allocations = local_counts.allocations;
+        stats.deallocations = local_counts.deallocations;
+        stats.bytes = local_counts.bytes;
+    } else {
+        stats.allocations = global_allocations.load(std::memory_order_relaxed);
+        stats.deallocations = global_deallocations.load(std::memory_order_relaxed);
+        stats.bytes = global_bytes.load(std::memory_order_relaxed);
+    }
+    return stats;
+}
+
+struct ReportEntry {
+    uint64_t calls = 0;
+    AllocationStats total;
+};
+
+// Printed when the program exits
+struct Report {
+    std::mutex mutex;
+    std::map<std::string, ReportEntry> entries;
+
+    ~Report() {
+        if (entries.empty()) {
+            return;
+        }
+        std::printf("\nAllocations per call (track_allocations)\n");
+        std::printf("%-40s %8s %12s %12s\n", "Name", "Calls", "Allocs/call", "Bytes/call");
+        for (const auto& [name, entry] : entries) {
+            const double calls = static_cast<double>(entry.calls);
+            std::printf("%-40s %8llu %12.1f %12.1f\n", name.c_str(),
+                        static_cast<unsigned long long>(entry.calls),
+                        static_cast<double>(entry.total.allocations) / calls,
+                        static_cast<double>(entry.total.bytes) / calls);
+        }
+    }
+};
+
+Report& report() {
+    static Report instance;
+    return instance;
+}
+
+} // namespace
+
+AllocationScope::AllocationScope(Threads threads)
+    : threads_(threads)
+    , start_(read(threads)) {}
+
+AllocationStats AllocationScope::stats() const {
+    const AllocationStats now = read(threads_);
+    AllocationStats diff;
+    diff.allocations = now.allocations - start_.allocations;
+    diff.deallocations = now.deallocations - start_.deallocations;
+    diff.bytes = now.bytes - start_.bytes;
+    return diff;
+}
+
+void AllocationScope::restart() {
+    start_ = read(threads_);
+}
+
+void record_allocations(const std::string& name, const AllocationStats& stats) {
+    Report& r = report();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    ReportEntry& entry = r.entries[name];
+    ++entry.calls;
+    entry.total += stats;
+}
+
+void* CountingResource::do_allocate(size_t bytes, size_t alignment) {
+    void* p = upstream_->allocate(bytes, alignment);
+    ++stats_.allocations;
+    stats_.bytes += bytes;
+    outstanding_ += bytes;
+    return p;
+}
+
+void CountingResource::do_deallocate(void* p, size_t bytes, size_t alignment) {
+    upstream_->deallocate(p, bytes, alignment);
+    ++stats_.deallocations;
+    outstanding_ -= bytes;
+}
+
+} // namespace vss::types::test
+
+// ============================================================================
+// Global operator new/delete
+// ============================================================================
+
+namespace {
+
+using vss::types::test::global_allocations;
+using vss::types::test::global_bytes;
+using vss::types::test::global_deallocations;
+using vss::types::test::local_counts;
+
+void count_allocation(std::size_t size) noexcept {
+    ++local_counts.allocations;
+    local_counts.bytes += size;
+    global_allocations.fetch_add(1, std::memory_order_relaxed);
+    global_bytes.fetch_add(size, std::memory_order_relaxed);
+}
+
+void count_deallocation(void* p) noexcept {
+    if (p) {
+        ++local_counts.deallocations;
+        global_deallocations.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void* allocate(std::size_t size) noexcept {
+    count_allocation(size);
+    return std::malloc(size ? size : 1);
+}
+
+void* allocate_aligned(std::size_t size, std::align_val_t alignment) noexcept {
+    count_allocation(size);
+    const std::size_t align = std::max(static_cast<std::size_t>(alignment), sizeof(void*));
+#if defined(_WIN32)
+    return _aligned_malloc(size ? size : 1, align);
+#else
+    void* p = nullptr;
+    return posix_memalign(&p, align, size ? size : 1) == 0 ? p : nullptr;
+#endif
+}
+
+void release(void* p) noexcept {
+    count_deallocation(p);
+    std::free(p);
+}
+
+void release_aligned(void* p) noexcept {
+    count_deallocation(p);
+#if defined(_WIN32)
+    _aligned_free(p);
+#else
+    std::free(p);
+#endif
+}
+
+void* allocate_or_throw(std::size_t size) {
+    void* p = allocate(size);
+    if (!p) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void* allocate_aligned_or_throw(std::size_t size, std::align_val_t alignment) {
+    void* p = allocate_aligned(size, alignment);
+    if (!p) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+} // namespace
+
+void* operator new(std::size_t size) { return allocate_or_throw(size); }
+void* operator new[](std::size_t size) { return allocate_or_throw(size); }
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept { return allocate(size); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return allocate(size); }
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    return allocate_aligned_or_throw(size, alignment);
+}
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+    return allocate_aligned_or_throw(size, alignment);
+}
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return allocate_aligned(size, alignment);
+}
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return allocate_aligned(size, alignment);
+}
+
+void operator delete(void* p) noexcept { release(p); }
+void operator delete[](void* p) noexcept { release(p); }
+void operator delete(void* p, std::size_t) noexcept { release(p); }
+void operator delete[](void* p, std::size_t) noexcept { release(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { release(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { release(p); }
+
+void operator delete(void* p, std::align_val_t) noexcept { release_aligned(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { release_aligned(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { release_aligned(p); }
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept { release_aligned(p); }
+void operator delete(void* p, std::align_val_t, const std::nothrow_t&) noexcept { release_aligned(p); }
+void operator delete[](void* p, std::align_val_t, const std::nothrow_t&) noexcept { release_aligned(p); }
@@ -0,0 +1,175 @@
+/**
+ * @file alloc_tracker.hpp
+ * @brief Allocation counting for tests and benchmarks
+ *
+ * alloc_tracker.cpp replaces the global operator new/delete of the binary
+ * it is linked into (every test target, and the benchmark) with versions
+ * that count calls and bytes, per thread and process-wide. An
+ * AllocationScope reads the counters at construction and reports the
+ * difference, so a test can check what one library call allocates:
+ *
+ * @code
+ * EXPECT_NO_ALLOCATIONS(checker.apply(slots.data(), slots.size()));
+ *
+ * // Run once to size buffers, then require the second run to be allocation-free
+ * EXPECT_STEADY_STATE_NO_ALLOCATIONS(decoder.decode(frame, slots));
+ *
+ * auto stats = track_allocations("validate_struct", [&] { validate_struct(value, registry); });
+ * EXPECT_LE(stats.allocations, 2u);
+ * @endcode
+ *
+ * Calls made through track_allocations() are also summed per name and
+ * printed as a table when the program exits.
+ *
+ * CountingResource does the same for std::pmr containers.
+ *
+ * Test-only code; the library itself does not depend on it.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <string>
+#include <utility>
+
+namespace vss::types::test {
+
+/**
+ * @brief Allocation counts over a scope
+ */
+struct AllocationStats {
+    uint64_t allocations = 0;     ///< operator new calls (all forms)
+    uint64_t deallocations = 0;   ///< operator delete calls with a non-null pointer
+    uint64_t bytes = 0;           ///< Bytes requested by the allocations
+
+    AllocationStats& operator+=(const AllocationStats& other) noexcept {
+        allocations += other.allocations;
+        deallocations += other.deallocations;
+        bytes += other.bytes;
+        return *this;
+    }
+};
+
+/**
+ * @brief Counts allocations from construction until stats() is called
+ *
+ * By default only allocations made by the constructing thread are
+ * counted, which keeps test framework threads out of the numbers. Use
+ * ALL_THREADS for code that allocates on worker threads.
+ */
+class AllocationScope {
+public:
+    enum Threads {
+        THIS_THREAD,
+        ALL_THREADS
+    };
+
+    explicit AllocationScope(Threads threads = THIS_THREAD);
+
+    /**
+     * @brief Allocations since construction (or the last restart())
+     */
+    AllocationStats stats() const;
+
+    /**
+     * @brief Start counting from now
+     */
+    void restart();
+
+private:
+    Threads threads_;
+    AllocationStats start_;
+};
+
+/**
+ * @brief Run f and count its allocations on this thread
+ */
+template<typename F>
+AllocationStats count_allocations(F&& f) {
+    AllocationScope scope;
+    std::forward<F>(f)();
+    return scope.stats();
+}
+
+/**
+ * @brief Add a measurement to the per-name report printed at exit
+ */
+void record_allocations(const std::string& name, const AllocationStats& stats);
+
+/**
+ * @brief Run f, count its allocations and record them under name
+ */
+template<typename F>
+AllocationStats track_allocations(const std::string& name, F&& f) {
+    AllocationStats stats = count_allocations(std::forward<F>(f));
+    record_allocations(name, stats);
+    return stats;
+}
+
+/**
+ * @brief std::pmr resource counting what passes through it
+ *
+ * Forwards to an upstream resource; allocations made by the upstream
+ * through operator new are also seen by AllocationScope.
+ */
+class CountingResource : public std::pmr::memory_resource {
+public:
+    explicit CountingResource(std::pmr::memory_resource* upstream = std::pmr::new_delete_resource())
+        : upstream_(upstream) {}
+
+    const AllocationStats& stats() const noexcept { return stats_; }
+    void reset() noexcept { stats_ = {}; }
+
+    /**
+     * @brief Bytes currently allocated and not yet returned
+     */
+    uint64_t outstanding_bytes() const noexcept { return outstanding_; }
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+    std::pmr::memory_resource* upstream_;
+    AllocationStats stats_;
+    uint64_t outstanding_ = 0;
+};
+
+} // namespace vss::types::test
+
+/**
+ * @brief GTest check that a statement performs no allocation on this thread
+ */
+#define EXPECT_NO_ALLOCATIONS(statement)                                                      \
+    do {                                                                                      \
+        const auto vss_alloc_stats_ = ::vss::types::test::count_allocations([&] { statement; }); \
+        EXPECT_EQ(vss_alloc_stats_.allocations, 0u)                                           \
+            << #statement << " made " << vss_alloc_stats_.allocations << " allocation(s), "   \
+            << vss_alloc_stats_.bytes << " bytes";                                            \
+    } while (0)
+
+/**
+ * @brief Like EXPECT_NO_ALLOCATIONS, but runs the statement once untracked first
+ *
+ * For calls that size their buffers on first use.
+ */
+#define EXPECT_STEADY_STATE_NO_ALLOCATIONS(statement) \
+    do {                                              \
+        statement;                                    \
+        EXPECT_NO_ALLOCATIONS(statement);             \
+    } while (0)
+
+/**
+ * @brief GTest check that a statement makes at most `limit` allocations on this thread
+ */
+#define EXPECT_ALLOCATIONS_LE(statement, limit)                                               \
+    do {                                                                                      \
+        const auto vss_alloc_stats_ = ::vss::types::test::count_allocations([&] { statement; }); \
+        EXPECT_LE(vss_alloc_stats_.allocations, static_cast<uint64_t>(limit))                 \
+            << #statement << " made " << vss_alloc_stats_.allocations << " allocation(s), "   \
+            << vss_alloc_stats_.bytes << " bytes";                                            \
+    } while (0)
@@ -0,0 +1,118 @@
+/**
+ * @file test_alloc_tracker.cpp
+ * @brief Tests for the allocation-tracking harness
+ */
+
+#include "alloc_tracker.hpp"
+#include <vss/types/value.hpp>
+#include <gtest/gtest.h>
+#include <gtest/gtest-spi.h>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace vss::types;
+using namespace vss::types::test;
+
+namespace {
+
+struct alignas(64) Aligned {
+    char data[64];
+};
+
+} // namespace
+
+TEST(AllocTrackerTest, CountsNewAndDelete) {
+    AllocationScope scope;
+    auto p = std::make_unique<int64_t>(1);
+    auto v = std::make_unique<std::vector<int>>(100);
+    auto a = std::make_unique<Aligned>();
+    auto stats = scope.stats();
+    EXPECT_EQ(stats.allocations, 4u);       // int64, vector object, its buffer, aligned
+    EXPECT_EQ(stats.bytes, sizeof(int64_t) + sizeof(std::vector<int>) + 100 * sizeof(int) + sizeof(Aligned));
+    EXPECT_EQ(stats.deallocations, 0u);
+
+    p.reset();
+    v.reset();
+    a.reset();
+    const auto released = scope.stats();
+    EXPECT_EQ(released.deallocations, 4u);
+
+    // Called directly: a new-expression whose result is unused may be elided
+    scope.restart();
+    const auto before = scope.stats();
+    ::operator delete[](::operator new[](16));
+    const auto after = scope.stats();
+    EXPECT_EQ(before.allocations, 0u);
+    EXPECT_EQ(after.allocations, 1u);
+    EXPECT_EQ(after.bytes, 16u);
+}
+
+TEST(AllocTrackerTest, ThreadScopes) {
+    AllocationScope mine;
+    AllocationScope all(AllocationScope::ALL_THREADS);
+    std::thread worker([] {
+        std::vector<double> buffer(1000);
+        buffer[0] = 1.0;
+    });
+    worker.join();
+
+    EXPECT_GE(all.stats().allocations, 1u);
+    EXPECT_GE(all.stats().bytes, 1000 * sizeof(double));
+    EXPECT_LT(mine.stats().bytes, 1000 * sizeof(double));   // std::thread state only
+}
+
+TEST(AllocTrackerTest, Macros) {
+    float x = 1.5f;
+    EXPECT_NO_ALLOCATIONS(x *= 2.0f);
+    EXPECT_ALLOCATIONS_LE(std::string s(100, 'x'), 1);
+
+    std::vector<int> buffer;
+    EXPECT_STEADY_STATE_NO_ALLOCATIONS(buffer.assign(64, 7));
+
+    // Failures report the statement and the counts
+    EXPECT_NONFATAL_FAILURE(EXPECT_NO_ALLOCATIONS(std::vector<int>(8)), "1 allocation(s)");
+}
+
+TEST(AllocTrackerTest, TrackedCallsAreRecorded) {
+    const Value value{std::vector<int32_t>(256, 1)};
+    // Warm-up: with instrumentation on, the first conversion on a thread
+    // registers its counters
+    Value warm_up = convert_value_type(value, ValueType::INT64_ARRAY);
+    auto stats = track_allocations("convert_value_type INT32_ARRAY->INT64_ARRAY", [&] {
+        Value converted = convert_value_type(value, ValueType::INT64_ARRAY);
+    });
+    EXPECT_EQ(stats.allocations, 1u);
+    EXPECT_GE(stats.bytes, 256 * sizeof(int64_t));
+}
+
+TEST(AllocTrackerTest, CountingResource) {
+    CountingResource resource;
+    {
+        std::pmr::vector<int> v(&resource);
+        v.reserve(100);
+        EXPECT_EQ(resource.stats().allocations, 1u);
+        EXPECT_EQ(resource.stats().bytes, 100 * sizeof(int));
+        EXPECT_EQ(resource.outstanding_bytes(), 100 * sizeof(int));
+
+        std::pmr::string s(200, 'x', &resource);
+        EXPECT_EQ(resource.stats().allocations, 2u);
+    }
+    EXPECT_EQ(resource.stats().deallocations, 2u);
+    EXPECT_EQ(resource.outstanding_bytes(), 0u);
+
+    // Buffer resource upstream of a pool: only the upstream refills are counted
+    CountingResource upstream;
+    std::pmr::monotonic_buffer_resource arena(1024, &upstream);
+    CountingResource front(&arena);
+    std::pmr::vector<int> small(&front);
+    for (int i = 0; i < 16; ++i) {
+        small.push_back(i);
+    }
+    EXPECT_GT(front.stats().allocations, 1u);
+    EXPECT_EQ(upstream.stats().allocations, 1u);
+    resource.reset();
+    EXPECT_EQ(resource.stats().allocations, 0u);
+}
@@ -0,0 +1,176 @@
+/**
+ * @file test_catalog.cpp
+ * @brief Tests for the VSS signal path catalog
+ */
+
+#include <vss/types/catalog.hpp>
+#include "alloc_tracker.hpp"
+#include <gtest/gtest.h>
+
+using namespace vss::types;
+
+TEST(CatalogTest, NodeTypeToString) {
+    EXPECT_STREQ(node_type_to_string(NodeType::BRANCH), "BRANCH");
+    EXPECT_STREQ(node_type_to_string(NodeType::SENSOR), "SENSOR");
+    EXPECT_STREQ(node_type_to_string(NodeType::ACTUATOR), "ACTUATOR");
+    EXPECT_STREQ(node_type_to_string(NodeType::ATTRIBUTE), "ATTRIBUTE");
+}
+
+TEST(CatalogTest, NodeTypeFromString) {
+    EXPECT_EQ(node_type_from_string("sensor"), NodeType::SENSOR);
+    EXPECT_EQ(node_type_from_string("Actuator"), NodeType::ACTUATOR);
+    EXPECT_EQ(node_type_from_string("BRANCH"), NodeType::BRANCH);
+    EXPECT_FALSE(node_type_from_string("struct").has_value());
+}
+
+TEST(CatalogTest, AddSignalCreatesBranches) {
+    SignalCatalog catalog;
+    auto id = catalog.add_signal("Vehicle.Test.FloatSensor", NodeType::SENSOR, ValueType::FLOAT);
+    ASSERT_TRUE(id.has_value());
+
+    // Vehicle, Vehicle.Test, Vehicle.Test.FloatSensor
+    EXPECT_EQ(catalog.size(), 3u);
+    EXPECT_EQ(*id, 2u);
+
+    auto vehicle = catalog.find("Vehicle");
+    auto test = catalog.find("Vehicle.Test");
+    ASSERT_TRUE(vehicle.has_value());
+    ASSERT_TRUE(test.has_value());
+
+    EXPECT_TRUE(catalog.get(*vehicle)->is_branch());
+    EXPECT_TRUE(catalog.get(*test)->is_branch());
+    EXPECT_EQ(catalog.roots(), std::vector<SignalId>{*vehicle});
+
+    const auto* node = catalog.get(*id);
+    ASSERT_NE(node, nullptr);
+    EXPECT_EQ(node->node_type, NodeType::SENSOR);
+    EXPECT_EQ(node->type, ValueType::FLOAT);
+    EXPECT_EQ(node->parent, *test);
+    EXPECT_EQ(node->name(), "FloatSensor");
+}
+
+TEST(CatalogTest, FindAndReverseLookup) {
+    SignalCatalog catalog;
+    auto speed = catalog.add_signal("Vehicle.Speed", NodeType::SENSOR, ValueType::FLOAT);
+    auto vin = catalog.add_signal("Vehicle.VehicleIdentification.VIN", NodeType::ATTRIBUTE, ValueType::STRING);
+    ASSERT_TRUE(speed.has_value());
+    ASSERT_TRUE(vin.has_value());
+
+    std::string_view query = "Vehicle.Speed.extra";
+    EXPECT_EQ(catalog.find(query.substr(0, 13)), speed);
+    EXPECT_EQ(catalog.find("Vehicle.VehicleIdentification.VIN"), vin);
+    EXPECT_FALSE(catalog.find("Vehicle.Unknown").has_value());
+    EXPECT_FALSE(catalog.find("Vehicle.Spe").has_value());
+
+    EXPECT_EQ(catalog.path(*speed), "Vehicle.Speed");
+    EXPECT_EQ(catalog.path(*vin), "Vehicle.VehicleIdentification.VIN");
+    EXPECT_TRUE(catalog.path(1000).empty());
+    EXPECT_EQ(catalog.get(1000), nullptr);
+}
+
+TEST(CatalogTest, ParentChildRelationships) {
+    SignalCatalog catalog;
+    auto left = catalog.add_signal("Vehicle.Cabin.Door.Row1.Left.IsOpen", NodeType::ACTUATOR, ValueType::BOOL);
+    auto right = catalog.add_signal("Vehicle.Cabin.Door.Row1.Right.IsOpen", NodeType::ACTUATOR, ValueType::BOOL);
+    ASSERT_TRUE(left.has_value());
+    ASSERT_TRUE(right.has_value());
+
+    auto row1 = catalog.find("Vehicle.Cabin.Door.Row1");
+    ASSERT_TRUE(row1.has_value());
+
+    const auto& children = catalog.get(*row1)->children;
+    ASSERT_EQ(children.size(), 2u);
+    EXPECT_EQ(catalog.get(children[0])->name(), "Left");
+    EXPECT_EQ(catalog.get(children[1])->name(), "Right");
+
+    // Walk up from a leaf to the root
+    std::vector<std::string_view> names;
+    for (SignalId id = *right; id != INVALID_SIGNAL_ID; id = catalog.get(id)->parent) {
+        names.push_back(catalog.get(id)->name());
+    }
+    std::vector<std::string_view> expected{"IsOpen", "Right", "Row1", "Door", "Cabin", "Vehicle"};
+    EXPECT_EQ(names, expected);
+}
+
+TEST(CatalogTest, StructSignal) {
+    SignalCatalog catalog;
+    auto id = catalog.add_signal("Vehicle.Test.Delivery", NodeType::SENSOR, ValueType::STRUCT,
+                                 "Vehicle.Test.DeliveryInfo", "Current delivery");
+    ASSERT_TRUE(id.has_value());
+
+    const auto* node = catalog.get(*id);
+    EXPECT_EQ(node->type, ValueType::STRUCT);
+    EXPECT_EQ(node->struct_type_name, "Vehicle.Test.DeliveryInfo");
+    EXPECT_EQ(node->description, "Current delivery");
+}
+
+TEST(CatalogTest, Conflicts) {
+    SignalCatalog catalog;
+    ASSERT_TRUE(catalog.add_signal("Vehicle.Speed", NodeType::SENSOR, ValueType::FLOAT).has_value());
+
+    // Duplicate signal
+    EXPECT_FALSE(catalog.add_signal("Vehicle.Speed", NodeType::SENSOR, ValueType::FLOAT).has_value());
+
+    // Signal used as branch
+    size_t before = catalog.size();
+    EXPECT_FALSE(catalog.add_signal("Vehicle.Speed.Unit", NodeType::SENSOR, ValueType::STRING).has_value());
+    EXPECT_FALSE(catalog.add_branch("Vehicle.Speed").has_value());
+    EXPECT_EQ(catalog.size(), before);
+
+    // Branch cannot become a signal, but re-adding a branch is fine
+    EXPECT_FALSE(catalog.add_signal("Vehicle", NodeType::SENSOR, ValueType::FLOAT).has_value());
+    EXPECT_EQ(catalog.add_branch("Vehicle"), catalog.find("Vehicle"));
+
+    // Signals cannot be declared as BRANCH
+    EXPECT_FALSE(catalog.add_signal("Vehicle.Other", NodeType::BRANCH, ValueType::FLOAT).has_value());
+}
+
+TEST(CatalogTest, MalformedPaths) {
+    SignalCatalog catalog;
+    EXPECT_FALSE(catalog.add_signal("", NodeType::SENSOR, ValueType::FLOAT).has_value());
+    EXPECT_FALSE(catalog.add_signal(".Vehicle", NodeType::SENSOR, ValueType::FLOAT).has_value());
+    EXPECT_FALSE(catalog.add_signal("Vehicle.", NodeType::SENSOR, ValueType::FLOAT).has_value());
+    EXPECT_FALSE(catalog.add_signal("Vehicle..Speed", NodeType::SENSOR, ValueType::FLOAT).has_value());
+    EXPECT_FALSE(catalog.add_signal("Vehicle.*", NodeType::SENSOR, ValueType::FLOAT).has_value());
+    EXPECT_EQ(catalog.size(), 0u);
+}
+
+TEST(CatalogTest, CopyKeepsLookupsValid) {
+    SignalCatalog original;
+    original.add_signal("Vehicle.Speed", NodeType::SENSOR, ValueType::FLOAT);
+
+    SignalCatalog copy = original;
+    original.clear();
+
+    EXPECT_EQ(original.size(), 0u);
+    ASSERT_TRUE(copy.find("Vehicle.Speed").has_value());
+    EXPECT_EQ(copy.path(*copy.find("Vehicle.Speed")), "Vehicle.Speed");
+
+    SignalCatalog moved = std::move(copy);
+    EXPECT_TRUE(moved.find("Vehicle.Speed").has_value());
+}
+
+TEST(CatalogTest, DenseIdsForManySignals) {
+    SignalCatalog catalog;
+    for (int i = 0; i < 1000; ++i) {
+        auto id = catalog.add_signal("Vehicle.Test.Signal" + std::to_string(i),
+                                     NodeType::SENSOR, ValueType::INT32);
+        ASSERT_TRUE(id.has_value());
+        EXPECT_EQ(*id, static_cast<SignalId>(i + 2));
+    }
+    for (int i = 0; i < 1000; ++i) {
+        std::string path = "Vehicle.Test.Signal" + std::to_string(i);
+        auto id = catalog.find(path);
+        ASSERT_TRUE(id.has_value());
+        EXPECT_EQ(catalog.path(*id), path);
+    }
+}
+
+TEST(CatalogTest, FindDoesNotAllocate) {
+    SignalCatalog catalog;
+    catalog.add_signal("Vehicle.Cabin.Door.Row1.DriverSide.IsOpen", NodeType::ACTUATOR, ValueType::BOOL);
+    std::string_view path = "Vehicle.Cabin.Door.Row1.DriverSide.IsOpen";
+    EXPECT_NO_ALLOCATIONS(catalog.find(path));
+    EXPECT_NO_ALLOCATIONS(catalog.find("Vehicle.Cabin.Door.Row2.DriverSide.IsOpen"));
+    EXPECT_NO_ALLOCATIONS(catalog.path(0));
+}
@@ -0,0 +1,239 @@
+/**
+ * @file test_constraints.cpp
+ * @brief Tests for min/max/allowed constraints
+ */
+
+#include <vss/types/constraints.hpp>
+#include <vss/types/catalog.hpp>
+#include <vss/types/struct.hpp>
+#include "alloc_tracker.hpp"
+#include <gtest/gtest.h>
+#include <cmath>
+#include <limits>
+
+using namespace vss::types;
+
+TEST(ConstraintsTest, EmptyConstraintsAcceptEverything) {
+    ValueConstraints constraints;
+    EXPECT_TRUE(constraints.empty());
+
+    ConstraintChecker checker{constraints};
+    EXPECT_TRUE(checker.empty());
+    EXPECT_TRUE(checker.satisfied(Value{int32_t(-5)}));
+    EXPECT_TRUE(checker.satisfied(Value{std::string("anything")}));
+    EXPECT_FALSE(check_constraints(Value{std::numeric_limits<double>::quiet_NaN()}, constraints).has_value());
+}
+
+TEST(ConstraintsTest, ScalarRange) {
+    ValueConstraints constraints;
+    constraints.min = 0.0;
+    constraints.max = 100.0;
+
+    EXPECT_FALSE(check_constraints(Value{uint8_t(100)}, constraints).has_value());
+    EXPECT_FALSE(check_constraints(Value{0.0f}, constraints).has_value());
+
+    auto error = check_constraints(Value{int32_t(150)}, constraints);
+    ASSERT_TRUE(error.has_value());
+    EXPECT_NE(error->find("150"), std::string::npos);
+    EXPECT_NE(error->find("max 100"), std::string::npos);
+
+    EXPECT_TRUE(check_constraints(Value{-0.5}, constraints).has_value());
+    EXPECT_TRUE(check_constraints(Value{std::nan("")}, constraints).has_value());
+
+    // Only one bound set
+    ValueConstraints lower;
+    lower.min = -40.0;
+    EXPECT_FALSE(check_constraints(Value{int64_t(1) << 60}, lower).has_value());
+    EXPECT_TRUE(check_constraints(Value{int8_t(-41)}, lower).has_value());
+}
+
+TEST(ConstraintsTest, FractionalAndOutOfTypeBounds) {
+    ValueConstraints constraints;
+    constraints.min = 0.5;
+    constraints.max = 10.5;
+    ConstraintChecker checker{constraints};
+
+    const int16_t ints[4] = {0, 1, 10, 11};
+    uint8_t valid[4];
+    EXPECT_EQ(checker.check_range(ints, 4, valid), 2u);
+    EXPECT_EQ(valid[0], 0);
+    EXPECT_EQ(valid[1], 1);
+    EXPECT_EQ(valid[2], 1);
+    EXPECT_EQ(valid[3], 0);
+
+    // Range entirely outside the element type
+    ValueConstraints negative;
+    negative.max = -1.0;
+    const uint32_t unsigned_values[2] = {0, 5};
+    EXPECT_EQ(ConstraintChecker{negative}.check_range(unsigned_values, 2, nullptr), 2u);
+
+    // Bounds inside the type's range that round out of it
+    ValueConstraints above;
+    above.min = 255.5;
+    const uint8_t bytes[2] = {0, 255};
+    EXPECT_EQ(ConstraintChecker{above}.check_range(bytes, 2, nullptr), 2u);
+    ValueConstraints below;
+    below.max = -128.5;
+    const int8_t signed_bytes[2] = {-128, 127};
+    EXPECT_EQ(ConstraintChecker{below}.check_range(signed_bytes, 2, nullptr), 2u);
+    ValueConstraints between;
+    between.min = 3.2;
+    between.max = 3.8;
+    EXPECT_EQ(ConstraintChecker{between}.check_range(ints, 4, nullptr), 4u);
+
+    // Range wider than the element type
+    ValueConstraints wide;
+    wide.min = -1e30;
+    wide.max = 1e30;
+    const uint64_t big[2] = {0, std::numeric_limits<uint64_t>::max()};
+    EXPECT_EQ(ConstraintChecker{wide}.check_range(big, 2, nullptr), 0u);
+}
+
+TEST(ConstraintsTest, ArraysCheckEveryElement) {
+    ValueConstraints constraints;
+    constraints.min = -1.0;
+    constraints.max = 1.0;
+    ConstraintChecker checker{constraints};
+
+    // Spans several internal blocks
+    std::vector<float> samples(1000, 0.5f);
+    samples[3] = 2.0f;
+    samples[700] = -1.5f;
+    samples[999] = std::nanf("");
+
+    std::vector<uint8_t> valid;
+    EXPECT_EQ(checker.check(Value{samples}, valid), 3u);
+    ASSERT_EQ(valid.size(), 1000u);
+    EXPECT_EQ(valid[3], 0);
+    EXPECT_EQ(valid[4], 1);
+    EXPECT_EQ(valid[700], 0);
+    EXPECT_EQ(checker.count_violations(Value{samples}), 3u);
+
+    auto error = check_constraints(Value{samples}, constraints);
+    ASSERT_TRUE(error.has_value());
+    EXPECT_EQ(error->rfind("Element 3 (2)", 0), 0u);
+}
+
+TEST(ConstraintsTest, AllowedValues) {
+    ValueConstraints modes;
+    modes.allowed = {std::string("NORMAL"), std::string("SPORT"), std::string("ECONOMY")};
+    ConstraintChecker checker{modes};
+
+    EXPECT_TRUE(checker.satisfied(Value{std::string("SPORT")}));
+    EXPECT_FALSE(checker.satisfied(Value{std::string("sport")}));
+    EXPECT_EQ(checker.count_violations(Value{std::vector<std::string>{"NORMAL", "RACE", "SNOW"}}), 2u);
+
+    // Numeric allowed values match across integer widths
+    ValueConstraints gears;
+    gears.allowed = {int32_t(-1), int32_t(0), int32_t(1), int32_t(2)};
+    ConstraintChecker gear_checker{gears};
+    EXPECT_TRUE(gear_checker.satisfied(Value{int8_t(-1)}));
+    EXPECT_TRUE(gear_checker.satisfied(Value{uint8_t(2)}));
+    EXPECT_FALSE(gear_checker.satisfied(Value{uint8_t(3)}));
+    EXPECT_FALSE(gear_checker.satisfied(Value{std::string("1")}));
+
+    // Allowed and range combined
+    gears.min = 0.0;
+    EXPECT_EQ(ConstraintChecker{gears}.count_violations(Value{std::vector<int16_t>{-1, 0, 2, 5}}), 2u);
+
+    ValueConstraints only_true;
+    only_true.allowed = {true};
+    EXPECT_EQ(ConstraintChecker{only_true}.count_violations(Value{std::vector<bool>{true, false, true}}), 1u);
+}
+
+TEST(ConstraintsTest, StructsAndEmptyValuesPass) {
+    ValueConstraints constraints;
+    constraints.max = 0.0;
+    ConstraintChecker checker{constraints};
+
+    std::vector<uint8_t> valid{1, 1};
+    EXPECT_EQ(checker.check(Value{std::monostate{}}, valid), 0u);
+    EXPECT_TRUE(valid.empty());
+    EXPECT_TRUE(checker.satisfied(Value{std::make_shared<StructValue>("Position")}));
+}
+
+TEST(ConstraintsTest, ApplyDowngradesSlots) {
+    ValueConstraints constraints;
+    constraints.min = 0.0;
+    constraints.max = 10.0;
+    ConstraintChecker checker{constraints};
+
+    std::vector<DynamicQualifiedValue> slots(3);
+    slots[0] = DynamicQualifiedValue{Value{5.0}, SignalQuality::VALID};
+    slots[1] = DynamicQualifiedValue{Value{50.0}, SignalQuality::VALID};
+    slots[2] = DynamicQualifiedValue{Value{50.0}, SignalQuality::NOT_AVAILABLE};
+
+    EXPECT_EQ(checker.apply(slots.data(), slots.size()), 1u);
+    EXPECT_EQ(slots[0].quality, SignalQuality::VALID);
+    EXPECT_EQ(slots[1].quality, SignalQuality::INVALID);
+    EXPECT_DOUBLE_EQ(std::get<double>(slots[1].value), 50.0);
+    EXPECT_EQ(slots[2].quality, SignalQuality::NOT_AVAILABLE);
+}
+
+TEST(ConstraintsTest, ValidateStructEnforcesFieldConstraints) {
+    StructRegistry registry;
+    StructDefinition position{"Position"};
+
+    FieldDefinition latitude{"Latitude", ValueType::DOUBLE};
+    latitude.constraints.min = -90.0;
+    latitude.constraints.max = 90.0;
+    position.add_field(latitude);
+
+    FieldDefinition source{"Source", ValueType::STRING};
+    source.constraints.allowed = {std::string("GPS"), std::string("GALILEO")};
+    position.add_field(source);
+    registry.register_struct(position);
+
+    StructValue value{"Position"};
+    value.set_field("Latitude", 48.1);
+    value.set_field("Source", std::string("GPS"));
+    EXPECT_FALSE(validate_struct(value, registry).has_value());
+
+    value.set_field("Latitude", 91.0);
+    auto error = validate_struct(value, registry);
+    ASSERT_TRUE(error.has_value());
+    EXPECT_NE(error->find("Latitude"), std::string::npos);
+
+    value.set_field("Latitude", 0.0);
+    value.set_field("Source", std::string("COMPASS"));
+    error = validate_struct(value, registry);
+    ASSERT_TRUE(error.has_value());
+    EXPECT_NE(error->find("'COMPASS'"), std::string::npos);
+}
+
+TEST(ConstraintsTest, CatalogSignalConstraints) {
+    SignalCatalog catalog;
+    auto speed = catalog.add_signal("Vehicle.Speed", NodeType::SENSOR, ValueType::FLOAT);
+    ASSERT_TRUE(speed.has_value());
+
+    ValueConstraints constraints;
+    constraints.min = -250.0;
+    constraints.max = 250.0;
+    EXPECT_TRUE(catalog.set_constraints(*speed, constraints));
+    EXPECT_FALSE(catalog.set_constraints(*catalog.find("Vehicle"), constraints));
+    EXPECT_FALSE(catalog.set_constraints(100, constraints));
+
+    const auto* node = catalog.get(*speed);
+    ASSERT_NE(node, nullptr);
+    EXPECT_EQ(node->constraints.max, 250.0);
+    EXPECT_FALSE(ConstraintChecker{node->constraints}.satisfied(Value{300.0f}));
+}
+
+TEST(ConstraintsTest, CheckerDoesNotAllocate) {
+    ValueConstraints constraints;
+    constraints.min = 0.0;
+    constraints.max = 10.0;
+    ConstraintChecker range{constraints};
+
+    ValueConstraints modes;
+    modes.allowed = {Value{std::string("ECO")}, Value{std::string("SPORT")}};
+    ConstraintChecker allowed{modes};
+
+    std::vector<DynamicQualifiedValue> slots(64, DynamicQualifiedValue{Value{50.0}, SignalQuality::VALID});
+    const Value samples{std::vector<float>(256, 5.0f)};
+    const Value mode{std::string("COMFORT")};
+
+    EXPECT_NO_ALLOCATIONS(range.apply(slots.data(), slots.size()));
+    EXPECT_NO_ALLOCATIONS(range.count_violations(samples));
+    EXPECT_NO_ALLOCATIONS(allowed.count_violations(mode));
+}
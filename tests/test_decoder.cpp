@@ -0,0 +1,232 @@
+/**
+ * @file test_decoder.cpp
+ * @brief Tests for table-driven frame decoding
+ */
+
+#include <vss/types/decoder.hpp>
+#include "alloc_tracker.hpp"
+#include <gtest/gtest.h>
+#include <chrono>
+
+using namespace vss::types;
+
+namespace {
+
+SignalDescriptor make_descriptor(uint16_t start_bit, uint8_t length, ByteOrder order,
+                                 ValueType target, size_t slot) {
+    SignalDescriptor d;
+    d.start_bit = start_bit;
+    d.length = length;
+    d.byte_order = order;
+    d.target_type = target;
+    d.slot = slot;
+    return d;
+}
+
+const auto TS = std::chrono::system_clock::time_point(std::chrono::seconds(1000));
+
+} // namespace
+
+TEST(ExtractBitsTest, IntelFields) {
+    const uint8_t frame[8] = {0x34, 0x12, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x80};
+
+    EXPECT_EQ(extract_bits(frame, 8, 0, 16, ByteOrder::INTEL), 0x1234u);
+    EXPECT_EQ(extract_bits(frame, 8, 4, 8, ByteOrder::INTEL), 0x23u);
+    EXPECT_EQ(extract_bits(frame, 8, 20, 4, ByteOrder::INTEL), 0xFu);
+    EXPECT_EQ(extract_bits(frame, 8, 63, 1, ByteOrder::INTEL), 1u);
+    EXPECT_EQ(extract_bits(frame, 8, 0, 64, ByteOrder::INTEL), 0x8000000000F01234ull);
+}
+
+TEST(ExtractBitsTest, MotorolaFields) {
+    const uint8_t frame[8] = {0x12, 0x34, 0x56, 0x78, 0x9A, 0xBC, 0xDE, 0xF0};
+
+    // MSB at bit 7 of byte 0, 16 bits → bytes 0..1 big-endian
+    EXPECT_EQ(extract_bits(frame, 8, 7, 16, ByteOrder::MOTOROLA), 0x1234u);
+    // MSB at bit 3 of byte 0, 8 bits → low nibble of byte 0, high nibble of byte 1
+    EXPECT_EQ(extract_bits(frame, 8, 3, 8, ByteOrder::MOTOROLA), 0x23u);
+    // Full 64-bit field
+    EXPECT_EQ(extract_bits(frame, 8, 7, 64, ByteOrder::MOTOROLA), 0x123456789ABCDEF0ull);
+    // Unaligned 64-bit field spanning 9 bytes
+    const uint8_t wide[9] = {0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF, 0x80};
+    EXPECT_EQ(extract_bits(wide, 9, 0, 64, ByteOrder::MOTOROLA), 0x91A2B3C4D5E6F7C0ull);
+}
+
+TEST(ExtractBitsTest, OutOfFrame) {
+    const uint8_t frame[2] = {0xFF, 0xFF};
+    EXPECT_FALSE(extract_bits(frame, 2, 8, 16, ByteOrder::INTEL).has_value());
+    EXPECT_FALSE(extract_bits(frame, 2, 0, 0, ByteOrder::INTEL).has_value());
+    EXPECT_FALSE(extract_bits(frame, 2, 0, 65, ByteOrder::INTEL).has_value());
+    EXPECT_EQ(extract_bits(frame, 2, 0, 16, ByteOrder::INTEL), 0xFFFFu);
+}
+
+TEST(FrameDecoderTest, ScaledSignals) {
+    FrameDecoder decoder;
+
+    auto speed = make_descriptor(0, 16, ByteOrder::INTEL, ValueType::FLOAT, 0);
+    speed.scale = 0.01;
+    ASSERT_TRUE(decoder.add_signal(speed));
+
+    auto temp = make_descriptor(16, 8, ByteOrder::INTEL, ValueType::DOUBLE, 1);
+    temp.is_signed = true;
+    temp.scale = 0.5;
+    temp.offset = 10.0;
+    ASSERT_TRUE(decoder.add_signal(temp));
+
+    auto flag = make_descriptor(24, 1, ByteOrder::INTEL, ValueType::BOOL, 2);
+    ASSERT_TRUE(decoder.add_signal(flag));
+
+    // speed raw 12050 → 120.5, temp raw -20 → 0.0, flag 1
+    const uint8_t frame[8] = {0x12, 0x2F, 0xEC, 0x01, 0, 0, 0, 0};
+    std::vector<DynamicQualifiedValue> slots;
+    EXPECT_EQ(decoder.decode(frame, 8, slots, TS), 3u);
+    ASSERT_EQ(slots.size(), 3u);
+
+    EXPECT_EQ(slots[0].quality, SignalQuality::VALID);
+    EXPECT_FLOAT_EQ(std::get<float>(slots[0].value), 120.5f);
+    EXPECT_EQ(slots[0].timestamp, TS);
+
+    EXPECT_DOUBLE_EQ(std::get<double>(slots[1].value), 0.0);
+    EXPECT_EQ(std::get<bool>(slots[2].value), true);
+}
+
+TEST(FrameDecoderTest, IntegerTargets) {
+    FrameDecoder decoder;
+    ASSERT_TRUE(decoder.add_signal(make_descriptor(0, 8, ByteOrder::INTEL, ValueType::UINT8, 0)));
+
+    auto signed_field = make_descriptor(8, 12, ByteOrder::INTEL, ValueType::INT16, 1);
+    signed_field.is_signed = true;
+    ASSERT_TRUE(decoder.add_signal(signed_field));
+
+    auto scaled = make_descriptor(24, 8, ByteOrder::INTEL, ValueType::UINT8, 2);
+    scaled.scale = 2.0;
+    ASSERT_TRUE(decoder.add_signal(scaled));
+
+    auto to_unsigned = make_descriptor(32, 8, ByteOrder::INTEL, ValueType::UINT32, 3);
+    to_unsigned.is_signed = true;
+    ASSERT_TRUE(decoder.add_signal(to_unsigned));
+
+    auto full = make_descriptor(0, 64, ByteOrder::INTEL, ValueType::UINT64, 4);
+    ASSERT_TRUE(decoder.add_signal(full));
+
+    // byte0 = 200, bits 8..19 = 0xFFF (-1), byte3 = 200 (*2 = 400 > UINT8), byte4 = -5
+    const uint8_t frame[8] = {200, 0xFF, 0x0F, 200, 0xFB, 0, 0, 0xFF};
+    std::vector<DynamicQualifiedValue> slots;
+    decoder.decode(frame, 8, slots, TS);
+
+    EXPECT_EQ(std::get<uint8_t>(slots[0].value), 200);
+    EXPECT_EQ(std::get<int16_t>(slots[1].value), -1);
+
+    EXPECT_EQ(slots[2].quality, SignalQuality::INVALID);
+    EXPECT_TRUE(is_empty(slots[2].value));
+
+    EXPECT_EQ(slots[3].quality, SignalQuality::INVALID);
+
+    // 64-bit raw values keep full precision with identity scaling
+    EXPECT_EQ(std::get<uint64_t>(slots[4].value), 0xFF0000FBC80FFFC8ull);
+}
+
+TEST(FrameDecoderTest, MotorolaSignal) {
+    FrameDecoder decoder;
+    auto rpm = make_descriptor(7, 16, ByteOrder::MOTOROLA, ValueType::DOUBLE, 0);
+    rpm.scale = 0.25;
+    ASSERT_TRUE(decoder.add_signal(rpm));
+
+    const uint8_t frame[2] = {0x1F, 0x40};  // 8000 * 0.25 = 2000
+    std::vector<DynamicQualifiedValue> slots;
+    decoder.decode(frame, 2, slots, TS);
+    EXPECT_DOUBLE_EQ(std::get<double>(slots[0].value), 2000.0);
+}
+
+TEST(FrameDecoderTest, ShortFrameIsNotAvailable) {
+    FrameDecoder decoder;
+    ASSERT_TRUE(decoder.add_signal(make_descriptor(0, 8, ByteOrder::INTEL, ValueType::UINT8, 0)));
+    ASSERT_TRUE(decoder.add_signal(make_descriptor(32, 8, ByteOrder::INTEL, ValueType::UINT8, 1)));
+
+    const uint8_t frame[2] = {7, 0};
+    std::vector<DynamicQualifiedValue> slots;
+    decoder.decode(frame, 2, slots, TS);
+
+    EXPECT_EQ(slots[0].quality, SignalQuality::VALID);
+    EXPECT_EQ(slots[1].quality, SignalQuality::NOT_AVAILABLE);
+    EXPECT_TRUE(is_empty(slots[1].value));
+}
+
+TEST(FrameDecoderTest, Multiplexing) {
+    FrameDecoder decoder;
+    ASSERT_TRUE(decoder.set_multiplexor(make_descriptor(0, 8, ByteOrder::INTEL, ValueType::UINT8, 0)));
+
+    // Always present
+    ASSERT_TRUE(decoder.add_signal(make_descriptor(8, 8, ByteOrder::INTEL, ValueType::UINT8, 0)));
+
+    // Page 1 and page 2 share the same bits
+    auto page1 = make_descriptor(16, 16, ByteOrder::INTEL, ValueType::UINT16, 1);
+    page1.multiplex_value = 1;
+    auto page2 = make_descriptor(16, 16, ByteOrder::INTEL, ValueType::INT16, 2);
+    page2.is_signed = true;
+    page2.multiplex_value = 2;
+    ASSERT_TRUE(decoder.add_signal(page2));
+    ASSERT_TRUE(decoder.add_signal(page1));
+    EXPECT_EQ(decoder.signal_count(), 3u);
+    EXPECT_EQ(decoder.slot_count(), 3u);
+
+    std::vector<DynamicQualifiedValue> slots;
+
+    const uint8_t frame1[4] = {1, 42, 0xFF, 0xFF};
+    EXPECT_EQ(decoder.decode(frame1, 4, slots, TS), 2u);
+    EXPECT_EQ(std::get<uint8_t>(slots[0].value), 42);
+    EXPECT_EQ(std::get<uint16_t>(slots[1].value), 0xFFFF);
+    EXPECT_TRUE(is_empty(slots[2].value));
+
+    const uint8_t frame2[4] = {2, 43, 0xFF, 0xFF};
+    EXPECT_EQ(decoder.decode(frame2, 4, slots, TS), 2u);
+    EXPECT_EQ(std::get<uint8_t>(slots[0].value), 43);
+    EXPECT_EQ(std::get<uint16_t>(slots[1].value), 0xFFFF);  // untouched
+    EXPECT_EQ(std::get<int16_t>(slots[2].value), -1);
+
+    const uint8_t frame3[4] = {3, 44, 0, 0};
+    EXPECT_EQ(decoder.decode(frame3, 4, slots, TS), 1u);
+}
+
+TEST(FrameDecoderTest, ManySignalsAcrossBlocks) {
+    // 64 bytes, one signal per 4 bits → 128 signals (more than one block)
+    FrameDecoder decoder;
+    for (uint16_t i = 0; i < 128; ++i) {
+        ASSERT_TRUE(decoder.add_signal(make_descriptor(i * 4, 4, ByteOrder::INTEL, ValueType::UINT8, i)));
+    }
+
+    uint8_t frame[64];
+    for (int i = 0; i < 64; ++i) {
+        frame[i] = static_cast<uint8_t>(((2 * i + 1) % 16) << 4 | ((2 * i) % 16));
+    }
+
+    std::vector<DynamicQualifiedValue> slots;
+    EXPECT_EQ(decoder.decode(frame, 64, slots, TS), 128u);
+    for (size_t i = 0; i < 128; ++i) {
+        EXPECT_EQ(std::get<uint8_t>(slots[i].value), i % 16) << "signal " << i;
+    }
+}
+
+TEST(FrameDecoderTest, RejectsInvalidDescriptors) {
+    FrameDecoder decoder;
+    EXPECT_FALSE(decoder.add_signal(make_descriptor(0, 0, ByteOrder::INTEL, ValueType::UINT8, 0)));
+    EXPECT_FALSE(decoder.add_signal(make_descriptor(0, 65, ByteOrder::INTEL, ValueType::UINT64, 0)));
+    EXPECT_FALSE(decoder.add_signal(make_descriptor(510, 8, ByteOrder::INTEL, ValueType::UINT8, 0)));
+    EXPECT_FALSE(decoder.add_signal(make_descriptor(0, 8, ByteOrder::INTEL, ValueType::STRING, 0)));
+    EXPECT_FALSE(decoder.add_signal(make_descriptor(0, 8, ByteOrder::INTEL, ValueType::FLOAT_ARRAY, 0)));
+    EXPECT_EQ(decoder.signal_count(), 0u);
+}
+
+TEST(FrameDecoderTest, SteadyStateDecodeDoesNotAllocate) {
+    FrameDecoder decoder;
+    auto speed = make_descriptor(0, 16, ByteOrder::INTEL, ValueType::FLOAT, 0);
+    speed.scale = 0.01;
+    ASSERT_TRUE(decoder.add_signal(speed));
+    ASSERT_TRUE(decoder.add_signal(make_descriptor(16, 8, ByteOrder::INTEL, ValueType::UINT8, 1)));
+    ASSERT_TRUE(decoder.add_signal(make_descriptor(24, 1, ByteOrder::INTEL, ValueType::BOOL, 2)));
+
+    const uint8_t frame[8] = {0x12, 0x2F, 0xEC, 0x01, 0, 0, 0, 0};
+    std::vector<DynamicQualifiedValue> slots;
+
+    // The first call sizes the slots; later frames are decoded in place
+    EXPECT_STEADY_STATE_NO_ALLOCATIONS(decoder.decode(frame, 8, slots, TS));
+}
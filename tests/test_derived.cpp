@@ -0,0 +1,214 @@
+/**
+ * @file test_derived.cpp
+ * @brief Tests for the derived-signal graph and the work-stealing pool
+ */
+
+#include <vss/types/derived.hpp>
+#include <gtest/gtest.h>
+#include <atomic>
+#include <stdexcept>
+
+using namespace vss::types;
+
+namespace {
+
+DynamicQualifiedValue sample(double v, int ms, SignalQuality q = SignalQuality::VALID) {
+    return DynamicQualifiedValue{Value{v}, q,
+                                 std::chrono::system_clock::time_point(std::chrono::milliseconds(ms))};
+}
+
+DerivedNode sum_node(SignalId output, std::vector<SignalId> inputs, std::atomic<int>* calls = nullptr) {
+    return DerivedNode{output, std::move(inputs), [calls](const DerivedInputs& in) {
+        if (calls) {
+            calls->fetch_add(1);
+        }
+        double sum = 0.0;
+        for (size_t i = 0; i < in.size(); ++i) {
+            sum += in.number(i);
+        }
+        return Value{sum};
+    }};
+}
+
+} // namespace
+
+TEST(WorkStealingPoolTest, RunsNestedTasks) {
+    for (size_t threads : {size_t(0), size_t(1), size_t(4)}) {
+        WorkStealingPool pool(threads);
+        std::atomic<int> count{0};
+        for (int i = 0; i < 100; ++i) {
+            pool.submit([&] {
+                count.fetch_add(1);
+                for (int j = 0; j < 10; ++j) {
+                    pool.submit([&] { count.fetch_add(1); });
+                }
+            });
+        }
+        pool.wait();
+        EXPECT_EQ(count.load(), 1100) << threads;
+    }
+}
+
+TEST(WorkStealingPoolTest, WaitRethrowsTaskException) {
+    for (size_t threads : {size_t(0), size_t(1), size_t(4)}) {
+        WorkStealingPool pool(threads);
+        std::atomic<int> count{0};
+        for (int i = 0; i < 100; ++i) {
+            pool.submit([&count, i] {
+                count.fetch_add(1);
+                if (i % 10 == 0) {
+                    throw std::runtime_error("task failed");
+                }
+            });
+        }
+        EXPECT_THROW(pool.wait(), std::runtime_error) << threads;
+        EXPECT_EQ(count.load(), 100) << threads;
+
+        // The pool stays usable and the error is reported once
+        pool.submit([&count] { count.fetch_add(1); });
+        pool.wait();
+        EXPECT_EQ(count.load(), 101) << threads;
+    }
+}
+
+TEST(DerivedGraphTest, RejectsInvalidNodesAndCycles) {
+    DerivedGraph graph;
+    EXPECT_FALSE(graph.add_node(sum_node(INVALID_SIGNAL_ID, {1})).has_value());
+    EXPECT_FALSE(graph.add_node(sum_node(2, {2})).has_value());
+    EXPECT_FALSE(graph.add_node(DerivedNode{2, {1}, nullptr}).has_value());
+    EXPECT_EQ(graph.add_node(sum_node(2, {1})), 0u);
+    EXPECT_FALSE(graph.add_node(sum_node(2, {0})).has_value());
+    EXPECT_TRUE(graph.build());
+
+    EXPECT_EQ(graph.add_node(sum_node(3, {2})), 1u);
+    EXPECT_EQ(graph.add_node(sum_node(1, {3})), 2u);
+    EXPECT_FALSE(graph.build());
+    EXPECT_EQ(graph.evaluate(), 0u);
+}
+
+TEST(DerivedGraphTest, PropagatesOnlyDownstream) {
+    // a, b -> ab ; c -> cc ; ab, cc -> total
+    const SignalId a = 0, b = 1, c = 2, ab = 10, cc = 11, total = 12;
+    std::atomic<int> ab_calls{0}, cc_calls{0}, total_calls{0};
+
+    DerivedGraph graph;
+    graph.add_node(sum_node(total, {ab, cc}, &total_calls));
+    graph.add_node(sum_node(ab, {a, b}, &ab_calls));
+    graph.add_node(sum_node(cc, {c}, &cc_calls));
+    ASSERT_TRUE(graph.build());
+
+    // Without inputs the nodes publish NOT_AVAILABLE once
+    std::vector<SignalUpdate> changed;
+    EXPECT_EQ(graph.evaluate(&changed), 3u);
+    EXPECT_EQ(ab_calls.load() + cc_calls.load() + total_calls.load(), 0);
+    ASSERT_EQ(changed.size(), 3u);
+    EXPECT_EQ(changed.back().id, total);
+    EXPECT_EQ(changed.back().value.quality, SignalQuality::NOT_AVAILABLE);
+
+    graph.update(a, sample(1.0, 10));
+    graph.update(b, sample(2.0, 20));
+    graph.update(c, sample(4.0, 5));
+    changed.clear();
+    EXPECT_EQ(graph.evaluate(&changed), 3u);
+    ASSERT_EQ(changed.size(), 3u);
+    EXPECT_EQ(changed.back().id, total);    // topological order
+    EXPECT_DOUBLE_EQ(std::get<double>(changed.back().value.value), 7.0);
+    EXPECT_EQ(changed.back().value.quality, SignalQuality::VALID);
+    EXPECT_EQ(changed.back().value.timestamp, sample(0, 20).timestamp);
+
+    // Only c changes: ab is not evaluated
+    ab_calls = cc_calls = total_calls = 0;
+    EXPECT_TRUE(graph.update(c, sample(5.0, 30)));
+    EXPECT_EQ(graph.dirty_count(), 1u);
+    EXPECT_EQ(graph.evaluate(), 2u);
+    EXPECT_EQ(ab_calls.load(), 0);
+    EXPECT_EQ(cc_calls.load(), 1);
+    EXPECT_EQ(total_calls.load(), 1);
+    EXPECT_DOUBLE_EQ(std::get<double>(graph.value(total)->value), 8.0);
+
+    // Same value again: nothing to do
+    EXPECT_FALSE(graph.update(c, sample(5.0, 40)));
+    EXPECT_EQ(graph.evaluate(), 0u);
+
+    // Inputs swap values: ab is evaluated but unchanged, so total is not
+    graph.update(a, sample(2.0, 50));
+    graph.update(b, sample(1.0, 50));
+    total_calls = 0;
+    changed.clear();
+    EXPECT_EQ(graph.evaluate(&changed), 1u);
+    EXPECT_TRUE(changed.empty());
+    EXPECT_EQ(total_calls.load(), 0);
+    EXPECT_EQ(graph.value(ab)->timestamp, sample(0, 50).timestamp);
+}
+
+TEST(DerivedGraphTest, ThresholdAndQuality) {
+    const SignalId in = 0, out = 1;
+    std::atomic<int> calls{0};
+    DerivedGraph graph;
+    graph.add_node(sum_node(out, {in}, &calls));
+    graph.set_threshold(in, 1.0);
+    graph.update(in, sample(10.0, 0));
+    graph.evaluate();
+    EXPECT_EQ(calls.load(), 1);
+
+    // Small steps are held back until they add up to the threshold
+    EXPECT_FALSE(graph.update(in, sample(10.5, 1)));
+    EXPECT_FALSE(graph.update(in, sample(10.9, 2)));
+    EXPECT_DOUBLE_EQ(std::get<double>(graph.value(in)->value), 10.0);
+    EXPECT_TRUE(graph.update(in, sample(11.0, 3)));
+    graph.evaluate();
+    EXPECT_EQ(calls.load(), 2);
+    EXPECT_DOUBLE_EQ(std::get<double>(graph.value(out)->value), 11.0);
+
+    // A quality change always propagates; compute() is skipped
+    EXPECT_TRUE(graph.update(in, sample(11.0, 4, SignalQuality::INVALID)));
+    graph.evaluate();
+    EXPECT_EQ(calls.load(), 2);
+    EXPECT_EQ(graph.value(out)->quality, SignalQuality::INVALID);
+    EXPECT_TRUE(is_empty(graph.value(out)->value));
+    EXPECT_EQ(graph.value(99), nullptr);
+}
+
+TEST(DerivedGraphTest, ParallelMatchesSerial) {
+    // 16 independent chains of depth 8 feeding one total
+    const SignalId chains = 16, depth = 8, total = 1000;
+    auto make = [&](DerivedGraph& graph) {
+        std::vector<SignalId> tails;
+        for (SignalId c = 0; c < chains; ++c) {
+            SignalId prev = c;
+            for (SignalId d = 0; d < depth; ++d) {
+                const SignalId id = 100 + c * depth + d;
+                graph.add_node(DerivedNode{id, {prev}, [](const DerivedInputs& in) {
+                    return Value{in.number(0) * 2.0 + 1.0};
+                }});
+                prev = id;
+            }
+            tails.push_back(prev);
+        }
+        graph.add_node(sum_node(total, tails));
+        return graph.build();
+    };
+
+    DerivedGraph serial;
+    DerivedGraph parallel(4);
+    ASSERT_TRUE(make(serial));
+    ASSERT_TRUE(make(parallel));
+    EXPECT_EQ(parallel.threads(), 4u);
+
+    for (int round = 0; round < 20; ++round) {
+        for (SignalId c = 0; c < chains; ++c) {
+            if ((c + round) % 3 == 0) {
+                serial.update(c, sample(c * round, round));
+                parallel.update(c, sample(c * round, round));
+            }
+        }
+        std::vector<SignalUpdate> a, b;
+        EXPECT_EQ(serial.evaluate(&a), parallel.evaluate(&b));
+        ASSERT_EQ(a.size(), b.size());
+        for (size_t i = 0; i < a.size(); ++i) {
+            EXPECT_EQ(a[i].id, b[i].id);
+            EXPECT_TRUE(values_equal(a[i].value.value, b[i].value.value));
+        }
+        EXPECT_TRUE(values_equal(serial.value(total)->value, parallel.value(total)->value));
+    }
+}
@@ -0,0 +1,161 @@
+/**
+ * @file test_downsample.cpp
+ * @brief Tests for signal history downsampling
+ */
+
+#include "vss_test_helpers.hpp"
+#include <vss/types/downsample.hpp>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+
+using namespace vss::types;
+using namespace vss::types::test;
+using namespace std::chrono_literals;
+
+namespace {
+
+SignalSeries sine(size_t count) {
+    SignalSeries series;
+    for (size_t i = 0; i < count; ++i) {
+        series.append(at(std::chrono::milliseconds(i * 10)), std::sin(static_cast<double>(i) * 0.01));
+    }
+    return series;
+}
+
+} // namespace
+
+TEST(DownsampleTest, MethodStrings) {
+    EXPECT_STREQ(downsample_method_to_string(DownsampleMethod::MIN_MAX), "MIN_MAX");
+    EXPECT_EQ(downsample_method_from_string("lttb"), DownsampleMethod::LTTB);
+    EXPECT_EQ(downsample_method_from_string("avg"), DownsampleMethod::AVERAGE);
+    EXPECT_FALSE(downsample_method_from_string("every_nth").has_value());
+}
+
+TEST(DownsampleTest, LttbKeepsEndpointsAndSpike) {
+    SignalSeries series = sine(1000);
+    SignalSeries with_spike;
+    for (size_t i = 0; i < series.size(); ++i) {
+        with_spike.append(series.timestamps()[i], i == 517 ? 50.0 : series.values()[i]);
+    }
+
+    SignalSeries out;
+    EXPECT_EQ(downsample_lttb(with_spike.view(), 50, out), 50u);
+    ASSERT_EQ(out.size(), 50u);
+    EXPECT_EQ(out.timestamps().front(), with_spike.timestamps().front());
+    EXPECT_EQ(out.timestamps().back(), with_spike.timestamps().back());
+    EXPECT_TRUE(std::is_sorted(out.timestamps().begin(), out.timestamps().end()));
+    EXPECT_DOUBLE_EQ(*std::max_element(out.values().begin(), out.values().end()), 50.0);
+
+    // Nothing to reduce: copied as is
+    SignalSeries small;
+    EXPECT_EQ(downsample_lttb(with_spike.view().subview(0, 10), 50, small), 10u);
+    EXPECT_EQ(small.values(), std::vector<double>(with_spike.values().begin(), with_spike.values().begin() + 10));
+}
+
+TEST(DownsampleTest, LttbSkipsInvalidSamples) {
+    SignalSeries series;
+    for (int i = 0; i < 100; ++i) {
+        // Huge outliers flagged INVALID must never be picked
+        bool bad = (i % 7) == 3;
+        series.append(at(std::chrono::milliseconds(i)), bad ? 1e9 : static_cast<double>(i % 10),
+                      bad ? SignalQuality::INVALID : SignalQuality::VALID);
+    }
+    // A stretch without any VALID samples
+    SignalSeries gapped;
+    for (int i = 0; i < 100; ++i) {
+        bool gap = i >= 40 && i < 60;
+        gapped.append(at(std::chrono::milliseconds(i)), gap ? 0.0 : 1.0,
+                      gap ? SignalQuality::NOT_AVAILABLE : SignalQuality::VALID);
+    }
+
+    SignalSeries out;
+    downsample_lttb(series.view(), 20, out);
+    for (size_t i = 0; i < out.size(); ++i) {
+        EXPECT_EQ(out.qualities()[i], SignalQuality::VALID);
+        EXPECT_LT(out.values()[i], 10.0);
+    }
+
+    SignalSeries gap_out;
+    downsample_lttb(gapped.view(), 12, gap_out);
+    EXPECT_NE(std::find(gap_out.qualities().begin(), gap_out.qualities().end(), SignalQuality::NOT_AVAILABLE),
+              gap_out.qualities().end());
+}
+
+TEST(DownsampleTest, MinMaxKeepsExtremesPerBucket) {
+    SignalSeries series;
+    const double data[] = {1, 5, 2, -3, 4, 4, 9, 0, 7, 1, 8, 2};
+    for (size_t i = 0; i < 12; ++i) {
+        series.append(at(std::chrono::milliseconds(i)), data[i],
+                      i == 6 ? SignalQuality::INVALID : SignalQuality::VALID);
+    }
+
+    SignalSeries out;
+    EXPECT_EQ(downsample_min_max(series.view(), 6, out), 6u);
+    // Buckets [0,4), [4,8), [8,12); index 6 (9) is INVALID
+    ASSERT_EQ(out.size(), 6u);
+    EXPECT_EQ(out.values(), (std::vector<double>{5, -3, 4, 0, 1, 8}));
+    EXPECT_TRUE(std::is_sorted(out.timestamps().begin(), out.timestamps().end()));
+
+    // Bucket without VALID samples keeps a marker
+    SignalSeries gapped;
+    for (int i = 0; i < 8; ++i) {
+        gapped.append(at(std::chrono::milliseconds(i)), i, i < 4 ? SignalQuality::INVALID : SignalQuality::VALID);
+    }
+    SignalSeries gap_out;
+    downsample_min_max(gapped.view(), 4, gap_out);
+    ASSERT_EQ(gap_out.size(), 3u);
+    EXPECT_EQ(gap_out.qualities()[0], SignalQuality::INVALID);
+    EXPECT_EQ(gap_out.values()[1], 4.0);
+    EXPECT_EQ(gap_out.values()[2], 7.0);
+}
+
+TEST(DownsampleTest, AverageTimeBuckets) {
+    SignalSeries series;
+    series.append(at(100ms), 1.0);
+    series.append(at(900ms), 3.0);
+    series.append(at(950ms), 100.0, SignalQuality::INVALID);
+    series.append(at(1500ms), std::nan(""), SignalQuality::VALID);
+    series.append(at(3200ms), 10.0);
+
+    SignalSeries out;
+    EXPECT_EQ(downsample_average(series.view(), 1s, out), 3u);
+    ASSERT_EQ(out.size(), 3u);
+    EXPECT_EQ(out.timestamps()[0], at(0ms));
+    EXPECT_DOUBLE_EQ(out.values()[0], 2.0);
+    EXPECT_EQ(out.timestamps()[1], at(1000ms));
+    EXPECT_TRUE(std::isnan(out.values()[1]));
+    EXPECT_EQ(out.qualities()[1], SignalQuality::NOT_AVAILABLE);
+    EXPECT_EQ(out.timestamps()[2], at(3000ms));
+    EXPECT_DOUBLE_EQ(out.values()[2], 10.0);
+    EXPECT_EQ(out.qualities()[2], SignalQuality::VALID);
+}
+
+TEST(DownsampleTest, ManyMatchesSequential) {
+    std::vector<SignalSeries> histories;
+    for (size_t s = 0; s < 9; ++s) {
+        histories.push_back(sine(500 + s * 300));
+    }
+    std::vector<SeriesView> views;
+    for (const auto& h : histories) {
+        views.push_back(h.view());
+    }
+
+    for (auto method : {DownsampleMethod::LTTB, DownsampleMethod::MIN_MAX, DownsampleMethod::AVERAGE}) {
+        DownsampleSpec spec;
+        spec.method = method;
+        spec.points = 64;
+        spec.bucket_width = 500ms;
+
+        auto results = downsample_many(views, spec, 4);
+        ASSERT_EQ(results.size(), views.size());
+        for (size_t s = 0; s < views.size(); ++s) {
+            SignalSeries expected;
+            downsample(views[s], spec, expected);
+            EXPECT_EQ(results[s].values(), expected.values()) << downsample_method_to_string(method);
+            EXPECT_EQ(results[s].timestamps(), expected.timestamps());
+        }
+    }
+
+    EXPECT_TRUE(downsample_many({}, DownsampleSpec{}).empty());
+}
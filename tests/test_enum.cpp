@@ -0,0 +1,158 @@
+/**
+ * @file test_enum.cpp
+ * @brief Tests for dictionary-encoded enum strings
+ */
+
+#include <vss/types/enum.hpp>
+#include <vss/types/catalog.hpp>
+#include <vss/types/decoder.hpp>
+#include <gtest/gtest.h>
+#include <chrono>
+
+using namespace vss::types;
+
+TEST(EnumTest, CreateDictionary) {
+    auto modes = EnumDictionary::create({"NORMAL", "SPORT", "ECONOMY"});
+    ASSERT_NE(modes, nullptr);
+    EXPECT_EQ(modes->size(), 3u);
+    EXPECT_EQ(modes->code("SPORT"), 1);
+    EXPECT_FALSE(modes->code("RACE").has_value());
+    EXPECT_EQ(modes->name(2), "ECONOMY");
+    EXPECT_EQ(modes->name(3), "");
+
+    EXPECT_EQ(EnumDictionary::create({}), nullptr);
+    EXPECT_EQ(EnumDictionary::create({"A", "B", "A"}), nullptr);
+}
+
+TEST(EnumTest, EncodeDecodeRoundTrip) {
+    auto modes = EnumDictionary::create({"NORMAL", "SPORT", "ECONOMY"});
+
+    Value sport = modes->encode("SPORT");
+    ASSERT_TRUE(std::holds_alternative<EnumValue>(sport));
+    EXPECT_EQ(std::get<EnumValue>(sport).code, 1);
+    EXPECT_EQ(std::get<EnumValue>(sport).str(), "SPORT");
+    EXPECT_EQ(get_value_type(sport), ValueType::STRING);
+
+    Value decoded = decode_enum(sport);
+    ASSERT_TRUE(std::holds_alternative<std::string>(decoded));
+    EXPECT_EQ(std::get<std::string>(decoded), "SPORT");
+
+    EXPECT_TRUE(is_empty(modes->encode("RACE")));
+
+    Value encoded = encode_enum(Value{std::string("ECONOMY")}, modes);
+    EXPECT_EQ(std::get<EnumValue>(encoded).code, 2);
+    EXPECT_TRUE(is_empty(encode_enum(Value{int32_t(1)}, modes)));
+
+    // Non-enum values pass through decode_enum unchanged
+    EXPECT_EQ(std::get<int32_t>(decode_enum(Value{int32_t(7)})), 7);
+
+    // Converting to STRING materializes the text
+    Value as_string = convert_value_type(sport, ValueType::STRING);
+    ASSERT_TRUE(std::holds_alternative<std::string>(as_string));
+    EXPECT_EQ(std::get<std::string>(as_string), "SPORT");
+}
+
+TEST(EnumTest, ReencodeIntoOtherDictionary) {
+    auto a = EnumDictionary::create({"OFF", "ON"});
+    auto b = EnumDictionary::create({"ON", "OFF", "BLINK"});
+
+    Value on = a->encode("ON");
+    Value moved = encode_enum(on, b);
+    EXPECT_EQ(std::get<EnumValue>(moved).code, 0);
+    EXPECT_EQ(std::get<EnumValue>(moved).dictionary, b);
+    EXPECT_TRUE(is_empty(encode_enum(b->encode("BLINK"), a)));
+}
+
+TEST(EnumTest, EqualityAndChangeDetection) {
+    auto a = EnumDictionary::create({"OFF", "ON"});
+    auto b = EnumDictionary::create({"ON", "OFF"});
+
+    EXPECT_TRUE(values_equal(a->encode("ON"), a->encode("ON")));
+    EXPECT_FALSE(values_equal(a->encode("ON"), a->encode("OFF")));
+
+    // Different dictionaries and plain strings compare by text
+    EXPECT_TRUE(values_equal(a->encode("ON"), b->encode("ON")));
+    EXPECT_TRUE(values_equal(a->encode("ON"), Value{std::string("ON")}));
+    EXPECT_TRUE(values_equal(Value{std::string("OFF")}, a->encode("OFF")));
+    EXPECT_FALSE(values_equal(a->encode("ON"), Value{std::string("OFF")}));
+    EXPECT_FALSE(values_equal(a->encode("ON"), Value{int32_t(1)}));
+
+    EXPECT_FALSE(value_changed_beyond_threshold(a->encode("ON"), Value{std::string("ON")}, 0.0));
+    EXPECT_TRUE(value_changed_beyond_threshold(a->encode("ON"), a->encode("OFF"), 0.0));
+    EXPECT_TRUE(value_changed_beyond_threshold(a->encode("ON"), Value{int32_t(1)}, 1.0));
+
+    DynamicQualifiedValue x{a->encode("ON"), SignalQuality::VALID};
+    DynamicQualifiedValue y{Value{std::string("ON")}, SignalQuality::VALID};
+    EXPECT_TRUE(dynamic_qualified_values_equal(x, y));
+}
+
+TEST(EnumTest, DictionaryOutlivesSource) {
+    Value v;
+    {
+        auto lamps = EnumDictionary::create({"OFF", "LOW", "HIGH"});
+        v = lamps->encode("HIGH");
+    }
+    EXPECT_EQ(std::get<EnumValue>(v).str(), "HIGH");
+
+    Value copy = v;
+    EXPECT_TRUE(values_equal(copy, v));
+}
+
+TEST(EnumTest, ConstraintsAndCatalog) {
+    ValueConstraints constraints;
+    constraints.allowed = {std::string("PARK"), std::string("DRIVE"), std::string("REVERSE")};
+
+    auto gears = EnumDictionary::from_constraints(constraints);
+    ASSERT_NE(gears, nullptr);
+    EXPECT_EQ(gears->values(), (std::vector<std::string>{"PARK", "DRIVE", "REVERSE"}));
+
+    ConstraintChecker checker{constraints};
+    EXPECT_TRUE(checker.satisfied(gears->encode("DRIVE")));
+
+    auto other = EnumDictionary::create({"DRIVE", "SPORT"});
+    EXPECT_FALSE(checker.satisfied(other->encode("SPORT")));
+
+    SignalCatalog catalog;
+    auto gear = catalog.add_signal("Vehicle.Powertrain.Transmission.Gear", NodeType::SENSOR, ValueType::STRING);
+    auto speed = catalog.add_signal("Vehicle.Speed", NodeType::SENSOR, ValueType::FLOAT);
+    ASSERT_TRUE(catalog.set_constraints(*gear, constraints));
+    ASSERT_TRUE(catalog.set_constraints(*speed, constraints));
+
+    const auto* node = catalog.get(*gear);
+    ASSERT_NE(node->enum_dictionary, nullptr);
+    EXPECT_EQ(node->enum_dictionary->code("REVERSE"), 2);
+    EXPECT_EQ(catalog.get(*speed)->enum_dictionary, nullptr);
+}
+
+TEST(EnumTest, DecoderValueTable) {
+    auto lamps = EnumDictionary::create({"OFF", "LOW", "HIGH"});
+
+    FrameDecoder decoder;
+    SignalDescriptor lamp;
+    lamp.start_bit = 0;
+    lamp.length = 2;
+    lamp.target_type = ValueType::STRING;
+    lamp.slot = 0;
+    EXPECT_FALSE(decoder.add_signal(lamp));  // STRING needs a value table
+
+    lamp.value_table = lamps;
+    ASSERT_TRUE(decoder.add_signal(lamp));
+
+    const auto ts = std::chrono::system_clock::time_point(std::chrono::seconds(1));
+    std::vector<DynamicQualifiedValue> slots;
+
+    const uint8_t high[1] = {0x02};
+    decoder.decode(high, 1, slots, ts);
+    EXPECT_EQ(slots[0].quality, SignalQuality::VALID);
+    EXPECT_EQ(std::get<EnumValue>(slots[0].value).str(), "HIGH");
+
+    const uint8_t low[1] = {0x01};
+    decoder.decode(low, 1, slots, ts);
+    EXPECT_EQ(std::get<EnumValue>(slots[0].value).str(), "LOW");
+
+    // Raw value 3 has no entry
+    const uint8_t unknown[1] = {0x03};
+    decoder.decode(unknown, 1, slots, ts);
+    EXPECT_EQ(slots[0].quality, SignalQuality::INVALID);
+    EXPECT_TRUE(is_empty(slots[0].value));
+}
@@ -0,0 +1,263 @@
+/**
+ * @file test_expression.cpp
+ * @brief Tests for compiled expressions
+ */
+
+#include <vss/types/expression.hpp>
+#include <vss/types/enum.hpp>
+#include <gtest/gtest.h>
+#include <clocale>
+#include <cmath>
+#include <map>
+#include <string>
+
+using namespace vss::types;
+
+namespace {
+
+class ExpressionTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        speed = *catalog.add_signal("Vehicle.Speed", NodeType::SENSOR, ValueType::FLOAT);
+        rpm = *catalog.add_signal("Vehicle.Powertrain.Rpm", NodeType::SENSOR, ValueType::UINT16);
+        door = *catalog.add_signal("Vehicle.Cabin.Door.Row1.Left.IsOpen", NodeType::SENSOR, ValueType::BOOL);
+        mode = *catalog.add_signal("Vehicle.Mode", NodeType::SENSOR, ValueType::STRING);
+        name = *catalog.add_signal("Vehicle.Name", NodeType::ATTRIBUTE, ValueType::STRING);
+        catalog.add_signal("Vehicle.Tires", NodeType::SENSOR, ValueType::FLOAT_ARRAY);
+
+        ValueConstraints allowed;
+        allowed.allowed = {Value{std::string("ECO")}, Value{std::string("NORMAL")}, Value{std::string("SPORT")}};
+        catalog.set_constraints(mode, allowed);
+    }
+
+    // Samples for the expression's input slots, by signal id
+    ExpressionResult run(const Expression& e, const std::map<SignalId, DynamicQualifiedValue>& samples) {
+        std::vector<const DynamicQualifiedValue*> inputs;
+        for (SignalId id : e.inputs()) {
+            auto it = samples.find(id);
+            inputs.push_back(it == samples.end() ? nullptr : &it->second);
+        }
+        return e.evaluate(inputs.data());
+    }
+
+    static DynamicQualifiedValue valid(Value v) {
+        return DynamicQualifiedValue{std::move(v), SignalQuality::VALID, std::chrono::system_clock::time_point{}};
+    }
+
+    SignalCatalog catalog;
+    SignalId speed = 0, rpm = 0, door = 0, mode = 0, name = 0;
+};
+
+} // namespace
+
+TEST_F(ExpressionTest, CompilesAndEvaluatesRule) {
+    auto rule = Expression::compile("Vehicle.Speed > 100 && Vehicle.Cabin.Door.Row1.Left.IsOpen", catalog);
+    ASSERT_TRUE(rule.has_value());
+    EXPECT_EQ(rule->type(), ExpressionType::BOOL);
+    ASSERT_EQ(rule->inputs().size(), 2u);
+    EXPECT_EQ(rule->inputs()[0], speed);
+    EXPECT_EQ(rule->inputs()[1], door);
+    EXPECT_EQ(rule->size(), 5u);    // LOAD, GT_CONST, AND_SKIP, LOAD, AND
+
+    EXPECT_TRUE(run(*rule, {{speed, valid(120.0f)}, {door, valid(true)}}).is_true());
+    EXPECT_FALSE(run(*rule, {{speed, valid(80.0f)}, {door, valid(true)}}).is_true());
+    EXPECT_FALSE(run(*rule, {{speed, valid(120.0f)}, {door, valid(false)}}).is_true());
+
+    auto result = run(*rule, {{speed, valid(80.0f)}, {door, valid(true)}});
+    EXPECT_EQ(result.quality, SignalQuality::VALID);
+    EXPECT_FALSE(std::get<bool>(result.value));
+}
+
+TEST_F(ExpressionTest, ArithmeticAndFunctions) {
+    auto e = Expression::compile("abs(-Vehicle.Speed) * 2 + min(Vehicle.Powertrain.Rpm / 10, 50) - max(1, 2)",
+                                 catalog);
+    ASSERT_TRUE(e.has_value());
+    EXPECT_EQ(e->type(), ExpressionType::NUMBER);
+    auto result = run(*e, {{speed, valid(10.0f)}, {rpm, valid(uint16_t(300))}});
+    EXPECT_DOUBLE_EQ(std::get<double>(result.value), 20.0 + 30.0 - 2.0);
+
+    // Precedence and literal on the left of a comparison
+    auto p = Expression::compile("1 + 2 * 3 == 7 && 50 < Vehicle.Speed", catalog);
+    ASSERT_TRUE(p.has_value());
+    EXPECT_TRUE(run(*p, {{speed, valid(60.0f)}}).is_true());
+    EXPECT_FALSE(run(*p, {{speed, valid(40.0f)}}).is_true());
+
+    // A value stored in another numeric type than the catalog's still loads
+    EXPECT_DOUBLE_EQ(std::get<double>(run(*e, {{speed, valid(10.0)}, {rpm, valid(int32_t(300))}}).value), 48.0);
+}
+
+TEST_F(ExpressionTest, StringComparisons) {
+    auto e = Expression::compile("Vehicle.Mode == \"SPORT\" || 'Test' == Vehicle.Name", catalog);
+    ASSERT_TRUE(e.has_value());
+
+    auto dictionary = catalog.get(mode)->enum_dictionary;
+    ASSERT_TRUE(dictionary);
+    EXPECT_TRUE(run(*e, {{mode, valid(dictionary->encode("SPORT"))}, {name, valid(std::string("x"))}}).is_true());
+    EXPECT_TRUE(run(*e, {{mode, valid(std::string("SPORT"))}, {name, valid(std::string("x"))}}).is_true());
+    EXPECT_FALSE(run(*e, {{mode, valid(dictionary->encode("ECO"))}, {name, valid(std::string("x"))}}).is_true());
+    EXPECT_TRUE(run(*e, {{mode, valid(dictionary->encode("ECO"))}, {name, valid(std::string("Test"))}}).is_true());
+
+    ExpressionError error;
+    EXPECT_FALSE(Expression::compile("Vehicle.Mode != \"TURBO\"", catalog, &error).has_value());
+    EXPECT_NE(error.message.find("allowed"), std::string::npos);
+}
+
+TEST_F(ExpressionTest, RejectsInvalidExpressions) {
+    const std::pair<const char*, size_t> cases[] = {
+        {"Vehicle.Speed >", 15},
+        {"Vehicle.Unknown > 1", 0},
+        {"Vehicle.Speed && true", 14},
+        {"Vehicle.Cabin > 1", 0},
+        {"Vehicle.Tires > 1", 0},
+        {"Vehicle.Mode < \"A\"", 13},
+        {"Vehicle.Name", 0},
+        {"!Vehicle.Speed", 0},
+        {"foo(1)", 0},
+        {"(1 + 2", 6},
+        {"1 = 2", 2},
+        {"1 2", 2},
+        {"Vehicle.Mode == Vehicle.Name", 13},
+        {"Vehicle.Speed > 0x10", 16},
+        {"Vehicle.Speed > 0x1p3", 16},
+        {"Vehicle.Speed > 1.2.3", 16},
+        {"Vehicle.Speed > 1e", 16},
+        {"Vehicle.Speed > 1e999", 16},
+    };
+    for (const auto& [source, position] : cases) {
+        ExpressionError error;
+        EXPECT_FALSE(Expression::compile(source, catalog, &error).has_value()) << source;
+        EXPECT_EQ(error.position, position) << source << ": " << error.message;
+        EXPECT_FALSE(error.message.empty()) << source;
+    }
+
+    // Arrays and structs can still be checked for presence
+    EXPECT_TRUE(Expression::compile("valid(Vehicle.Tires)", catalog).has_value());
+}
+
+TEST_F(ExpressionTest, NumberLiterals) {
+    const std::pair<const char*, double> cases[] = {
+        {"1.5", 1.5}, {".5", 0.5}, {"2.", 2.0}, {"2e3", 2000.0}, {"1E-2", 0.01}, {"1.5e+1", 15.0},
+    };
+    for (const auto& [literal, expected] : cases) {
+        auto e = Expression::compile(std::string(literal) + " * 1", catalog);
+        ASSERT_TRUE(e.has_value()) << literal;
+        EXPECT_DOUBLE_EQ(std::get<double>(run(*e, {}).value), expected) << literal;
+    }
+
+    // Literals do not follow the C locale's decimal separator
+    const std::string previous = std::setlocale(LC_NUMERIC, nullptr);
+    if (std::setlocale(LC_NUMERIC, "de_DE.UTF-8") || std::setlocale(LC_NUMERIC, "de_DE")) {
+        auto e = Expression::compile("1.5 * 2", catalog);
+        std::setlocale(LC_NUMERIC, previous.c_str());
+        ASSERT_TRUE(e.has_value());
+        EXPECT_DOUBLE_EQ(std::get<double>(run(*e, {}).value), 3.0);
+    }
+}
+
+TEST_F(ExpressionTest, RejectsDeepNestingWithoutRecursingFurther) {
+    auto e = Expression::compile(std::string(200, '(') + "2" + std::string(200, ')') + " * 1", catalog);
+    ASSERT_TRUE(e.has_value());
+    EXPECT_DOUBLE_EQ(std::get<double>(run(*e, {}).value), 2.0);
+    EXPECT_TRUE(Expression::compile(std::string(200, '!') + "true", catalog).has_value());
+
+    const std::string sources[] = {
+        std::string(20000, '(') + "1" + std::string(20000, ')'),
+        std::string(100000, '!') + "true",
+        std::string(100000, '-') + "1",
+    };
+    for (const auto& source : sources) {
+        ExpressionError error;
+        EXPECT_FALSE(Expression::compile(source, catalog, &error).has_value());
+        EXPECT_EQ(error.message, "expression is too deeply nested");
+        EXPECT_EQ(error.position, 256u);
+    }
+
+    // Long operator chains build a tall tree without nesting
+    std::string chain = "Vehicle.Speed";
+    for (int i = 0; i < 100000; ++i) {
+        chain += "+Vehicle.Speed";
+    }
+    ExpressionError error;
+    EXPECT_FALSE(Expression::compile(chain, catalog, &error).has_value());
+    EXPECT_EQ(error.message, "expression is too deeply nested");
+    EXPECT_TRUE(Expression::compile(chain.substr(0, 14 * 1000 - 1), catalog).has_value());
+}
+
+TEST_F(ExpressionTest, ThreeValuedLogic) {
+    auto e = Expression::compile("Vehicle.Speed > 100 || Vehicle.Cabin.Door.Row1.Left.IsOpen", catalog);
+    ASSERT_TRUE(e.has_value());
+    const auto invalid = DynamicQualifiedValue{Value{200.0f}, SignalQuality::INVALID,
+                                               std::chrono::system_clock::time_point{}};
+
+    // Unknown || true is true; unknown || false is unknown
+    EXPECT_TRUE(run(*e, {{speed, invalid}, {door, valid(true)}}).is_true());
+    auto unknown = run(*e, {{speed, invalid}, {door, valid(false)}});
+    EXPECT_FALSE(unknown.is_true());
+    EXPECT_TRUE(is_empty(unknown.value));
+    EXPECT_EQ(unknown.quality, SignalQuality::INVALID);
+
+    // Missing and NaN samples are NOT_AVAILABLE
+    auto missing = run(*e, {{door, valid(false)}});
+    EXPECT_EQ(missing.quality, SignalQuality::NOT_AVAILABLE);
+    EXPECT_EQ(run(*e, {{speed, valid(NAN)}, {door, valid(false)}}).quality, SignalQuality::NOT_AVAILABLE);
+
+    // valid() is always known
+    auto guard = Expression::compile("!valid(Vehicle.Speed) || Vehicle.Speed > 100", catalog);
+    ASSERT_TRUE(guard.has_value());
+    EXPECT_TRUE(run(*guard, {{speed, invalid}}).is_true());
+    EXPECT_FALSE(run(*guard, {{speed, valid(50.0f)}}).is_true());
+}
+
+TEST_F(ExpressionTest, BatchMatchesScalar) {
+    auto e = Expression::compile(
+        "(Vehicle.Speed * 3.6 >= 100 && !Vehicle.Cabin.Door.Row1.Left.IsOpen) || Vehicle.Powertrain.Rpm > 5000",
+        catalog);
+    ASSERT_TRUE(e.has_value());
+    ASSERT_EQ(e->inputs().size(), 3u);
+
+    // 1000 rows, so blocks and the SIMD tail are exercised
+    const size_t rows = 1000;
+    std::vector<SignalSeries> columns(3);
+    for (size_t r = 0; r < rows; ++r) {
+        const auto ts = std::chrono::system_clock::time_point(std::chrono::milliseconds(r));
+        const SignalQuality q = r % 7 == 0 ? SignalQuality::INVALID : SignalQuality::VALID;
+        columns[0].append(ts, static_cast<double>(r % 50), q);
+        columns[1].append(ts, r % 3 == 0 ? 1.0 : 0.0, r % 11 == 0 ? SignalQuality::NOT_AVAILABLE : SignalQuality::VALID);
+        columns[2].append(ts, static_cast<double>((r * 37) % 6000));
+    }
+    std::vector<SeriesView> views;
+    for (const auto& c : columns) {
+        views.push_back(c.view());
+    }
+
+    std::vector<uint8_t> hits;
+    auto count = e->evaluate_batch(views, hits);
+    ASSERT_TRUE(count.has_value());
+    ASSERT_EQ(hits.size(), rows);
+
+    size_t expected = 0;
+    for (size_t r = 0; r < rows; ++r) {
+        DynamicQualifiedValue s{Value{static_cast<float>(views[0].values[r])}, views[0].qualities[r], {}};
+        DynamicQualifiedValue d{Value{views[1].values[r] != 0.0}, views[1].qualities[r], {}};
+        DynamicQualifiedValue p{Value{static_cast<uint16_t>(views[2].values[r])}, views[2].qualities[r], {}};
+        const DynamicQualifiedValue* inputs[] = {&s, &d, &p};
+        const bool scalar = e->matches(inputs);
+        EXPECT_EQ(hits[r], scalar ? 1 : 0) << r;
+        expected += scalar;
+    }
+    EXPECT_EQ(*count, expected);
+    EXPECT_GT(expected, 0u);
+
+    // Numeric batch: unknown rows are NaN
+    auto speed_kmh = Expression::compile("Vehicle.Speed * 3.6", catalog);
+    std::vector<double> kmh;
+    ASSERT_EQ(speed_kmh->evaluate_batch({views[0]}, kmh), rows - (rows + 6) / 7);
+    EXPECT_TRUE(std::isnan(kmh[0]));
+    EXPECT_DOUBLE_EQ(kmh[1], 3.6);
+
+    // Mismatched columns and string comparisons are rejected
+    EXPECT_FALSE(e->evaluate_batch({views[0]}, hits).has_value());
+    EXPECT_FALSE(e->evaluate_batch({views[0], views[1], views[2].subview(0, 10)}, hits).has_value());
+    auto strings = Expression::compile("Vehicle.Mode == \"ECO\"", catalog);
+    EXPECT_FALSE(strings->evaluate_batch({views[0]}, hits).has_value());
+}
@@ -0,0 +1,150 @@
+/**
+ * @file test_footprint.cpp
+ * @brief Tests for memory-footprint accounting
+ */
+
+#include <vss/types/footprint.hpp>
+#include <gtest/gtest.h>
+
+using namespace vss::types;
+
+namespace {
+
+constexpr size_t FIELD_NODE_MIN = sizeof(std::pair<const std::string, Value>);
+
+std::shared_ptr<StructValue> position(double lat, double lon) {
+    auto p = std::make_shared<StructValue>("Position");
+    p->set_field("Latitude", lat);
+    p->set_field("Longitude", lon);
+    return p;
+}
+
+} // namespace
+
+TEST(FootprintTest, ScalarsAndStrings) {
+    auto scalar = memory_usage(Value{1.5f});
+    EXPECT_EQ(scalar.inline_bytes, sizeof(Value));
+    EXPECT_EQ(scalar.heap_bytes, 0u);
+    EXPECT_EQ(scalar.allocations, 0u);
+    EXPECT_EQ(scalar.total_bytes(), sizeof(Value));
+
+    auto small = memory_usage(Value{std::string("ECO")});
+    EXPECT_EQ(small.heap_bytes, 0u);
+    EXPECT_EQ(small.inline_strings, 1u);
+    EXPECT_EQ(small.heap_strings, 0u);
+
+    std::string text(100, 'x');
+    auto large = memory_usage(Value{text});
+    EXPECT_GE(large.heap_bytes, 101u);
+    EXPECT_EQ(large.allocations, 1u);
+    EXPECT_EQ(large.heap_strings, 1u);
+
+    EXPECT_EQ(memory_usage(Value{}).allocations, 0u);
+}
+
+TEST(FootprintTest, Arrays) {
+    std::vector<float> floats;
+    floats.reserve(64);
+    floats.resize(10);
+    const Value value{std::move(floats)};     // Moving keeps the spare capacity
+    auto usage = memory_usage(value);
+    EXPECT_EQ(usage.heap_bytes, 64 * sizeof(float));
+    EXPECT_EQ(usage.allocations, 1u);
+
+    EXPECT_EQ(memory_usage(Value{std::vector<double>()}).allocations, 0u);
+    EXPECT_GE(memory_usage(Value{std::vector<bool>(100, true)}).heap_bytes, 13u);
+
+    // Strings: one block for the array plus one per long string
+    std::vector<std::string> strings{"ON", std::string(64, 'y'), "OFF"};
+    auto string_usage = memory_usage(Value{strings});
+    EXPECT_EQ(string_usage.allocations, 2u);
+    EXPECT_EQ(string_usage.inline_strings, 2u);
+    EXPECT_EQ(string_usage.heap_strings, 1u);
+    EXPECT_GE(string_usage.heap_bytes, 3 * sizeof(std::string) + 65);
+}
+
+TEST(FootprintTest, StructsRecurse) {
+    StructValue route("Route");
+    auto before = memory_usage(route);
+    EXPECT_EQ(before.inline_bytes, sizeof(StructValue));
+    EXPECT_EQ(before.structs, 1u);
+    EXPECT_EQ(before.allocations, 0u);
+
+    // One map node per field
+    route.set_field("Id", uint32_t(1));
+    auto one_field = memory_usage(route);
+    EXPECT_EQ(one_field.allocations, 1u);
+    EXPECT_GT(one_field.heap_bytes, FIELD_NODE_MIN);
+
+    // Nested struct: node + make_shared block + its own two nodes
+    route.set_field("Start", position(1, 2));
+    auto nested = memory_usage(route);
+    EXPECT_EQ(nested.allocations, 1u + 1u + 1u + 2u);
+    EXPECT_EQ(nested.structs, 2u);
+    EXPECT_GT(nested.heap_bytes, one_field.heap_bytes + sizeof(StructValue) + 3 * FIELD_NODE_MIN);
+
+    // Struct array: array block plus each distinct element; a shared element counts once
+    auto shared = position(3, 4);
+    route.set_field("Stops", std::vector<std::shared_ptr<StructValue>>{shared, position(5, 6), shared});
+    auto with_array = memory_usage(route);
+    EXPECT_EQ(with_array.structs, 4u);
+    EXPECT_EQ(with_array.allocations, nested.allocations + 1u + 1u + 2u * (1u + 2u));
+
+    // Through a Value the StructValue itself is a heap object
+    auto as_value = memory_usage(Value{std::make_shared<StructValue>(route)});
+    EXPECT_EQ(as_value.inline_bytes, sizeof(Value));
+    EXPECT_EQ(as_value.allocations, with_array.allocations + 1u);
+    EXPECT_GT(as_value.heap_bytes, with_array.heap_bytes + sizeof(StructValue));
+}
+
+TEST(FootprintTest, RegistryReport) {
+    StructRegistry registry;
+    StructDefinition pos("Position", "Geographic position");
+    pos.add_field(FieldDefinition("Latitude", ValueType::DOUBLE))
+       .add_field(FieldDefinition("Longitude", ValueType::DOUBLE));
+    registry.register_struct(pos);
+
+    FieldDefinition start("Start", ValueType::STRUCT);
+    start.struct_type_name = "Position";
+    FieldDefinition name("Name", ValueType::STRING);
+    name.default_value = Value{std::string(40, 'r')};
+    StructDefinition route("Route");
+    route.add_field(start).add_field(name).add_field(FieldDefinition("Stops", ValueType::STRUCT_ARRAY));
+    registry.register_struct(route);
+
+    // Self-referencing type must not recurse forever
+    FieldDefinition next("Next", ValueType::STRUCT);
+    next.struct_type_name = "Node";
+    StructDefinition node("Node");
+    node.add_field(next);
+    registry.register_struct(node);
+
+    auto report = memory_report(registry);
+    ASSERT_EQ(report.structs.size(), 3u);
+    EXPECT_EQ(report.structs[0].type_name, "Node");
+    EXPECT_EQ(report.structs[1].type_name, "Position");
+    EXPECT_EQ(report.structs[2].type_name, "Route");
+
+    const auto& pos_entry = report.structs[1];
+    EXPECT_EQ(pos_entry.field_count, 2u);
+    EXPECT_EQ(pos_entry.instance.structs, 1u);
+    EXPECT_EQ(pos_entry.instance.allocations, 2u);
+    EXPECT_EQ(pos_entry.definition.total_bytes(), memory_usage(pos).total_bytes());
+
+    const auto& route_entry = report.structs[2];
+    EXPECT_EQ(route_entry.instance.structs, 2u);        // Start is filled from Position
+    EXPECT_EQ(route_entry.instance.heap_strings, 1u);   // Name default
+    EXPECT_GT(route_entry.instance.total_bytes(), pos_entry.instance.total_bytes());
+
+    EXPECT_GT(report.structs[0].instance.structs, 1u);
+
+    size_t definitions = 0;
+    for (const auto& entry : report.structs) {
+        definitions += entry.definition.heap_bytes;
+    }
+    EXPECT_GT(report.registry.heap_bytes, definitions);
+
+    const std::string table = report.to_string();
+    EXPECT_NE(table.find("Route"), std::string::npos);
+    EXPECT_NE(table.find("3 struct types"), std::string::npos);
+}
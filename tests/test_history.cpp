@@ -0,0 +1,123 @@
+/**
+ * @file test_history.cpp
+ * @brief Tests for the as-of history store
+ */
+
+#include "vss_test_helpers.hpp"
+#include <vss/types/history.hpp>
+#include <gtest/gtest.h>
+#include <random>
+
+using namespace vss::types;
+using namespace vss::types::test;
+using namespace std::chrono_literals;
+
+TEST(HistoryStoreTest, AsOfSingleSignal) {
+    HistoryStore history;
+    EXPECT_FALSE(history.record(INVALID_SIGNAL_ID, sample(Value{1}, 0)));
+    history.record(3, sample(Value{int32_t(1)}, 10));
+    history.record(3, sample(Value{int32_t(2)}, 20));
+    history.record(3, sample(Value{int32_t(3)}, 30, SignalQuality::INVALID));
+
+    EXPECT_FALSE(history.as_of(3, at(9ms)).has_value());
+    EXPECT_FALSE(history.as_of(0, at(100ms)).has_value());
+    EXPECT_FALSE(history.as_of(99, at(100ms)).has_value());
+
+    auto v = history.as_of(3, at(25ms));
+    ASSERT_TRUE(v.has_value());
+    EXPECT_EQ(std::get<int32_t>(v->value), 2);
+    EXPECT_EQ(v->timestamp, at(20ms));
+    EXPECT_EQ(history.as_of(3, at(20ms))->timestamp, at(20ms));
+
+    auto last = history.as_of(3, at(1000ms));
+    EXPECT_EQ(std::get<int32_t>(last->value), 3);
+    EXPECT_EQ(last->quality, SignalQuality::INVALID);
+    EXPECT_EQ(history.size(3), 3u);
+}
+
+TEST(HistoryStoreTest, OutOfOrderRecords) {
+    HistoryStore history;
+    history.record(SignalUpdate{1, sample(Value{std::string("c")}, 30)});
+    history.record(SignalUpdate{1, sample(Value{std::string("a")}, 10)});
+    history.record(SignalUpdate{1, sample(Value{std::string("b")}, 20)});
+
+    EXPECT_EQ(std::get<std::string>(history.as_of(1, at(15ms))->value), "a");
+    EXPECT_EQ(std::get<std::string>(history.as_of(1, at(29ms))->value), "b");
+    EXPECT_EQ(std::get<std::string>(history.as_of(1, at(30ms))->value), "c");
+}
+
+TEST(HistoryStoreTest, Snapshots) {
+    HistoryStore history;
+    history.record(0, sample(Value{1.0}, 0));
+    history.record(2, sample(Value{true}, 50));
+    history.record(5, sample(Value{uint8_t(7)}, 5));
+
+    auto all = history.snapshot(at(10ms));
+    ASSERT_EQ(all.size(), 2u);
+    EXPECT_EQ(all[0].id, 0u);
+    EXPECT_EQ(all[1].id, 5u);
+
+    SignalSet set;
+    set.insert(2);
+    set.insert(5);
+    set.insert(77);
+    auto some = history.snapshot(at(60ms), set);
+    ASSERT_EQ(some.size(), 2u);
+    EXPECT_EQ(some[0].id, 2u);
+    EXPECT_TRUE(std::get<bool>(some[0].value.value));
+}
+
+TEST(HistoryStoreTest, JoinMatchesPointLookups) {
+    HistoryStore history;
+    std::mt19937 rng(11);
+    std::uniform_int_distribution<int> step(1, 40);
+    for (SignalId id = 0; id < 4; ++id) {
+        int t = static_cast<int>(id) * 7;
+        for (int i = 0; i < 300; ++i) {
+            history.record(id, sample(Value{double(i)}, t));
+            t += step(rng);
+        }
+    }
+
+    std::vector<std::chrono::system_clock::time_point> sorted_times;
+    for (int t = -5; t < 7000; t += 13) {
+        sorted_times.push_back(at(std::chrono::milliseconds(t)));
+    }
+    auto shuffled = sorted_times;
+    std::shuffle(shuffled.begin(), shuffled.end(), rng);
+
+    const std::vector<SignalId> signals{0, 1, 2, 3, 42};
+    for (const auto* times : {&sorted_times, &shuffled}) {
+        auto table = history.as_of_join(signals, *times);
+        ASSERT_EQ(table.rows(), times->size());
+        ASSERT_EQ(table.columns(), signals.size());
+        for (size_t c = 0; c < signals.size(); ++c) {
+            for (size_t r = 0; r < table.rows(); ++r) {
+                auto expected = history.as_of(signals[c], (*times)[r]);
+                const auto& cell = table.cell(r, c);
+                if (!expected) {
+                    EXPECT_TRUE(is_empty(cell.value));
+                    EXPECT_EQ(cell.quality, SignalQuality::NOT_AVAILABLE);
+                } else {
+                    EXPECT_TRUE(dynamic_qualified_values_equal(cell, *expected));
+                    EXPECT_EQ(cell.timestamp, expected->timestamp);
+                }
+            }
+        }
+    }
+}
+
+TEST(HistoryStoreTest, TrimKeepsAnswersAfterCutoff) {
+    HistoryStore history;
+    for (int t = 0; t < 100; t += 10) {
+        history.record(1, sample(Value{int32_t(t)}, t));
+    }
+    history.trim_before(at(45ms));
+    EXPECT_EQ(history.size(1), 6u);     // 40 .. 90
+    EXPECT_EQ(std::get<int32_t>(history.as_of(1, at(45ms))->value), 40);
+    EXPECT_FALSE(history.as_of(1, at(30ms)).has_value());
+    EXPECT_EQ(history.total_size(), 6u);
+
+    history.clear();
+    EXPECT_EQ(history.total_size(), 0u);
+}
@@ -0,0 +1,139 @@
+/**
+ * @file test_instrumentation.cpp
+ * @brief Tests for the hot-path instrumentation counters
+ *
+ * Counts are only checked when the library is built with
+ * VSS_TYPES_ENABLE_INSTRUMENTATION; otherwise every counter must stay zero.
+ */
+
+#include <vss/types/instrumentation.hpp>
+#include <vss/types/struct.hpp>
+#include <gtest/gtest.h>
+#include <memory>
+#include <thread>
+
+using namespace vss::types;
+
+namespace {
+
+class InstrumentationTest : public ::testing::Test {
+protected:
+    void SetUp() override { reset_instrumentation(); }
+
+    // Expected count if instrumented, else 0
+    static uint64_t expect(uint64_t n) { return instrumentation_enabled() ? n : 0; }
+};
+
+} // namespace
+
+TEST_F(InstrumentationTest, ConversionsByPairAndOutcome) {
+    EXPECT_TRUE(is_empty(convert_value_type(Value{int32_t(300)}, ValueType::INT8)));
+    EXPECT_FALSE(is_empty(convert_value_type(Value{int32_t(5)}, ValueType::INT8)));
+    EXPECT_FALSE(is_empty(convert_value_type(Value{int32_t(6)}, ValueType::INT8)));
+    convert_value_type(Value{1.0f}, ValueType::FLOAT);
+    convert_value_type(Value{std::string("x")}, ValueType::INT8);
+    convert_value_type(Value{std::vector<int32_t>{1, 1000}}, ValueType::INT8_ARRAY);
+
+    auto s = instrumentation_snapshot();
+    EXPECT_EQ(s.conversion_count(ValueType::INT32, ValueType::INT8, ConversionOutcome::OUT_OF_RANGE), expect(1));
+    EXPECT_EQ(s.conversion_count(ValueType::INT32, ValueType::INT8, ConversionOutcome::CONVERTED), expect(2));
+    EXPECT_EQ(s.conversion_count(ValueType::FLOAT, ValueType::FLOAT, ConversionOutcome::UNCHANGED), expect(1));
+    EXPECT_EQ(s.conversion_count(ValueType::STRING, ValueType::INT8, ConversionOutcome::INCOMPATIBLE), expect(1));
+    EXPECT_EQ(s.conversion_count(ValueType::INT32_ARRAY, ValueType::INT8_ARRAY, ConversionOutcome::OUT_OF_RANGE),
+              expect(1));
+    EXPECT_EQ(s.conversion_count(ConversionOutcome::OUT_OF_RANGE), expect(2));
+    EXPECT_EQ(s.conversions.size(), instrumentation_enabled() ? 5u : 0u);
+
+    // Reset starts from zero again
+    reset_instrumentation();
+    EXPECT_TRUE(instrumentation_snapshot().conversions.empty());
+    EXPECT_STREQ(conversion_outcome_to_string(ConversionOutcome::OUT_OF_RANGE), "OUT_OF_RANGE");
+}
+
+TEST_F(InstrumentationTest, ValidationsByOutcome) {
+    StructRegistry registry;
+    FieldDefinition speed("Speed", ValueType::FLOAT);
+    speed.constraints.max = 300.0;
+    StructDefinition point("Point");
+    point.add_field(speed).add_field(FieldDefinition("Name", ValueType::STRING));
+    registry.register_struct(point);
+    StructDefinition route("Route");
+    route.add_field(FieldDefinition("Start", ValueType::STRUCT));
+    registry.register_struct(route);
+
+    StructValue ok("Point");
+    ok.set_field("Speed", 50.0f);
+    ok.set_field("Name", std::string("A"));
+    EXPECT_FALSE(validate_struct(ok, registry).has_value());
+
+    StructValue missing("Point");
+    missing.set_field("Speed", 50.0f);
+    EXPECT_TRUE(validate_struct(missing, registry).has_value());
+
+    StructValue fast = ok;
+    fast.set_field("Speed", 500.0f);
+    EXPECT_TRUE(validate_struct(fast, registry).has_value());
+
+    StructValue extra = ok;
+    extra.set_field("Color", std::string("red"));
+    EXPECT_TRUE(validate_struct(extra, registry).has_value());
+    EXPECT_FALSE(validate_struct(extra, registry, false).has_value());
+
+    StructValue wrong = ok;
+    wrong.set_field("Name", int32_t(1));
+    EXPECT_TRUE(validate_struct(wrong, registry).has_value());
+
+    EXPECT_TRUE(validate_struct(StructValue("Unknown"), registry).has_value());
+
+    // A nested error counts once, by its root cause
+    StructValue nested("Route");
+    nested.set_field("Start", std::make_shared<StructValue>(fast));
+    EXPECT_TRUE(validate_struct(nested, registry).has_value());
+
+    auto s = instrumentation_snapshot();
+    EXPECT_EQ(s.validation_count(ValidationOutcome::VALID), expect(2));
+    EXPECT_EQ(s.validation_count(ValidationOutcome::MISSING_FIELD), expect(1));
+    EXPECT_EQ(s.validation_count(ValidationOutcome::CONSTRAINT_VIOLATION), expect(2));
+    EXPECT_EQ(s.validation_count(ValidationOutcome::EXTRA_FIELD), expect(1));
+    EXPECT_EQ(s.validation_count(ValidationOutcome::TYPE_MISMATCH), expect(1));
+    EXPECT_EQ(s.validation_count(ValidationOutcome::UNKNOWN_TYPE), expect(1));
+}
+
+TEST_F(InstrumentationTest, DeepCompareVisits) {
+    auto make = [](float speed) {
+        auto inner = std::make_shared<StructValue>("Point");
+        inner->set_field("Speed", speed);
+        inner->set_field("Name", std::string("A"));
+        StructValue outer("Route");
+        outer.set_field("Start", inner);
+        return Value{std::make_shared<StructValue>(outer)};
+    };
+
+    EXPECT_TRUE(values_equal(make(1.0f), make(1.0f)));
+    EXPECT_TRUE(values_equal(Value{1}, Value{1}));
+
+    // 2 calls; Route, Start and Point's 2 fields are 4 values; 2 structs
+    auto s = instrumentation_snapshot();
+    EXPECT_EQ(s.compare_calls, expect(2));
+    EXPECT_EQ(s.compare_nodes, expect(5));
+    EXPECT_EQ(s.compare_structs, expect(2));
+}
+
+TEST_F(InstrumentationTest, CountsFromAllThreads) {
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([] {
+            for (int i = 0; i < 1000; ++i) {
+                convert_value_type(Value{int16_t(i)}, ValueType::INT64);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // The threads have exited; their counts are kept
+    convert_value_type(Value{int16_t(1)}, ValueType::INT64);
+    auto s = instrumentation_snapshot();
+    EXPECT_EQ(s.conversion_count(ValueType::INT16, ValueType::INT64, ConversionOutcome::CONVERTED), expect(4001));
+}
@@ -0,0 +1,191 @@
+/**
+ * @file test_latency.cpp
+ * @brief Tests for latency histograms and stage instrumentation
+ */
+
+#include <vss/types/latency.hpp>
+#include "alloc_tracker.hpp"
+#include <vss/types/clock.hpp>
+#include <vss/types/constraints.hpp>
+#include <vss/types/decoder.hpp>
+#include <vss/types/scaling.hpp>
+#include <vss/types/scheduler.hpp>
+#include <gtest/gtest.h>
+#include <thread>
+
+using namespace vss::types;
+using namespace std::chrono_literals;
+
+TEST(LatencyHistogramTest, BucketLayout) {
+    using H = LatencyHistogram;
+    EXPECT_EQ(H::BUCKET_COUNT, 1984u);
+
+    // Exact below 128 ns
+    for (int64_t ns = 0; ns < 128; ++ns) {
+        EXPECT_EQ(H::bucket_index(ns), static_cast<size_t>(ns));
+    }
+
+    // Buckets are contiguous and each value lies within its bucket
+    for (size_t i = 1; i < H::BUCKET_COUNT; ++i) {
+        EXPECT_EQ(H::bucket_lower(i), H::bucket_upper(i - 1) + 1) << i;
+    }
+    for (int64_t ns : {int64_t(128), int64_t(1000), int64_t(123456), int64_t(987654321), H::MAX_TRACKABLE_NS}) {
+        const size_t i = H::bucket_index(ns);
+        EXPECT_LE(H::bucket_lower(i), ns);
+        EXPECT_GE(H::bucket_upper(i), ns);
+        EXPECT_LT(static_cast<double>(H::bucket_upper(i) - H::bucket_lower(i)), 0.016 * static_cast<double>(ns));
+    }
+    EXPECT_EQ(H::bucket_index(H::MAX_TRACKABLE_NS), H::BUCKET_COUNT - 1);
+    EXPECT_EQ(H::bucket_index(INT64_MAX), H::BUCKET_COUNT - 1);
+}
+
+TEST(LatencyHistogramTest, QuantilesAndMerge) {
+    LatencyHistogram h;
+    EXPECT_FALSE(h.quantile(0.5).has_value());
+    EXPECT_EQ(h.summary().count, 0u);
+
+    // 1..10000 us
+    for (int i = 1; i <= 10000; ++i) {
+        h.record(std::chrono::microseconds(i));
+    }
+    EXPECT_EQ(h.count(), 10000u);
+    EXPECT_EQ(h.min(), 1us);
+    EXPECT_EQ(h.max(), 10000us);
+    EXPECT_EQ(h.mean(), std::chrono::nanoseconds(5000500));
+
+    auto near = [](std::chrono::nanoseconds actual, std::chrono::nanoseconds expected) {
+        return std::abs(static_cast<double>((actual - expected).count())) <= 0.016 * static_cast<double>(expected.count());
+    };
+    EXPECT_TRUE(near(*h.quantile(0.5), 5000us));
+    EXPECT_TRUE(near(*h.quantile(0.99), 9900us));
+    EXPECT_EQ(*h.quantile(1.0), 10000us);
+    EXPECT_EQ(*h.quantile(0.0), 1us);
+    EXPECT_FALSE(h.quantile(1.5).has_value());
+
+    auto s = h.summary();
+    EXPECT_EQ(s.p50, *h.quantile(0.5));
+    EXPECT_EQ(s.p90, *h.quantile(0.9));
+    EXPECT_EQ(s.p99, *h.quantile(0.99));
+    EXPECT_EQ(s.p999, *h.quantile(0.999));
+
+    // Merging equals recording everything in one histogram
+    LatencyHistogram a, b, all;
+    for (int i = 0; i < 1000; ++i) {
+        auto v = std::chrono::nanoseconds(i * 7919 % 100000);
+        (i % 2 ? a : b).record(v);
+        all.record(v);
+    }
+    a.merge(b);
+    EXPECT_EQ(a.count(), all.count());
+    EXPECT_EQ(a.min(), all.min());
+    EXPECT_EQ(a.max(), all.max());
+    for (size_t i = 0; i < LatencyHistogram::BUCKET_COUNT; ++i) {
+        ASSERT_EQ(a.bucket_count(i), all.bucket_count(i));
+    }
+
+    // Weighted and negative samples
+    LatencyHistogram w;
+    w.record(-5ns, 3);
+    EXPECT_EQ(w.count(), 3u);
+    EXPECT_EQ(w.max(), 0ns);
+    w.clear();
+    EXPECT_EQ(w.count(), 0u);
+}
+
+TEST(LatencyRecorderTest, ConcurrentRecording) {
+    LatencyRecorder recorder(4);
+    EXPECT_EQ(recorder.shard_count(), 4u);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 6; ++t) {
+        threads.emplace_back([&recorder, t] {
+            for (int i = 1; i <= 10000; ++i) {
+                recorder.record(std::chrono::nanoseconds(i + t));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    auto h = recorder.snapshot();
+    EXPECT_EQ(h.count(), 60000u);
+    EXPECT_EQ(h.min(), 1ns);
+    EXPECT_EQ(h.max(), 10005ns);
+
+    recorder.reset();
+    EXPECT_EQ(recorder.snapshot().count(), 0u);
+
+    // Age of a value against the installed clock
+    ManualClock clock{std::chrono::system_clock::time_point(10s)};
+    ScopedClockSource scope{clock};
+    recorder.record_age(DynamicQualifiedValue{Value{1.0f}, SignalQuality::VALID,
+                                              std::chrono::system_clock::time_point(10s - 250us)});
+    EXPECT_EQ(recorder.snapshot().max(), 250us);
+}
+
+TEST(LatencyRecorderTest, StageHooks) {
+    ManualClock clock{std::chrono::system_clock::time_point(1s)};
+    ScopedClockSource clock_scope{clock};
+    const auto captured = std::chrono::system_clock::time_point(1s - 2ms);
+
+    LatencyRecorder decode, conversion, validation, dispatch;
+    EXPECT_EQ(stage_recorder(PipelineStage::DECODE), nullptr);
+    {
+        ScopedStageRecorder s1{PipelineStage::DECODE, decode};
+        ScopedStageRecorder s2{PipelineStage::CONVERSION, conversion};
+        ScopedStageRecorder s3{PipelineStage::VALIDATION, validation};
+        ScopedStageRecorder s4{PipelineStage::DISPATCH, dispatch};
+        EXPECT_EQ(stage_recorder(PipelineStage::DISPATCH), &dispatch);
+
+        FrameDecoder decoder;
+        SignalDescriptor speed;
+        speed.length = 16;
+        speed.target_type = ValueType::UINT16;
+        speed.slot = 0;
+        ASSERT_TRUE(decoder.add_signal(speed));
+        const uint8_t frame[8] = {1, 2};
+        std::vector<DynamicQualifiedValue> slots;
+        EXPECT_EQ(decoder.decode(frame, 8, slots, captured), 1u);
+
+        const int16_t raw[3] = {10, 20, 30};
+        std::vector<DynamicQualifiedValue> scaled(3);
+        ScalingParams params;
+        scale_into_slots(raw, 3, params, ValueType::FLOAT, scaled.data(), captured);
+
+        clock.advance(1ms);
+        ValueConstraints constraints;
+        constraints.max = 25.0;
+        ConstraintChecker checker{constraints};
+        EXPECT_EQ(checker.apply(scaled.data(), scaled.size()), 1u);
+
+        SignalCatalog catalog;
+        auto id = catalog.add_signal("Vehicle.Speed", NodeType::SENSOR, ValueType::FLOAT);
+        UpdateScheduler scheduler(catalog);
+        scheduler.submit(SignalUpdate{*id, scaled[0]});
+        clock.advance(1ms);
+        std::vector<SignalUpdate> out;
+        EXPECT_EQ(scheduler.dispatch(out, 10), 1u);
+    }
+    EXPECT_EQ(stage_recorder(PipelineStage::DECODE), nullptr);
+    EXPECT_STREQ(pipeline_stage_to_string(PipelineStage::VALIDATION), "VALIDATION");
+
+    EXPECT_EQ(decode.snapshot().count(), 1u);
+    EXPECT_EQ(decode.snapshot().max(), 2ms);
+    EXPECT_EQ(conversion.snapshot().count(), 3u);
+    EXPECT_EQ(conversion.snapshot().max(), 2ms);
+    EXPECT_EQ(validation.snapshot().count(), 3u);
+    EXPECT_EQ(validation.snapshot().min(), 3ms);
+    EXPECT_EQ(dispatch.snapshot().count(), 1u);
+    EXPECT_EQ(dispatch.snapshot().max(), 4ms);
+}
+
+TEST(LatencyRecorderTest, RecordingDoesNotAllocate) {
+    LatencyHistogram histogram;
+    LatencyRecorder recorder(2);
+    const auto ts = std::chrono::system_clock::time_point(std::chrono::seconds(10));
+
+    EXPECT_NO_ALLOCATIONS(histogram.record(std::chrono::microseconds(250)));
+    EXPECT_STEADY_STATE_NO_ALLOCATIONS(recorder.record(std::chrono::microseconds(250)));
+    EXPECT_STEADY_STATE_NO_ALLOCATIONS(recorder.record_age(ts, ts + std::chrono::milliseconds(3)));
+}
@@ -0,0 +1,99 @@
+/**
+ * @file test_merge.cpp
+ * @brief Tests for update sources and the k-way merge
+ */
+
+#include "vss_test_helpers.hpp"
+#include <vss/types/merge.hpp>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <memory>
+#include <random>
+
+using namespace vss::types;
+using namespace vss::types::test;
+using namespace std::chrono_literals;
+
+TEST(UpdateSourceTest, VectorSourcePullsInBatches) {
+    VectorUpdateSource source({update(1, 0), update(1, 1), update(1, 2)});
+    std::vector<SignalUpdate> out;
+    EXPECT_EQ(source.pull(out, 2), 2u);
+    EXPECT_EQ(source.remaining(), 1u);
+    EXPECT_EQ(source.pull(out, 2), 1u);
+    EXPECT_EQ(source.pull(out, 2), 0u);
+    ASSERT_EQ(out.size(), 3u);
+    EXPECT_EQ(out[2].value.timestamp, at(2ms));
+}
+
+TEST(UpdateMergerTest, MergesByTimestamp) {
+    VectorUpdateSource a({update(1, 0), update(1, 30), update(1, 40)});
+    VectorUpdateSource b({update(2, 10), update(2, 20), update(2, 50)});
+    VectorUpdateSource c({});
+    UpdateMerger merger({&a, nullptr, &b, &c}, 2);
+    EXPECT_EQ(merger.source_count(), 3u);
+
+    ASSERT_NE(merger.peek(), nullptr);
+    EXPECT_EQ(merger.peek()->id, 1u);
+
+    std::vector<int64_t> times;
+    SignalUpdate u;
+    while (merger.next(u)) {
+        times.push_back(std::chrono::duration_cast<std::chrono::milliseconds>(
+            u.value.timestamp.time_since_epoch()).count());
+    }
+    EXPECT_EQ(times, (std::vector<int64_t>{0, 10, 20, 30, 40, 50}));
+    EXPECT_TRUE(merger.done());
+    EXPECT_EQ(merger.peek(), nullptr);
+
+    UpdateMerger empty({});
+    EXPECT_TRUE(empty.done());
+    EXPECT_FALSE(empty.next(u));
+}
+
+TEST(UpdateMergerTest, TiesFollowSourceOrderAndValuesMove) {
+    auto payload = std::string(64, 'x');
+    VectorUpdateSource a({update(1, 5, Value{payload})});
+    VectorUpdateSource b({update(2, 5), update(2, 5)});
+    UpdateMerger merger({&b, &a});
+
+    std::vector<SignalUpdate> out;
+    EXPECT_EQ(merger.next_batch(out, 10), 3u);
+    ASSERT_EQ(out.size(), 3u);
+    EXPECT_EQ(out[0].id, 2u);
+    EXPECT_EQ(out[1].id, 2u);
+    EXPECT_EQ(out[2].id, 1u);
+    EXPECT_EQ(std::get<std::string>(out[2].value.value), payload);
+    EXPECT_EQ(merger.next_batch(out, 10), 0u);
+}
+
+TEST(UpdateMergerTest, ManySources) {
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> step(0, 5);
+    const size_t k = 1000;
+
+    std::vector<std::unique_ptr<VectorUpdateSource>> sources;
+    std::vector<UpdateSource*> pointers;
+    size_t total = 0;
+    for (size_t s = 0; s < k; ++s) {
+        std::vector<SignalUpdate> updates;
+        int t = 0;
+        size_t n = s % 17;
+        for (size_t i = 0; i < n; ++i) {
+            t += step(rng);
+            updates.push_back(update(static_cast<SignalId>(s), t));
+        }
+        total += n;
+        sources.push_back(std::make_unique<VectorUpdateSource>(std::move(updates)));
+        pointers.push_back(sources.back().get());
+    }
+
+    UpdateMerger merger(pointers, 4);
+    std::vector<SignalUpdate> out;
+    while (merger.next_batch(out, 100) > 0) {
+    }
+    ASSERT_EQ(out.size(), total);
+    EXPECT_TRUE(std::is_sorted(out.begin(), out.end(), [](const SignalUpdate& x, const SignalUpdate& y) {
+        return x.value.timestamp < y.value.timestamp
+            || (x.value.timestamp == y.value.timestamp && x.id < y.id);
+    }));
+}
@@ -0,0 +1,281 @@
+/**
+ * @file test_recording.cpp
+ * @brief Tests for the binary recording format
+ */
+
+#include "vss_test_helpers.hpp"
+#include <vss/types/recording.hpp>
+#include <vss/types/enum.hpp>
+#include <vss/types/struct.hpp>
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+
+using namespace vss::types;
+using namespace vss::types::test;
+using namespace std::chrono_literals;
+
+namespace {
+
+class RecordingTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        path_ = (std::filesystem::temp_directory_path() /
+                 ("vss_recording_" + std::string(::testing::UnitTest::GetInstance()->current_test_info()->name())
+                  + ".vssrec")).string();
+    }
+
+    void TearDown() override {
+        std::filesystem::remove(path_);
+    }
+
+    std::string path_;
+};
+
+} // namespace
+
+TEST_F(RecordingTest, RoundTripsAllValueKinds) {
+    auto colors = EnumDictionary::create({"RED", "GREEN"});
+    const std::vector<Value> values{
+        Value{},
+        Value{true},
+        Value{int8_t(-5)},
+        Value{uint16_t(4000)},
+        Value{int64_t(-1234567890123)},
+        Value{3.5f},
+        Value{2.25},
+        Value{std::string("hello")},
+        Value{std::vector<bool>{true, false, true}},
+        Value{std::vector<int32_t>{1, -2, 3}},
+        Value{std::vector<double>{0.5, 1.5}},
+        Value{std::vector<std::string>{"a", "", "bcd"}},
+        Value{std::vector<uint8_t>{}},
+    };
+
+    RecordingWriter writer;
+    ASSERT_TRUE(writer.open(path_));
+    for (size_t i = 0; i < values.size(); ++i) {
+        EXPECT_TRUE(writer.write(static_cast<SignalId>(i),
+                                 DynamicQualifiedValue{values[i], SignalQuality::VALID, at(std::chrono::milliseconds(i))}));
+    }
+    EXPECT_TRUE(writer.write(SignalUpdate{99, DynamicQualifiedValue{colors->encode("GREEN"), SignalQuality::INVALID, at(100ms)}}));
+    EXPECT_FALSE(writer.write(1, DynamicQualifiedValue{Value{std::make_shared<StructValue>("T")}, SignalQuality::VALID, at(0ms)}));
+    EXPECT_EQ(writer.records_written(), values.size() + 1);
+    EXPECT_TRUE(writer.close());
+    EXPECT_FALSE(writer.write(1, DynamicQualifiedValue{Value{1}, SignalQuality::VALID, at(0ms)}));
+
+    RecordingReader reader;
+    ASSERT_TRUE(reader.open(path_));
+    auto updates = reader.read();
+    ASSERT_EQ(updates.size(), values.size() + 1);
+    for (size_t i = 0; i < values.size(); ++i) {
+        EXPECT_EQ(updates[i].id, i);
+        EXPECT_TRUE(values_equal(updates[i].value.value, values[i])) << i;
+        EXPECT_EQ(updates[i].value.timestamp, at(std::chrono::milliseconds(i)));
+    }
+    EXPECT_EQ(std::get<std::string>(updates.back().value.value), "GREEN");
+    EXPECT_EQ(updates.back().value.quality, SignalQuality::INVALID);
+}
+
+TEST_F(RecordingTest, ZeroCopyViews) {
+    RecordingWriter writer;
+    ASSERT_TRUE(writer.open(path_));
+    writer.write(1, DynamicQualifiedValue{Value{uint32_t(7)}, SignalQuality::VALID, at(0ms)});
+    writer.write(2, DynamicQualifiedValue{Value{std::string("text")}, SignalQuality::VALID, at(1ms)});
+    writer.write(3, DynamicQualifiedValue{Value{std::vector<float>{1.f, 2.f}}, SignalQuality::VALID, at(2ms)});
+    writer.write(4, DynamicQualifiedValue{Value{std::vector<std::string>{"x", "yz"}}, SignalQuality::VALID, at(3ms)});
+    writer.close();
+
+    RecordingReader reader;
+    ASSERT_TRUE(reader.open(path_));
+    size_t seen = reader.scan({}, [&](const RecordView& r) {
+        switch (r.id) {
+            case 1:
+                EXPECT_EQ(r.scalar<uint32_t>(), 7u);
+                EXPECT_FALSE(r.scalar<int32_t>().has_value());
+                EXPECT_DOUBLE_EQ(*r.as_double(), 7.0);
+                break;
+            case 2:
+                EXPECT_EQ(r.as_string(), "text");
+                EXPECT_FALSE(r.as_double().has_value());
+                break;
+            case 3:
+                ASSERT_NE(r.array<float>(), nullptr);
+                EXPECT_EQ(r.count, 2u);
+                EXPECT_FLOAT_EQ(r.array<float>()[1], 2.f);
+                EXPECT_EQ(r.array<double>(), nullptr);
+                break;
+            case 4:
+                EXPECT_EQ(r.string_at(1), "yz");
+                EXPECT_EQ(r.string_at(2), "");
+                break;
+        }
+    });
+    EXPECT_EQ(seen, 4u);
+}
+
+TEST_F(RecordingTest, QueriesUseChunkIndex) {
+    RecordingOptions options;
+    options.chunk_bytes = 1024;     // many small chunks
+    RecordingWriter writer(options);
+    ASSERT_TRUE(writer.open(path_));
+    for (int t = 0; t < 1000; ++t) {
+        writer.write(static_cast<SignalId>(t % 10),
+                     DynamicQualifiedValue{Value{double(t)}, SignalQuality::VALID, at(std::chrono::milliseconds(t))});
+    }
+    writer.close();
+
+    RecordingReader reader;
+    ASSERT_TRUE(reader.open(path_));
+    EXPECT_GT(reader.chunks().size(), 10u);
+    EXPECT_EQ(reader.record_count(), 1000u);
+    EXPECT_EQ(reader.chunks().front().min_time, at(0ms));
+
+    RecordQuery range;
+    range.begin = at(100ms);
+    range.end = at(200ms);
+    auto in_range = reader.read(range);
+    ASSERT_EQ(in_range.size(), 100u);
+    EXPECT_EQ(in_range.front().value.timestamp, at(100ms));
+    EXPECT_EQ(in_range.back().value.timestamp, at(199ms));
+
+    SignalSet signals;
+    signals.insert(3);
+    signals.insert(7);
+    RecordQuery by_signal;
+    by_signal.signals = &signals;
+    by_signal.end = at(500ms);
+    auto selected = reader.read(by_signal);
+    EXPECT_EQ(selected.size(), 100u);
+    for (const auto& u : selected) {
+        EXPECT_TRUE(u.id == 3 || u.id == 7);
+    }
+
+    SignalSet absent;
+    absent.insert(11);
+    by_signal.signals = &absent;
+    EXPECT_EQ(reader.scan(by_signal, [](const RecordView&) {}), 0u);
+}
+
+TEST_F(RecordingTest, AppendAndTruncatedTail) {
+    {
+        RecordingWriter writer;
+        ASSERT_TRUE(writer.open(path_));
+        writer.write(1, DynamicQualifiedValue{Value{1.0}, SignalQuality::VALID, at(0ms)});
+    }
+    {
+        RecordingWriter writer;
+        ASSERT_TRUE(writer.open(path_, true));
+        writer.write(1, DynamicQualifiedValue{Value{2.0}, SignalQuality::VALID, at(1ms)});
+        writer.write(1, DynamicQualifiedValue{Value{3.0}, SignalQuality::VALID, at(2ms)});
+    }
+
+    RecordingReader reader;
+    ASSERT_TRUE(reader.open(path_));
+    EXPECT_EQ(reader.chunks().size(), 2u);
+    EXPECT_EQ(reader.record_count(), 3u);
+    reader.close();
+
+    // Cut into the last chunk: only the first remains readable
+    std::filesystem::resize_file(path_, std::filesystem::file_size(path_) - 8);
+    ASSERT_TRUE(reader.open(path_));
+    EXPECT_EQ(reader.record_count(), 1u);
+    reader.close();
+
+    {
+        std::ofstream junk(path_, std::ios::binary | std::ios::trunc);
+        junk << "not a recording at all";
+    }
+    EXPECT_FALSE(reader.open(path_));
+    RecordingWriter writer;
+    EXPECT_FALSE(writer.open(path_, true));
+    EXPECT_FALSE(reader.open(path_ + ".missing"));
+}
+
+TEST_F(RecordingTest, AppendAfterCrashDropsPartialChunk) {
+    {
+        RecordingWriter writer;
+        ASSERT_TRUE(writer.open(path_));
+        writer.write(1, DynamicQualifiedValue{Value{1.0}, SignalQuality::VALID, at(0ms)});
+        writer.flush();
+        writer.write(1, DynamicQualifiedValue{Value{std::vector<float>(32, 2.0f)}, SignalQuality::VALID, at(1ms)});
+    }
+    // Crash while writing the second chunk
+    const auto full = std::filesystem::file_size(path_);
+    std::filesystem::resize_file(path_, full - 40);
+
+    {
+        RecordingWriter writer;
+        ASSERT_TRUE(writer.open(path_, true));
+        EXPECT_EQ(writer.records_written(), 1u);
+        writer.write(2, DynamicQualifiedValue{Value{int32_t(7)}, SignalQuality::VALID, at(2ms)});
+        writer.write(2, DynamicQualifiedValue{Value{int32_t(8)}, SignalQuality::VALID, at(3ms)});
+        EXPECT_EQ(writer.records_written(), 3u);
+    }
+
+    RecordingReader reader;
+    ASSERT_TRUE(reader.open(path_));
+    EXPECT_EQ(reader.chunks().size(), 2u);
+    const auto records = reader.read();
+    ASSERT_EQ(records.size(), 3u);
+    EXPECT_EQ(std::get<double>(records[0].value.value), 1.0);
+    EXPECT_EQ(std::get<int32_t>(records[1].value.value), 7);
+    EXPECT_EQ(std::get<int32_t>(records[2].value.value), 8);
+    reader.close();
+
+    // A different format version is not appended to
+    {
+        std::fstream file(path_, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(12);
+        const uint32_t version = 99;
+        file.write(reinterpret_cast<const char*>(&version), sizeof(version));
+    }
+    RecordingWriter writer;
+    EXPECT_FALSE(writer.open(path_, true));
+}
+
+TEST_F(RecordingTest, CorruptRecordsAreSkipped) {
+    {
+        RecordingWriter writer;
+        ASSERT_TRUE(writer.open(path_));
+        writer.write(1, DynamicQualifiedValue{Value{1.0}, SignalQuality::VALID, at(0ms)});
+        writer.write(2, DynamicQualifiedValue{Value{std::vector<float>(4, 2.0f)}, SignalQuality::VALID, at(1ms)});
+        writer.write(3, DynamicQualifiedValue{Value{std::vector<std::string>{"a", "b"}}, SignalQuality::VALID, at(2ms)});
+        writer.write(4, DynamicQualifiedValue{Value{int32_t(5)}, SignalQuality::VALID, at(3ms)});
+    }
+
+    // File header 16 bytes, chunk header 64, record header 24 with size at
+    // +16 and count at +20; payloads padded to 8 bytes
+    auto poke = [&](std::streamoff offset, uint32_t value) {
+        std::fstream file(path_, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(offset);
+        file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    };
+    poke(80 + 16, 4);                   // double record claims 4 bytes
+    poke(112 + 20, 1000);               // float array claims 1000 elements
+    poke(152 + 24 + 2 * 4, 1000);       // last string offset past the payload
+
+    RecordingReader reader;
+    ASSERT_TRUE(reader.open(path_));
+    const auto records = reader.read();
+    ASSERT_EQ(records.size(), 1u);
+    EXPECT_EQ(records[0].id, 4u);
+    EXPECT_EQ(std::get<int32_t>(records[0].value.value), 5);
+
+    // Accessors on a hand-made inconsistent view return empty results
+    const double d = 1.0;
+    RecordView view;
+    view.type = ValueType::DOUBLE;
+    view.data = reinterpret_cast<const uint8_t*>(&d);
+    view.size = 4;
+    view.count = 1;
+    EXPECT_FALSE(view.well_formed());
+    EXPECT_FALSE(view.as_double().has_value());
+    EXPECT_TRUE(std::holds_alternative<std::monostate>(view.to_value()));
+    view.type = ValueType::FLOAT_ARRAY;
+    view.count = 10;
+    EXPECT_EQ(view.array<float>(), nullptr);
+    EXPECT_TRUE(std::holds_alternative<std::monostate>(view.to_value()));
+    view.type = ValueType::STRING_ARRAY;
+    EXPECT_TRUE(view.string_at(0).empty());
+}
@@ -0,0 +1,141 @@
+/**
+ * @file test_reorder.cpp
+ * @brief Tests for the watermark reorder buffer
+ */
+
+#include "vss_test_helpers.hpp"
+#include <vss/types/reorder.hpp>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+
+using namespace vss::types;
+using namespace vss::types::test;
+using namespace std::chrono_literals;
+
+namespace {
+
+int64_t ms_of(const SignalUpdate& u) {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(u.value.timestamp.time_since_epoch()).count();
+}
+
+} // namespace
+
+TEST(ReorderBufferTest, ReleasesInOrderBehindWatermark) {
+    ReorderBuffer reorder(20ms, 16);
+    std::vector<int64_t> released;
+    reorder.set_release_handler([&](SignalUpdate&& u) { released.push_back(ms_of(u)); });
+
+    EXPECT_EQ(reorder.watermark(), std::chrono::system_clock::time_point::min());
+    reorder.push(update(1, 10));
+    reorder.push(update(1, 5));
+    reorder.push(update(1, 20));
+    EXPECT_TRUE(released.empty());
+    EXPECT_EQ(reorder.watermark(), at(0ms));
+
+    reorder.push(update(1, 30));    // watermark 10
+    EXPECT_EQ(released, (std::vector<int64_t>{5, 10}));
+    reorder.push(update(1, 15));    // still in time
+    reorder.push(update(1, 45));    // watermark 25
+    EXPECT_EQ(released, (std::vector<int64_t>{5, 10, 15, 20}));
+    EXPECT_EQ(reorder.size(), 2u);
+
+    reorder.flush();
+    EXPECT_EQ(released, (std::vector<int64_t>{5, 10, 15, 20, 30, 45}));
+    EXPECT_EQ(reorder.released(), 6u);
+}
+
+TEST(ReorderBufferTest, LateUpdatesAreCountedAndRouted) {
+    ReorderBuffer reorder(10ms, 16);
+    reorder.push(update(1, 100));
+    EXPECT_FALSE(reorder.push(update(2, 50)));     // behind watermark 90
+    EXPECT_EQ(reorder.late_updates(), 1u);
+
+    std::vector<SignalUpdate> late;
+    reorder.set_late_handler([&](SignalUpdate&& u) { late.push_back(std::move(u)); });
+    EXPECT_FALSE(reorder.push(update(3, 89)));
+    EXPECT_TRUE(reorder.push(update(4, 95)));
+    ASSERT_EQ(late.size(), 1u);
+    EXPECT_EQ(late[0].id, 3u);
+    EXPECT_EQ(reorder.late_updates(), 2u);
+}
+
+TEST(ReorderBufferTest, ExplicitWatermarkAndTies) {
+    ReorderBuffer reorder(1s, 16);
+    std::vector<SignalId> ids;
+    reorder.set_release_handler([&](SignalUpdate&& u) { ids.push_back(u.id); });
+
+    reorder.push(update(1, 10));
+    reorder.push(update(2, 10));
+    reorder.push(update(3, 5));
+    reorder.advance_watermark(at(10ms));
+    EXPECT_EQ(ids, (std::vector<SignalId>{3, 1, 2}));
+
+    reorder.advance_watermark(at(0ms));  // going back is ignored
+    EXPECT_EQ(reorder.watermark(), at(10ms));
+    EXPECT_FALSE(reorder.push(update(4, 9)));
+}
+
+TEST(ReorderBufferTest, FullBufferForcesOldestOut) {
+    ReorderBuffer reorder(1s, 3);
+    std::vector<int64_t> released;
+    reorder.set_release_handler([&](SignalUpdate&& u) { released.push_back(ms_of(u)); });
+
+    for (int t : {40, 10, 30, 20}) {
+        reorder.push(update(1, t));
+    }
+    EXPECT_EQ(reorder.capacity(), 3u);
+    EXPECT_EQ(reorder.size(), 3u);
+    EXPECT_EQ(reorder.forced_releases(), 1u);
+    EXPECT_EQ(released, (std::vector<int64_t>{10}));
+
+    // Older than a forced release: late
+    EXPECT_FALSE(reorder.push(update(1, 5)));
+}
+
+TEST(ReorderBufferTest, FullBufferReleasesOlderPushFirst) {
+    ReorderBuffer reorder(1s, 2);
+    std::vector<int64_t> released;
+    reorder.set_release_handler([&](SignalUpdate&& u) { released.push_back(ms_of(u)); });
+
+    reorder.push(update(1, 100));
+    reorder.push(update(1, 200));
+    EXPECT_TRUE(reorder.push(update(1, 50)));   // older than everything buffered
+    EXPECT_EQ(released, (std::vector<int64_t>{50}));
+    EXPECT_EQ(reorder.size(), 2u);
+    EXPECT_EQ(reorder.forced_releases(), 1u);
+    EXPECT_EQ(reorder.late_updates(), 0u);
+
+    reorder.flush();
+    EXPECT_EQ(released, (std::vector<int64_t>{50, 100, 200}));
+    EXPECT_FALSE(reorder.push(update(1, 60)));
+}
+
+TEST(ReorderBufferTest, RestoresOrderOfJitteredStream) {
+    std::mt19937 rng(3);
+    std::uniform_int_distribution<int> jitter(0, 30);
+
+    std::vector<SignalUpdate> arrivals;
+    for (int t = 0; t < 2000; ++t) {
+        arrivals.push_back(update(static_cast<SignalId>(t), t));
+    }
+    // Each update arrives up to 30ms after its timestamp
+    std::vector<std::pair<int, size_t>> order;
+    for (size_t i = 0; i < arrivals.size(); ++i) {
+        order.emplace_back(static_cast<int>(i) + jitter(rng), i);
+    }
+    std::sort(order.begin(), order.end());
+
+    ReorderBuffer reorder(30ms, 256);
+    std::vector<int64_t> released;
+    reorder.set_release_handler([&](SignalUpdate&& u) { released.push_back(ms_of(u)); });
+    for (const auto& entry : order) {
+        EXPECT_TRUE(reorder.push(std::move(arrivals[entry.second])));
+    }
+    reorder.flush();
+
+    EXPECT_EQ(released.size(), 2000u);
+    EXPECT_TRUE(std::is_sorted(released.begin(), released.end()));
+    EXPECT_EQ(reorder.late_updates(), 0u);
+    EXPECT_EQ(reorder.forced_releases(), 0u);
+}
@@ -0,0 +1,136 @@
+/**
+ * @file test_replay.cpp
+ * @brief Tests for the pluggable clock and the replay engine
+ */
+
+#include "vss_test_helpers.hpp"
+#include <vss/types/replay.hpp>
+#include <gtest/gtest.h>
+#include <filesystem>
+
+using namespace vss::types;
+using namespace vss::types::test;
+using namespace std::chrono_literals;
+
+TEST(ClockTest, ManualClockDrivesTimestamps) {
+    EXPECT_EQ(clock_source(), nullptr);
+    ManualClock clock{at(5000ms)};
+    {
+        ScopedClockSource scope{clock};
+        EXPECT_EQ(clock_source(), &clock);
+
+        DynamicQualifiedValue dynamic{Value{1.0}};
+        QualifiedValue<float> typed{2.0f};
+        EXPECT_EQ(dynamic.timestamp, at(5000ms));
+        EXPECT_EQ(typed.timestamp, at(5000ms));
+
+        clock.advance(250ms);
+        EXPECT_EQ(now(), at(5250ms));
+        EXPECT_EQ(typed.age(), 250ms);
+    }
+    EXPECT_EQ(clock_source(), nullptr);
+    EXPECT_GT(DynamicQualifiedValue{}.timestamp, at(5000ms));
+}
+
+TEST(ReplayEngineTest, UnthrottledBatchesAndClock) {
+    VectorUpdateSource source(updates(1000, 10, 1000));
+    ReplayOptions options;
+    options.speed = 0;
+    options.batch_size = 64;
+    ReplayEngine replay(options);
+
+    size_t seen = 0;
+    bool clock_ok = true;
+    replay.add_consumer([&](const std::vector<SignalUpdate>& batch) {
+        EXPECT_LE(batch.size(), 64u);
+        seen += batch.size();
+        // Values made while consuming carry the time of the newest update
+        clock_ok &= DynamicQualifiedValue{Value{0}}.timestamp == batch.back().value.timestamp;
+    });
+    size_t second = 0;
+    replay.add_consumer([&](const std::vector<SignalUpdate>& batch) { second += batch.size(); });
+
+    ReplayStats stats = replay.run(source);
+    EXPECT_EQ(stats.events, 1000u);
+    EXPECT_EQ(stats.batches, 16u);
+    EXPECT_EQ(seen, 1000u);
+    EXPECT_EQ(second, 1000u);
+    EXPECT_TRUE(clock_ok);
+    EXPECT_EQ(stats.recorded_span, 9990ms);
+    EXPECT_GT(stats.events_per_second(), 0.0);
+    EXPECT_FALSE(stats.stopped);
+    EXPECT_EQ(clock_source(), nullptr);
+    EXPECT_EQ(replay.clock().now(), at(10990ms));
+}
+
+TEST(ReplayEngineTest, ThrottledFollowsRecordedTime) {
+    // 200ms of recording at 4x speed: about 50ms of wall time
+    VectorUpdateSource source(updates(21, 10, 1000));
+    ReplayOptions options;
+    options.speed = 4.0;
+    ReplayEngine replay(options);
+    size_t batches = 0;
+    replay.add_consumer([&](const std::vector<SignalUpdate>&) { ++batches; });
+
+    ReplayStats stats = replay.run(source);
+    EXPECT_EQ(stats.events, 21u);
+    EXPECT_GE(stats.wall_time, 49ms);
+    EXPECT_LT(stats.wall_time, 1000ms);
+    // Each update was due at its own millisecond
+    EXPECT_EQ(batches, 21u);
+}
+
+TEST(ReplayEngineTest, StopAndRecordingInput) {
+    const auto path = (std::filesystem::temp_directory_path() / "vss_replay_test.vssrec").string();
+    {
+        RecordingWriter writer;
+        ASSERT_TRUE(writer.open(path));
+        for (const auto& u : updates(500, 1, 1000)) {
+            writer.write(u);
+        }
+    }
+    RecordingReader reader;
+    ASSERT_TRUE(reader.open(path));
+
+    ReplayOptions options;
+    options.speed = 0;
+    options.batch_size = 100;
+    options.drive_clock = false;
+    ReplayEngine replay(options);
+    std::vector<int32_t> values;
+    replay.add_consumer([&](const std::vector<SignalUpdate>& batch) {
+        for (const auto& u : batch) {
+            values.push_back(std::get<int32_t>(u.value.value));
+        }
+        if (values.size() >= 200) {
+            replay.stop();
+        }
+    });
+
+    ReplayStats stats = replay.run(reader);
+    EXPECT_TRUE(stats.stopped);
+    EXPECT_EQ(values.size(), 200u);
+    EXPECT_EQ(values[199], 199);
+
+    RecordQuery query;
+    query.begin = at(1400ms);
+    values.clear();
+    stats = replay.run(reader, query);
+    EXPECT_FALSE(stats.stopped);
+    EXPECT_EQ(stats.events, 100u);
+    EXPECT_EQ(values.front(), 400);
+
+    // A stop() before the run is not lost, and applies to that run only
+    replay.stop();
+    values.clear();
+    stats = replay.run(reader);
+    EXPECT_TRUE(stats.stopped);
+    EXPECT_EQ(stats.events, 0u);
+    EXPECT_TRUE(values.empty());
+    stats = replay.run(reader, query);
+    EXPECT_FALSE(stats.stopped);
+    EXPECT_EQ(stats.events, 100u);
+
+    reader.close();
+    std::filesystem::remove(path);
+}
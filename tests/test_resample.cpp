@@ -0,0 +1,102 @@
+/**
+ * @file test_resample.cpp
+ * @brief Tests for multi-signal resampling
+ */
+
+#include "vss_test_helpers.hpp"
+#include <vss/types/resample.hpp>
+#include <gtest/gtest.h>
+#include <cmath>
+
+using namespace vss::types;
+using namespace vss::types::test;
+using namespace std::chrono_literals;
+
+namespace {
+
+ResampleSpec grid(std::chrono::milliseconds start, std::chrono::milliseconds end,
+                  std::chrono::milliseconds period, InterpolationMode mode) {
+    ResampleSpec spec;
+    spec.start = at(start);
+    spec.end = at(end);
+    spec.period = period;
+    spec.mode = mode;
+    return spec;
+}
+
+} // namespace
+
+TEST(ResampleTest, ModeStrings) {
+    EXPECT_STREQ(interpolation_mode_to_string(InterpolationMode::LINEAR), "LINEAR");
+    EXPECT_EQ(interpolation_mode_from_string("zoh"), InterpolationMode::ZERO_ORDER_HOLD);
+    EXPECT_FALSE(interpolation_mode_from_string("cubic").has_value());
+}
+
+TEST(ResampleTest, GridShape) {
+    SignalSeries a;
+    a.append(at(0ms), 1.0);
+
+    auto table = resample({a.view(), a.view()}, grid(0ms, 1000ms, 300ms, InterpolationMode::ZERO_ORDER_HOLD));
+    EXPECT_EQ(table.columns, 2u);
+    ASSERT_EQ(table.rows(), 4u);  // 0, 300, 600, 900
+    EXPECT_EQ(table.timestamps[3], at(900ms));
+    EXPECT_EQ(table.values.size(), 8u);
+    EXPECT_EQ(table.column(1).size, 4u);
+
+    EXPECT_EQ(resample({a.view()}, grid(0ms, 1000ms, 0ms, InterpolationMode::LINEAR)).rows(), 0u);
+    EXPECT_EQ(resample({a.view()}, grid(1000ms, 0ms, 10ms, InterpolationMode::LINEAR)).rows(), 0u);
+}
+
+TEST(ResampleTest, ZeroOrderHoldAndLinear) {
+    SignalSeries s;
+    s.append(at(100ms), 10.0);
+    s.append(at(300ms), 30.0);
+    s.append(at(400ms), 0.0, SignalQuality::INVALID);
+
+    auto hold = resample({s.view()}, grid(0ms, 600ms, 100ms, InterpolationMode::ZERO_ORDER_HOLD));
+    ASSERT_EQ(hold.rows(), 6u);
+    EXPECT_EQ(hold.quality(0, 0), SignalQuality::NOT_AVAILABLE);   // before first sample
+    EXPECT_DOUBLE_EQ(hold.value(1, 0), 10.0);
+    EXPECT_DOUBLE_EQ(hold.value(2, 0), 10.0);
+    EXPECT_DOUBLE_EQ(hold.value(3, 0), 30.0);
+    EXPECT_EQ(hold.quality(4, 0), SignalQuality::INVALID);         // holding an INVALID sample
+    EXPECT_TRUE(std::isnan(hold.value(5, 0)));
+
+    auto lin = resample({s.view()}, grid(0ms, 400ms, 50ms, InterpolationMode::LINEAR));
+    EXPECT_DOUBLE_EQ(lin.value(2, 0), 10.0);
+    EXPECT_DOUBLE_EQ(lin.value(3, 0), 15.0);
+    EXPECT_DOUBLE_EQ(lin.value(4, 0), 20.0);
+    // Next sample is INVALID: no interpolation towards it
+    EXPECT_DOUBLE_EQ(lin.value(7, 0), 30.0);
+    EXPECT_EQ(lin.quality(7, 0), SignalQuality::VALID);
+}
+
+TEST(ResampleTest, StalenessCutoff) {
+    SignalSeries s;
+    s.append(at(0ms), 1.0);
+    s.append(at(1000ms), 2.0);
+
+    auto spec = grid(0ms, 1500ms, 250ms, InterpolationMode::LINEAR);
+    spec.max_staleness = 500ms;
+    auto table = resample({s.view()}, spec);
+    ASSERT_EQ(table.rows(), 6u);
+    EXPECT_DOUBLE_EQ(table.value(2, 0), 1.5);
+    EXPECT_EQ(table.quality(3, 0), SignalQuality::NOT_AVAILABLE);   // 750ms after last sample
+    EXPECT_EQ(table.quality(4, 0), SignalQuality::VALID);
+    EXPECT_EQ(table.quality(5, 0), SignalQuality::VALID);           // 250ms after last sample
+}
+
+TEST(ResampleTest, DynamicHistories) {
+    std::vector<std::vector<DynamicQualifiedValue>> histories(2);
+    histories[0].emplace_back(Value{int32_t(5)}, SignalQuality::VALID, at(0ms));
+    histories[0].emplace_back(Value{std::string("x")}, SignalQuality::VALID, at(200ms));
+    histories[1].emplace_back(Value{}, SignalQuality::VALID, at(0ms));
+    histories[1].emplace_back(Value{true}, SignalQuality::VALID, at(100ms));
+
+    auto table = resample(histories, grid(0ms, 300ms, 100ms, InterpolationMode::ZERO_ORDER_HOLD));
+    ASSERT_EQ(table.columns, 2u);
+    EXPECT_DOUBLE_EQ(table.value(1, 0), 5.0);
+    EXPECT_EQ(table.quality(2, 0), SignalQuality::INVALID);
+    EXPECT_EQ(table.quality(0, 1), SignalQuality::NOT_AVAILABLE);
+    EXPECT_DOUBLE_EQ(table.value(1, 1), 1.0);
+}
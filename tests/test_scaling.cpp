@@ -0,0 +1,189 @@
+/**
+ * @file test_scaling.cpp
+ * @brief Tests for batch linear scaling
+ */
+
+#include <vss/types/scaling.hpp>
+#include "alloc_tracker.hpp"
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cmath>
+#include <limits>
+
+using namespace vss::types;
+
+namespace {
+
+const auto TS = std::chrono::system_clock::time_point(std::chrono::seconds(1000));
+
+} // namespace
+
+TEST(ScalingTest, FactorAndOffset) {
+    const int16_t raw[5] = {0, 100, -100, 32767, -32768};
+    double out[5];
+    SignalQuality quality[5];
+
+    ScalingParams params{0.5, 10.0, std::nullopt, std::nullopt};
+    EXPECT_EQ(scale_linear(raw, 5, params, out, quality), 0u);
+
+    EXPECT_DOUBLE_EQ(out[0], 10.0);
+    EXPECT_DOUBLE_EQ(out[1], 60.0);
+    EXPECT_DOUBLE_EQ(out[2], -40.0);
+    EXPECT_DOUBLE_EQ(out[3], 16393.5);
+    EXPECT_DOUBLE_EQ(out[4], -16374.0);
+    for (auto q : quality) {
+        EXPECT_EQ(q, SignalQuality::VALID);
+    }
+}
+
+TEST(ScalingTest, RangeCheckMarksInvalid) {
+    const uint8_t raw[6] = {0, 40, 41, 165, 166, 255};
+    float out[6];
+    SignalQuality quality[6];
+
+    // physical = raw - 40, valid range [0, 125]
+    ScalingParams params{1.0, -40.0, 0.0, 125.0};
+    EXPECT_EQ(scale_linear(raw, 6, params, out, quality), 3u);
+
+    EXPECT_EQ(quality[0], SignalQuality::INVALID);
+    EXPECT_EQ(quality[1], SignalQuality::VALID);
+    EXPECT_EQ(quality[2], SignalQuality::VALID);
+    EXPECT_EQ(quality[3], SignalQuality::VALID);
+    EXPECT_EQ(quality[4], SignalQuality::INVALID);
+    EXPECT_EQ(quality[5], SignalQuality::INVALID);
+
+    // Out-of-range samples are still written
+    EXPECT_FLOAT_EQ(out[0], -40.0f);
+    EXPECT_FLOAT_EQ(out[5], 215.0f);
+}
+
+TEST(ScalingTest, NullQualityAndEmptyInput) {
+    const uint32_t raw[3] = {1, 2, 3};
+    double out[3];
+    ScalingParams params{2.0, 0.0, std::nullopt, 4.0};
+
+    EXPECT_EQ(scale_linear(raw, 3, params, out, nullptr), 1u);
+    EXPECT_DOUBLE_EQ(out[2], 6.0);
+    EXPECT_EQ(scale_linear(raw, 0, params, out, nullptr), 0u);
+}
+
+TEST(ScalingTest, NanIsInvalid) {
+    const int32_t raw[2] = {1, 2};
+    double out[2];
+    SignalQuality quality[2];
+    ScalingParams params{std::numeric_limits<double>::quiet_NaN(), 0.0, std::nullopt, std::nullopt};
+
+    EXPECT_EQ(scale_linear(raw, 2, params, out, quality), 2u);
+    EXPECT_TRUE(std::isnan(out[0]));
+    EXPECT_EQ(quality[1], SignalQuality::INVALID);
+}
+
+TEST(ScalingTest, BeyondFloatRangeIsInvalid) {
+    const int32_t raw[3] = {1, -1, 0};
+    ScalingParams params{1e300, 0.0, std::nullopt, std::nullopt};
+
+    float out[3];
+    SignalQuality quality[3];
+    EXPECT_EQ(scale_linear(raw, 3, params, out, quality), 2u);
+    EXPECT_EQ(quality[0], SignalQuality::INVALID);
+    EXPECT_EQ(out[0], std::numeric_limits<float>::infinity());
+    EXPECT_EQ(quality[1], SignalQuality::INVALID);
+    EXPECT_EQ(out[1], -std::numeric_limits<float>::infinity());
+    EXPECT_EQ(quality[2], SignalQuality::VALID);
+
+    // Double output holds the same results
+    double wide[3];
+    EXPECT_EQ(scale_linear(raw, 3, params, wide, nullptr), 0u);
+    EXPECT_DOUBLE_EQ(wide[0], 1e300);
+
+    std::vector<DynamicQualifiedValue> slots(3);
+    EXPECT_EQ(scale_into_slots(raw, 3, params, ValueType::FLOAT, slots.data(), TS), 2u);
+    EXPECT_EQ(slots[0].quality, SignalQuality::INVALID);
+    EXPECT_TRUE(is_empty(slots[0].value));
+    EXPECT_EQ(slots[2].quality, SignalQuality::VALID);
+    EXPECT_EQ(scale_into_slots(raw, 3, params, ValueType::DOUBLE, slots.data(), TS), 0u);
+
+    size_t out_of_range = 0;
+    const Value array = scale_array(Value{std::vector<int32_t>{1, 0}}, params, ValueType::FLOAT_ARRAY,
+                                    &out_of_range);
+    EXPECT_EQ(out_of_range, 1u);
+    EXPECT_EQ(std::get<std::vector<float>>(array)[1], 0.0f);
+}
+
+TEST(ScalingTest, LargeBatchMatchesScalar) {
+    // Spans several internal blocks and a vector tail
+    std::vector<int64_t> raw(1031);
+    for (size_t i = 0; i < raw.size(); ++i) {
+        raw[i] = static_cast<int64_t>(i * 37) - 20000;
+    }
+    std::vector<double> out(raw.size());
+    std::vector<SignalQuality> quality(raw.size());
+
+    ScalingParams params{0.125, 3.0, -1000.0, 1000.0};
+    size_t bad = scale_linear(raw.data(), raw.size(), params, out.data(), quality.data());
+
+    size_t expected_bad = 0;
+    for (size_t i = 0; i < raw.size(); ++i) {
+        double expected = static_cast<double>(raw[i]) * 0.125 + 3.0;
+        bool ok = expected >= -1000.0 && expected <= 1000.0;
+        expected_bad += ok ? 0 : 1;
+        EXPECT_DOUBLE_EQ(out[i], expected) << "sample " << i;
+        EXPECT_EQ(quality[i], ok ? SignalQuality::VALID : SignalQuality::INVALID) << "sample " << i;
+    }
+    EXPECT_EQ(bad, expected_bad);
+}
+
+TEST(ScalingTest, ScaleArray) {
+    Value raw = std::vector<uint16_t>{0, 1000, 65535};
+    ScalingParams params{0.01, 0.0, std::nullopt, 100.0};
+
+    size_t bad = 0;
+    Value floats = scale_array(raw, params, ValueType::FLOAT_ARRAY, &bad);
+    ASSERT_EQ(get_value_type(floats), ValueType::FLOAT_ARRAY);
+    const auto& f = std::get<std::vector<float>>(floats);
+    ASSERT_EQ(f.size(), 3u);
+    EXPECT_FLOAT_EQ(f[1], 10.0f);
+    EXPECT_EQ(bad, 1u);
+
+    Value doubles = scale_array(raw, params, ValueType::DOUBLE_ARRAY);
+    ASSERT_EQ(get_value_type(doubles), ValueType::DOUBLE_ARRAY);
+    EXPECT_DOUBLE_EQ(std::get<std::vector<double>>(doubles)[2], 655.35);
+
+    // Unsupported input or target
+    EXPECT_TRUE(is_empty(scale_array(Value{std::vector<float>{1.0f}}, params, ValueType::FLOAT_ARRAY)));
+    EXPECT_TRUE(is_empty(scale_array(Value{int32_t(1)}, params, ValueType::FLOAT_ARRAY)));
+    EXPECT_TRUE(is_empty(scale_array(raw, params, ValueType::INT32_ARRAY)));
+}
+
+TEST(ScalingTest, ScaleIntoSlots) {
+    const int8_t raw[3] = {-10, 0, 100};
+    std::vector<DynamicQualifiedValue> slots(3);
+    ScalingParams params{0.5, 0.0, -5.0, 5.0};
+
+    EXPECT_EQ(scale_into_slots(raw, 3, params, ValueType::FLOAT, slots.data(), TS), 1u);
+
+    EXPECT_EQ(slots[0].quality, SignalQuality::VALID);
+    EXPECT_FLOAT_EQ(std::get<float>(slots[0].value), -5.0f);
+    EXPECT_EQ(slots[0].timestamp, TS);
+    EXPECT_FLOAT_EQ(std::get<float>(slots[1].value), 0.0f);
+
+    EXPECT_EQ(slots[2].quality, SignalQuality::INVALID);
+    EXPECT_TRUE(is_empty(slots[2].value));
+
+    // Reuse slots with a DOUBLE target
+    EXPECT_EQ(scale_into_slots(raw, 2, params, ValueType::DOUBLE, slots.data(), TS), 0u);
+    EXPECT_DOUBLE_EQ(std::get<double>(slots[0].value), -5.0);
+
+    // Unsupported target leaves slots untouched
+    EXPECT_EQ(scale_into_slots(raw, 3, params, ValueType::INT32, slots.data(), TS), 3u);
+    EXPECT_DOUBLE_EQ(std::get<double>(slots[0].value), -5.0);
+}
+
+TEST(ScalingTest, ScaleIntoSlotsReusesStorage) {
+    std::vector<int16_t> raw(512, 100);
+    std::vector<DynamicQualifiedValue> slots(raw.size());
+    ScalingParams params{0.1, 0.0, -100.0, 100.0};
+
+    EXPECT_STEADY_STATE_NO_ALLOCATIONS(
+        scale_into_slots(raw.data(), raw.size(), params, ValueType::FLOAT, slots.data(), TS));
+}
@@ -0,0 +1,174 @@
+/**
+ * @file test_scheduler.cpp
+ * @brief Tests for the MPMC queue and priority-aware update scheduling
+ */
+
+#include "vss_test_helpers.hpp"
+#include <vss/types/scheduler.hpp>
+#include <vss/types/clock.hpp>
+#include <gtest/gtest.h>
+#include <thread>
+
+using namespace vss::types;
+using namespace vss::types::test;
+using namespace std::chrono_literals;
+
+TEST(MpmcQueueTest, FifoAndBounds) {
+    MpmcQueue<int> queue(5);
+    EXPECT_EQ(queue.capacity(), 8u);
+    EXPECT_TRUE(queue.empty());
+
+    for (int i = 0; i < 8; ++i) {
+        EXPECT_TRUE(queue.try_push(i));
+    }
+    EXPECT_FALSE(queue.try_push(8));
+    EXPECT_EQ(queue.size(), 8u);
+
+    int v = -1;
+    for (int i = 0; i < 8; ++i) {
+        ASSERT_TRUE(queue.try_pop(v));
+        EXPECT_EQ(v, i);
+    }
+    EXPECT_FALSE(queue.try_pop(v));
+
+    // Wrap around several laps
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_TRUE(queue.try_push(i));
+        ASSERT_TRUE(queue.try_pop(v));
+        EXPECT_EQ(v, i);
+    }
+}
+
+TEST(MpmcQueueTest, ConcurrentProducersAndConsumers) {
+    MpmcQueue<uint64_t> queue(256);
+    constexpr uint64_t PER_PRODUCER = 20000;
+    std::atomic<uint64_t> sum{0};
+    std::atomic<uint64_t> popped{0};
+
+    std::vector<std::thread> threads;
+    for (uint64_t p = 0; p < 3; ++p) {
+        threads.emplace_back([&, p] {
+            for (uint64_t i = 1; i <= PER_PRODUCER; ++i) {
+                while (!queue.try_push(p * PER_PRODUCER + i)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (int c = 0; c < 2; ++c) {
+        threads.emplace_back([&] {
+            uint64_t v;
+            while (popped.load() < 3 * PER_PRODUCER) {
+                if (queue.try_pop(v)) {
+                    sum.fetch_add(v);
+                    popped.fetch_add(1);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    const uint64_t n = 3 * PER_PRODUCER;
+    EXPECT_EQ(popped.load(), n);
+    EXPECT_EQ(sum.load(), n * (n + 1) / 2);
+}
+
+TEST(SchedulerTest, PriorityConfiguration) {
+    EXPECT_STREQ(priority_class_to_string(PriorityClass::CRITICAL), "CRITICAL");
+    EXPECT_EQ(priority_class_from_string("low"), PriorityClass::LOW);
+    EXPECT_FALSE(priority_class_from_string("urgent").has_value());
+
+    SignalCatalog catalog;
+    auto brake = catalog.add_signal("Vehicle.Brake.IsEngaged", NodeType::SENSOR, ValueType::BOOL);
+    EXPECT_EQ(catalog.get(*brake)->priority, PriorityClass::NORMAL);
+    EXPECT_TRUE(catalog.set_priority(*brake, PriorityClass::CRITICAL, 5ms));
+    EXPECT_EQ(catalog.get(*brake)->latency_budget, 5ms);
+    EXPECT_FALSE(catalog.set_priority(*catalog.find("Vehicle"), PriorityClass::HIGH));
+    EXPECT_FALSE(catalog.set_priority(999, PriorityClass::HIGH));
+
+    // Copies keep the settings
+    SignalCatalog copy = catalog;
+    EXPECT_EQ(copy.get(*brake)->priority, PriorityClass::CRITICAL);
+
+    UpdateScheduler scheduler(catalog);
+    EXPECT_EQ(scheduler.priority(*brake), PriorityClass::CRITICAL);
+    EXPECT_EQ(scheduler.priority(999), PriorityClass::NORMAL);
+}
+
+TEST(SchedulerTest, WeightedDispatch) {
+    SignalCatalog catalog;
+    const SignalId critical = *catalog.add_signal("Vehicle.Airbag.IsDeployed", NodeType::SENSOR, ValueType::BOOL);
+    const SignalId low = *catalog.add_signal("Vehicle.Infotainment.Title", NodeType::SENSOR, ValueType::STRING);
+    catalog.set_priority(critical, PriorityClass::CRITICAL);
+    catalog.set_priority(low, PriorityClass::LOW);
+
+    SchedulerOptions options;
+    options.weights = {{2, 1, 1, 1}};
+    UpdateScheduler scheduler(catalog, options);
+
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_TRUE(scheduler.submit(update(low, 0, Value{int32_t(i)})));
+    }
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_TRUE(scheduler.submit(update(critical, 0, Value{int32_t(100 + i)})));
+    }
+    EXPECT_EQ(scheduler.pending(), 13u);
+    EXPECT_EQ(scheduler.pending(PriorityClass::LOW), 10u);
+
+    // Rounds of 2 CRITICAL + 1 LOW, across calls
+    std::vector<SignalUpdate> out;
+    EXPECT_EQ(scheduler.dispatch(out, 2), 2u);
+    EXPECT_EQ(scheduler.dispatch(out, 100), 11u);
+    std::vector<SignalId> order;
+    for (const auto& u : out) {
+        order.push_back(u.id);
+    }
+    std::vector<SignalId> expected{critical, critical, low, critical};
+    expected.insert(expected.end(), 9, low);
+    EXPECT_EQ(order, expected);
+    EXPECT_EQ(std::get<int32_t>(out[2].value.value), 0);    // FIFO within a class
+    EXPECT_EQ(std::get<int32_t>(out[3].value.value), 102);
+
+    EXPECT_EQ(scheduler.dispatch(out, 100), 0u);
+    EXPECT_EQ(scheduler.stats(PriorityClass::CRITICAL).dispatched, 3u);
+    EXPECT_EQ(scheduler.stats(PriorityClass::LOW).submitted, 10u);
+}
+
+TEST(SchedulerTest, DeadlineMissesAndDrops) {
+    SignalCatalog catalog;
+    const SignalId brake = *catalog.add_signal("Vehicle.Brake.IsEngaged", NodeType::SENSOR, ValueType::BOOL);
+    const SignalId title = *catalog.add_signal("Vehicle.Infotainment.Title", NodeType::SENSOR, ValueType::STRING);
+    catalog.set_priority(brake, PriorityClass::CRITICAL, 5ms);
+    catalog.set_priority(title, PriorityClass::LOW);
+
+    SchedulerOptions options;
+    options.queue_capacity = 2;
+    UpdateScheduler scheduler(catalog, options);
+
+    // A full LOW queue does not affect CRITICAL
+    EXPECT_TRUE(scheduler.submit(update(title, 0, Value{int32_t(1)})));
+    EXPECT_TRUE(scheduler.submit(update(title, 0, Value{int32_t(2)})));
+    EXPECT_FALSE(scheduler.submit(update(title, 0, Value{int32_t(3)})));
+    EXPECT_EQ(scheduler.stats(PriorityClass::LOW).dropped, 1u);
+
+    ManualClock clock{at(1000ms)};
+    ScopedClockSource scope{clock};
+    EXPECT_TRUE(scheduler.submit(update(brake, 998, Value{int32_t(1)})));     // 2 ms old at dispatch
+    EXPECT_TRUE(scheduler.submit(update(brake, 990, Value{int32_t(2)})));     // 10 ms old: missed
+
+    std::vector<SignalUpdate> out;
+    EXPECT_EQ(scheduler.dispatch(out, 10), 4u);
+    const PriorityStats stats = scheduler.stats(PriorityClass::CRITICAL);
+    EXPECT_EQ(stats.dispatched, 2u);
+    EXPECT_EQ(stats.deadline_misses, 1u);
+    EXPECT_EQ(stats.max_latency, 10ms);
+    EXPECT_EQ(scheduler.stats(PriorityClass::LOW).deadline_misses, 0u);  // No budget
+
+    scheduler.reset_stats();
+    EXPECT_EQ(scheduler.stats(PriorityClass::CRITICAL).dispatched, 0u);
+    EXPECT_EQ(scheduler.stats(PriorityClass::LOW).dropped, 0u);
+}
@@ -0,0 +1,219 @@
+/**
+ * @file test_stats.cpp
+ * @brief Tests for columnar series and windowed statistics
+ */
+
+#include "vss_test_helpers.hpp"
+#include <vss/types/stats.hpp>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+using namespace vss::types;
+using namespace vss::types::test;
+using namespace std::chrono_literals;
+
+TEST(SignalSeriesTest, AppendSamples) {
+    SignalSeries series;
+    series.append(at(0ms), 1.5);
+    series.append(QualifiedValue<int32_t>{7, SignalQuality::INVALID, at(10ms)});
+    series.append(QualifiedValue<float>{});
+    EXPECT_TRUE(series.append(DynamicQualifiedValue{Value{uint8_t(3)}, SignalQuality::VALID, at(20ms)}));
+    EXPECT_TRUE(series.append(DynamicQualifiedValue{Value{}, SignalQuality::VALID, at(30ms)}));
+    EXPECT_FALSE(series.append(DynamicQualifiedValue{Value{std::string("x")}, SignalQuality::VALID, at(40ms)}));
+
+    ASSERT_EQ(series.size(), 5u);
+    EXPECT_DOUBLE_EQ(series.values()[1], 7.0);
+    EXPECT_EQ(series.qualities()[1], SignalQuality::INVALID);
+    EXPECT_TRUE(std::isnan(series.values()[2]));
+    EXPECT_EQ(series.qualities()[2], SignalQuality::UNKNOWN);
+    EXPECT_DOUBLE_EQ(series.values()[3], 3.0);
+    EXPECT_EQ(series.qualities()[4], SignalQuality::NOT_AVAILABLE);
+
+    auto tail = series.view().subview(3, 10);
+    EXPECT_EQ(tail.size, 2u);
+    EXPECT_DOUBLE_EQ(tail.values[0], 3.0);
+
+    series.erase_front(4);
+    EXPECT_EQ(series.size(), 1u);
+    EXPECT_EQ(series.timestamps()[0], at(30ms));
+}
+
+TEST(RunningStatsTest, WelfordAndMerge) {
+    const double data[] = {2, 4, 4, 4, 5, 5, 7, 9};
+    RunningStats all;
+    RunningStats a;
+    RunningStats b;
+    for (size_t i = 0; i < 8; ++i) {
+        all.add(data[i]);
+        (i < 3 ? a : b).add(data[i]);
+    }
+    EXPECT_EQ(all.count, 8u);
+    EXPECT_DOUBLE_EQ(all.mean, 5.0);
+    EXPECT_DOUBLE_EQ(all.stddev(), 2.0);
+    EXPECT_DOUBLE_EQ(all.min, 2.0);
+    EXPECT_DOUBLE_EQ(all.max, 9.0);
+
+    a.merge(b);
+    EXPECT_EQ(a.count, 8u);
+    EXPECT_DOUBLE_EQ(a.mean, 5.0);
+    EXPECT_NEAR(a.variance(), 4.0, 1e-12);
+    EXPECT_NEAR(a.sample_variance(), 32.0 / 7.0, 1e-12);
+}
+
+TEST(QuantileSketchTest, RelativeAccuracy) {
+    QuantileSketch sketch{0.01};
+    std::vector<double> data;
+    std::mt19937 rng(7);
+    std::lognormal_distribution<double> dist(0.0, 2.0);
+    for (int i = 0; i < 20000; ++i) {
+        double x = dist(rng) * (i % 5 == 0 ? -1.0 : 1.0);
+        data.push_back(x);
+        sketch.add(x);
+    }
+    std::sort(data.begin(), data.end());
+
+    for (double q : {0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.99}) {
+        double exact = data[static_cast<size_t>(q * static_cast<double>(data.size() - 1))];
+        double estimate = *sketch.quantile(q);
+        EXPECT_NEAR(estimate, exact, std::abs(exact) * 0.0201) << "q=" << q;
+    }
+    EXPECT_DOUBLE_EQ(*sketch.quantile(0.0), data.front());
+    EXPECT_DOUBLE_EQ(*sketch.quantile(1.0), data.back());
+    EXPECT_FALSE(sketch.quantile(1.5).has_value());
+    EXPECT_FALSE(QuantileSketch{}.quantile(0.5).has_value());
+}
+
+TEST(QuantileSketchTest, MergeAndCollapse) {
+    QuantileSketch a{0.01, 64};
+    QuantileSketch b{0.01, 64};
+    for (int i = 1; i <= 1000; ++i) {
+        (i % 2 ? a : b).add(static_cast<double>(i));
+    }
+    ASSERT_TRUE(a.merge(b));
+    EXPECT_EQ(a.count(), 1000u);
+    // 64 buckets cannot span 1..1000 at 1%: low values collapse, high
+    // quantiles stay accurate
+    EXPECT_NEAR(*a.quantile(0.99), 990.0, 990.0 * 0.02);
+
+    QuantileSketch other{0.05};
+    EXPECT_FALSE(a.merge(other));
+
+    QuantileSketch zeros;
+    zeros.add(0.0);
+    zeros.add(0.0);
+    zeros.add(std::nan(""));
+    EXPECT_EQ(zeros.count(), 2u);
+    EXPECT_DOUBLE_EQ(*zeros.quantile(0.5), 0.0);
+}
+
+TEST(WindowAggregatorTest, TumblingWindows) {
+    WindowAggregator agg{WindowSpec::tumbling(100ms, {0.5})};
+    std::vector<WindowResult> windows;
+    agg.set_callback([&](const WindowResult& w) { windows.push_back(w); });
+
+    agg.add(QualifiedValue<double>{1.0, SignalQuality::VALID, at(10ms)});
+    agg.add(QualifiedValue<double>{3.0, SignalQuality::VALID, at(50ms)});
+    agg.add(QualifiedValue<double>{100.0, SignalQuality::INVALID, at(60ms)});
+    agg.add(DynamicQualifiedValue{Value{2.0f}, SignalQuality::VALID, at(90ms)});
+    EXPECT_TRUE(windows.empty());
+
+    agg.add(QualifiedValue<double>{10.0, SignalQuality::VALID, at(150ms)});
+    ASSERT_EQ(windows.size(), 1u);
+    EXPECT_EQ(windows[0].start, at(0ms));
+    EXPECT_EQ(windows[0].end, at(100ms));
+    EXPECT_EQ(windows[0].stats.count, 3u);
+    EXPECT_EQ(windows[0].excluded, 1u);
+    EXPECT_DOUBLE_EQ(windows[0].stats.mean, 2.0);
+    EXPECT_DOUBLE_EQ(windows[0].stats.max, 3.0);
+    EXPECT_NEAR(windows[0].percentiles[0], 2.0, 0.02);
+
+    // Gap: empty windows are skipped
+    agg.add(QualifiedValue<double>{20.0, SignalQuality::VALID, at(1050ms)});
+    ASSERT_EQ(windows.size(), 2u);
+    EXPECT_EQ(windows[1].start, at(100ms));
+    EXPECT_DOUBLE_EQ(windows[1].stats.mean, 10.0);
+
+    // Late sample is dropped
+    agg.add(QualifiedValue<double>{0.0, SignalQuality::VALID, at(500ms)});
+    EXPECT_EQ(agg.late_samples(), 1u);
+
+    agg.flush();
+    ASSERT_EQ(windows.size(), 3u);
+    EXPECT_EQ(windows[2].start, at(1000ms));
+    EXPECT_DOUBLE_EQ(windows[2].stats.mean, 20.0);
+}
+
+TEST(WindowAggregatorTest, SlidingWindows) {
+    WindowAggregator agg{WindowSpec::sliding(300ms, 100ms)};
+    std::vector<WindowResult> windows;
+    agg.set_callback([&](const WindowResult& w) { windows.push_back(w); });
+
+    // One sample per 100ms pane: 1, 2, 3, 4
+    for (int i = 0; i < 4; ++i) {
+        agg.add(at(std::chrono::milliseconds(i * 100 + 10)), static_cast<double>(i + 1), SignalQuality::VALID);
+    }
+    agg.flush();
+
+    // Windows ending at 100, 200, ..., 600 ms
+    ASSERT_EQ(windows.size(), 6u);
+    EXPECT_EQ(windows[0].end, at(100ms));
+    EXPECT_EQ(windows[0].start, at(-200ms));
+    EXPECT_EQ(windows[0].stats.count, 1u);
+    EXPECT_EQ(windows[2].stats.count, 3u);
+    EXPECT_DOUBLE_EQ(windows[2].stats.mean, 2.0);
+    EXPECT_EQ(windows[3].stats.count, 3u);
+    EXPECT_DOUBLE_EQ(windows[3].stats.mean, 3.0);
+    EXPECT_DOUBLE_EQ(windows[3].stats.min, 2.0);
+    EXPECT_EQ(windows[5].stats.count, 1u);
+    EXPECT_DOUBLE_EQ(windows[5].stats.mean, 4.0);
+}
+
+TEST(WindowAggregatorTest, BatchMatchesPerSample) {
+    SignalSeries series;
+    std::mt19937 rng(3);
+    std::normal_distribution<double> dist(50.0, 10.0);
+    for (int i = 0; i < 5000; ++i) {
+        SignalQuality q = (i % 17 == 0) ? SignalQuality::NOT_AVAILABLE : SignalQuality::VALID;
+        series.append(at(std::chrono::milliseconds(i)), dist(rng), q);
+    }
+    series.append(at(5000ms), std::nan(""), SignalQuality::VALID);
+
+    auto spec = WindowSpec::sliding(1000ms, 250ms, {0.5, 0.9});
+    WindowAggregator single{spec};
+    WindowAggregator batch{spec};
+    std::vector<WindowResult> a;
+    std::vector<WindowResult> b;
+    single.set_callback([&](const WindowResult& w) { a.push_back(w); });
+    batch.set_callback([&](const WindowResult& w) { b.push_back(w); });
+
+    auto view = series.view();
+    for (size_t i = 0; i < view.size; ++i) {
+        single.add(view.timestamps[i], view.values[i], view.quality(i));
+    }
+    // Feed the batch path in uneven chunks
+    batch.add_batch(view.subview(0, 1234));
+    batch.add_batch(view.subview(1234, 3000));
+    batch.add_batch(view.subview(4234, 10000));
+    single.flush();
+    batch.flush();
+
+    ASSERT_EQ(a.size(), b.size());
+    ASSERT_FALSE(a.empty());
+    for (size_t i = 0; i < a.size(); ++i) {
+        EXPECT_EQ(a[i].start, b[i].start);
+        EXPECT_EQ(a[i].stats.count, b[i].stats.count);
+        EXPECT_EQ(a[i].excluded, b[i].excluded);
+        EXPECT_NEAR(a[i].stats.mean, b[i].stats.mean, 1e-9);
+        EXPECT_NEAR(a[i].stats.stddev(), b[i].stats.stddev(), 1e-9);
+        EXPECT_DOUBLE_EQ(a[i].stats.min, b[i].stats.min);
+        EXPECT_DOUBLE_EQ(a[i].stats.max, b[i].stats.max);
+        if (a[i].stats.count > 0) {
+            EXPECT_DOUBLE_EQ(a[i].percentiles[1], b[i].percentiles[1]);
+        } else {
+            EXPECT_TRUE(std::isnan(b[i].percentiles[1]));
+        }
+    }
+    EXPECT_EQ(a.back().excluded, 1u);  // trailing NaN
+}
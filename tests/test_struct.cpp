@@ -3,6 +3,7 @@
  * @brief Tests for struct support
  */
 
+#include "alloc_tracker.hpp"
 #include <vss/types/struct.hpp>
 #include <gtest/gtest.h>
 
@@ -78,6 +79,79 @@ TEST(StructTest, StructValueClear) {
     EXPECT_TRUE(value.fields().empty());
 }
 
+TEST(StructTest, StructValueEmplaceField) {
+    StructValue value("Trace");
+    value.emplace_field<std::vector<float>>("Samples", 64, 1.0f);
+    value.emplace_field<std::string>("Label", "front-left wheel speed sensor");
+    auto& count = value.emplace_field<uint32_t>("Count", 3u);
+    count += 1;
+
+    EXPECT_EQ(std::get<std::vector<float>>(*value.get_field("Samples")).size(), 64u);
+    EXPECT_EQ(std::get<std::string>(*value.get_field("Label")), "front-left wheel speed sensor");
+    EXPECT_EQ(std::get<uint32_t>(*value.get_field("Count")), 4u);
+
+    // A different type replaces the value
+    value.emplace_field<double>("Count", 2.5);
+    EXPECT_EQ(std::get<double>(*value.get_field("Count")), 2.5);
+
+    // Same type: assigned into the existing buffer
+    const float* buffer = std::get<std::vector<float>>(*value.get_field("Samples")).data();
+    const std::vector<float> update(32, 2.0f);
+    auto& samples = value.emplace_field<std::vector<float>>("Samples", update);
+    EXPECT_EQ(samples.data(), buffer);
+    EXPECT_EQ(samples, update);
+}
+
+TEST(StructTest, StructValueSetFields) {
+    StructValue value("Position");
+    value.set_fields({{"Latitude", 37.7749}, {"Longitude", -122.4194}});
+    value.set_fields({{"Latitude", 48.1351}, {"Altitude", 16.0}});
+    EXPECT_EQ(value.fields().size(), 3u);
+    EXPECT_EQ(std::get<double>(*value.get_field("Latitude")), 48.1351);
+    EXPECT_EQ(std::get<double>(*value.get_field("Longitude")), -122.4194);
+
+    const std::vector<std::pair<std::string, Value>> batch = {{"Altitude", 20.0}, {"Heading", uint16_t(90)}};
+    value.set_fields(batch);
+    EXPECT_EQ(std::get<double>(*value.get_field("Altitude")), 20.0);
+    EXPECT_EQ(std::get<uint16_t>(*value.get_field("Heading")), 90);
+
+    const StructValue::FieldMap& fields = value.fields();
+    EXPECT_EQ(fields.size(), 4u);
+    EXPECT_TRUE(value.remove_field(std::string_view("Heading")));
+    EXPECT_FALSE(value.remove_field("Heading"));
+}
+
+TEST(StructTest, SteadyStateUpdatesDoNotAllocate) {
+    StructValue value("Trace");
+    const Value samples{std::vector<float>(256, 1.0f)};
+    const Value label{std::string("front-left wheel speed sensor")};
+    const Value names{std::vector<std::string>{"a fairly long first entry", "a fairly long second entry"}};
+    const std::string long_key = "AFieldNameLongerThanTheSmallStringBuffer";
+
+    EXPECT_STEADY_STATE_NO_ALLOCATIONS(value.assign_field("Samples", samples));
+    EXPECT_STEADY_STATE_NO_ALLOCATIONS(value.assign_field("Label", label));
+    EXPECT_STEADY_STATE_NO_ALLOCATIONS(value.assign_field("Names", names));
+    EXPECT_STEADY_STATE_NO_ALLOCATIONS(value.assign_field(long_key, samples));
+    EXPECT_STEADY_STATE_NO_ALLOCATIONS(value.emplace_field<float>("Speed", 12.5f));
+    EXPECT_STEADY_STATE_NO_ALLOCATIONS(
+        value.emplace_field<std::vector<float>>("Samples", std::get<std::vector<float>>(samples)));
+    EXPECT_STEADY_STATE_NO_ALLOCATIONS(value.set_fields({{"Speed", 13.0f}, {"Count", int32_t(7)}}));
+    EXPECT_EQ(value.fields().size(), 6u);
+
+    // Batch updates from values the caller keeps
+    const std::vector<std::pair<std::string, Value>> batch = {
+        {"Label", Value{std::string("rear-right wheel speed sensor")}},
+        {"Samples", Value{std::vector<float>(128, 2.0f)}},
+        {"Names", Value{std::vector<std::string>{"another fairly long entry", "and one more long entry"}}}};
+    EXPECT_STEADY_STATE_NO_ALLOCATIONS(value.set_fields(batch));
+    EXPECT_EQ(std::get<std::string>(*value.get_field("Label")), "rear-right wheel speed sensor");
+
+    // Shorter contents fit in the existing buffer
+    const Value shorter{std::vector<float>(16, 3.0f)};
+    EXPECT_NO_ALLOCATIONS(value.assign_field("Samples", shorter));
+    EXPECT_TRUE(values_equal(*value.get_field("Samples"), shorter));
+}
+
 TEST(StructTest, StructRegistry) {
     StructRegistry registry;
 
@@ -0,0 +1,191 @@
+/**
+ * @file test_subscription.cpp
+ * @brief Tests for wildcard path subscriptions and SignalSet
+ */
+
+#include <vss/types/subscription.hpp>
+#include <gtest/gtest.h>
+
+using namespace vss::types;
+
+namespace {
+
+SignalCatalog make_catalog() {
+    SignalCatalog catalog;
+    catalog.add_signal("Vehicle.Speed", NodeType::SENSOR, ValueType::FLOAT);
+    catalog.add_signal("Vehicle.Cabin.Door.Row1.Left.IsOpen", NodeType::ACTUATOR, ValueType::BOOL);
+    catalog.add_signal("Vehicle.Cabin.Door.Row1.Right.IsOpen", NodeType::ACTUATOR, ValueType::BOOL);
+    catalog.add_signal("Vehicle.Cabin.Door.Row1.Left.IsLocked", NodeType::ACTUATOR, ValueType::BOOL);
+    catalog.add_signal("Vehicle.Powertrain.TractionBattery.StateOfCharge.Current", NodeType::SENSOR, ValueType::FLOAT);
+    catalog.add_signal("Vehicle.Powertrain.Range", NodeType::SENSOR, ValueType::UINT32);
+    return catalog;
+}
+
+std::vector<std::string> paths(const SignalCatalog& catalog, const SignalSet& set) {
+    std::vector<std::string> result;
+    set.for_each([&](SignalId id) { result.emplace_back(catalog.path(id)); });
+    return result;
+}
+
+} // namespace
+
+TEST(SignalSetTest, InsertContainsErase) {
+    SignalSet set;
+    EXPECT_TRUE(set.empty());
+
+    set.insert(3);
+    set.insert(64);
+    set.insert(200);
+    EXPECT_TRUE(set.contains(3));
+    EXPECT_TRUE(set.contains(64));
+    EXPECT_TRUE(set.contains(200));
+    EXPECT_FALSE(set.contains(4));
+    EXPECT_FALSE(set.contains(100000));
+    EXPECT_EQ(set.count(), 3u);
+    EXPECT_EQ(set.to_vector(), (std::vector<SignalId>{3, 64, 200}));
+
+    set.erase(64);
+    EXPECT_FALSE(set.contains(64));
+    EXPECT_EQ(set.count(), 2u);
+
+    set.clear();
+    EXPECT_TRUE(set.empty());
+}
+
+TEST(SignalSetTest, UnionIntersectionEquality) {
+    SignalSet a;
+    a.insert(1);
+    a.insert(70);
+    SignalSet b(256);
+    b.insert(70);
+    b.insert(130);
+
+    SignalSet u = a;
+    u |= b;
+    EXPECT_EQ(u.to_vector(), (std::vector<SignalId>{1, 70, 130}));
+
+    SignalSet i = a;
+    i &= b;
+    EXPECT_EQ(i.to_vector(), (std::vector<SignalId>{70}));
+
+    // Capacity does not affect equality
+    SignalSet c(1024);
+    c.insert(70);
+    EXPECT_EQ(i, c);
+    EXPECT_NE(a, c);
+}
+
+TEST(SubscriptionTest, ExactPath) {
+    auto catalog = make_catalog();
+    SubscriptionMatcher matcher(catalog);
+
+    auto p = matcher.add_pattern("Vehicle.Speed");
+    ASSERT_TRUE(p.has_value());
+    EXPECT_EQ(paths(catalog, matcher.signals(*p)), std::vector<std::string>{"Vehicle.Speed"});
+}
+
+TEST(SubscriptionTest, SingleSegmentWildcard) {
+    auto catalog = make_catalog();
+    SubscriptionMatcher matcher(catalog);
+
+    auto p = matcher.add_pattern("Vehicle.Cabin.Door.Row1.*.IsOpen");
+    ASSERT_TRUE(p.has_value());
+    EXPECT_EQ(paths(catalog, matcher.signals(*p)),
+              (std::vector<std::string>{"Vehicle.Cabin.Door.Row1.Left.IsOpen",
+                                        "Vehicle.Cabin.Door.Row1.Right.IsOpen"}));
+
+    // "*" matches exactly one segment
+    auto q = matcher.add_pattern("Vehicle.Cabin.Door.*.IsOpen");
+    ASSERT_TRUE(q.has_value());
+    EXPECT_TRUE(matcher.signals(*q).empty());
+}
+
+TEST(SubscriptionTest, MultiSegmentWildcard) {
+    auto catalog = make_catalog();
+    SubscriptionMatcher matcher(catalog);
+
+    auto powertrain = matcher.add_pattern("Vehicle.Powertrain.**");
+    auto is_open = matcher.add_pattern("Vehicle.**.IsOpen");
+    auto everything = matcher.add_pattern("**");
+    ASSERT_TRUE(powertrain && is_open && everything);
+
+    EXPECT_EQ(paths(catalog, matcher.signals(*powertrain)),
+              (std::vector<std::string>{"Vehicle.Powertrain.TractionBattery.StateOfCharge.Current",
+                                        "Vehicle.Powertrain.Range"}));
+    EXPECT_EQ(matcher.signals(*is_open).count(), 2u);
+
+    // Branches are never part of a signal set
+    EXPECT_EQ(matcher.signals(*everything).count(), 6u);
+}
+
+TEST(SubscriptionTest, MatchPathAgainstAllPatterns) {
+    auto catalog = make_catalog();
+    SubscriptionMatcher matcher(catalog);
+
+    auto a = *matcher.add_pattern("Vehicle.Cabin.**");
+    auto b = *matcher.add_pattern("Vehicle.*.Door.Row1.*.IsOpen");
+    auto c = *matcher.add_pattern("Vehicle.Speed");
+    (void)c;
+
+    EXPECT_EQ(matcher.match("Vehicle.Cabin.Door.Row1.Left.IsOpen"), (std::vector<PatternId>{a, b}));
+    EXPECT_EQ(matcher.match("Vehicle.Cabin.Door.Row1.Left.IsLocked"), (std::vector<PatternId>{a}));
+    EXPECT_TRUE(matcher.match("Vehicle.Body.Lights").empty());
+
+    // Paths do not need to be in the catalog
+    EXPECT_EQ(matcher.match("Vehicle.Cabin.Seat.Row1.Pos"), (std::vector<PatternId>{a}));
+
+    auto id = catalog.find("Vehicle.Cabin.Door.Row1.Right.IsOpen");
+    EXPECT_EQ(matcher.match(*id), (std::vector<PatternId>{a, b}));
+    EXPECT_TRUE(matcher.match(*catalog.find("Vehicle.Cabin")).empty());
+}
+
+TEST(SubscriptionTest, IncrementalRefresh) {
+    auto catalog = make_catalog();
+    SubscriptionMatcher matcher(catalog);
+    auto doors = *matcher.add_pattern("Vehicle.Cabin.Door.*.*.IsOpen");
+    EXPECT_EQ(matcher.signals(doors).count(), 2u);
+
+    auto row2 = catalog.add_signal("Vehicle.Cabin.Door.Row2.Left.IsOpen", NodeType::ACTUATOR, ValueType::BOOL);
+    ASSERT_TRUE(row2.has_value());
+    EXPECT_FALSE(matcher.signals(doors).contains(*row2));
+
+    matcher.refresh();
+    EXPECT_TRUE(matcher.signals(doors).contains(*row2));
+    EXPECT_EQ(matcher.signals(doors).count(), 3u);
+
+    // New patterns see every signal added so far
+    auto row2_only = *matcher.add_pattern("Vehicle.Cabin.Door.Row2.**");
+    EXPECT_EQ(matcher.signals(row2_only).to_vector(), std::vector<SignalId>{*row2});
+    EXPECT_EQ(matcher.signals(doors).count(), 3u);
+}
+
+TEST(SubscriptionTest, MalformedPatterns) {
+    auto catalog = make_catalog();
+    SubscriptionMatcher matcher(catalog);
+
+    EXPECT_FALSE(matcher.add_pattern("").has_value());
+    EXPECT_FALSE(matcher.add_pattern("Vehicle..Speed").has_value());
+    EXPECT_FALSE(matcher.add_pattern("Vehicle.Spe*").has_value());
+    EXPECT_FALSE(matcher.add_pattern("Vehicle.***").has_value());
+    EXPECT_EQ(matcher.pattern_count(), 0u);
+    EXPECT_TRUE(matcher.signals(0).empty());
+}
+
+TEST(SubscriptionTest, ManyPatterns) {
+    SignalCatalog catalog;
+    for (int i = 0; i < 50; ++i) {
+        catalog.add_signal("Vehicle.Group" + std::to_string(i) + ".Value", NodeType::SENSOR, ValueType::INT32);
+    }
+    SubscriptionMatcher matcher(catalog);
+    for (int i = 0; i < 50; ++i) {
+        ASSERT_TRUE(matcher.add_pattern("Vehicle.Group" + std::to_string(i) + ".*").has_value());
+    }
+    auto all = *matcher.add_pattern("Vehicle.*.Value");
+
+    for (PatternId p = 0; p < 50; ++p) {
+        EXPECT_EQ(matcher.signals(p).count(), 1u);
+        EXPECT_EQ(matcher.pattern(p), "Vehicle.Group" + std::to_string(p) + ".*");
+    }
+    EXPECT_EQ(matcher.signals(all).count(), 50u);
+    EXPECT_EQ(matcher.match("Vehicle.Group7.Value"), (std::vector<PatternId>{7, all}));
+}
@@ -5,6 +5,7 @@
 
 #include <vss/types/value.hpp>
 #include <vss/types/struct.hpp>
+#include "alloc_tracker.hpp"
 #include <gtest/gtest.h>
 
 using namespace vss::types;
@@ -429,3 +430,21 @@ TEST(ThresholdTest, StructComparison) {
     EXPECT_FALSE(value_changed_beyond_threshold(Value{struct1}, Value{struct2}, 100.0));
     EXPECT_TRUE(value_changed_beyond_threshold(Value{struct1}, Value{struct3}, 100.0));
 }
+
+TEST(ValueComparisonTest, ComparisonAndScalarConversionDoNotAllocate) {
+    auto make = [] {
+        auto inner = std::make_shared<StructValue>("Inner");
+        inner->set_field("value", Value{42});
+        auto outer = std::make_shared<StructValue>("Outer");
+        outer->set_field("nested", Value{inner});
+        outer->set_field("samples", Value{std::vector<float>(64, 1.0f)});
+        return Value{outer};
+    };
+    const Value a = make();
+    const Value b = make();
+    const Value number{int32_t(7)};
+
+    EXPECT_STEADY_STATE_NO_ALLOCATIONS(values_equal(a, b));
+    EXPECT_STEADY_STATE_NO_ALLOCATIONS(convert_value_type(number, ValueType::DOUBLE));
+    EXPECT_STEADY_STATE_NO_ALLOCATIONS(value_changed_beyond_threshold(number, Value{int32_t(9)}, 1.0));
+}
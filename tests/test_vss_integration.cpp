@@ -283,3 +283,46 @@ TEST_F(VSSIntegrationTest, AllVSSTypesCanBeRepresented) {
     Value struct_array = struct_vec;
     EXPECT_EQ(get_value_type(struct_array), ValueType::STRUCT_ARRAY);
 }
+
+TEST_F(VSSIntegrationTest, SignalCatalogLoaded) {
+    SignalCatalog catalog;
+    auto error = load_test_vss_catalog(catalog);
+    ASSERT_FALSE(error.has_value()) << "Failed to load VSS catalog: " << *error;
+
+    // Vehicle, Vehicle.Test and 16 sensors; struct definitions are not signals
+    EXPECT_EQ(catalog.size(), 18u);
+    EXPECT_FALSE(catalog.contains("Vehicle.Test.Position"));
+
+    auto float_id = catalog.find("Vehicle.Test.FloatSensor");
+    ASSERT_TRUE(float_id.has_value());
+    EXPECT_EQ(catalog.path(*float_id), "Vehicle.Test.FloatSensor");
+
+    const auto* node = catalog.get(*float_id);
+    EXPECT_EQ(node->node_type, NodeType::SENSOR);
+    EXPECT_EQ(node->type, ValueType::FLOAT);
+    EXPECT_EQ(catalog.path(node->parent), "Vehicle.Test");
+
+    const auto* array_node = catalog.get(*catalog.find("Vehicle.Test.StringArraySensor"));
+    ASSERT_NE(array_node, nullptr);
+    EXPECT_EQ(array_node->type, ValueType::STRING_ARRAY);
+}
+
+TEST_F(VSSIntegrationTest, WorkloadFromVssCatalog) {
+    SignalCatalog catalog;
+    auto error = load_test_vss_catalog(catalog);
+    ASSERT_FALSE(error.has_value()) << "Failed to load VSS catalog: " << *error;
+
+    WorkloadProfile profile;
+    profile.seed = 3;
+    profile.max_updates = 2000;
+    WorkloadGenerator workload(catalog, registry, profile);
+    EXPECT_EQ(workload.signals().size(), 16u);
+
+    std::vector<SignalUpdate> updates;
+    EXPECT_EQ(workload.pull(updates, 5000), 2000u);
+    for (const auto& update : updates) {
+        if (update.value.quality != SignalQuality::NOT_AVAILABLE) {
+            EXPECT_EQ(get_value_type(update.value.value), catalog.get(update.id)->type);
+        }
+    }
+}
@@ -0,0 +1,217 @@
+/**
+ * @file test_workload.cpp
+ * @brief Tests for the synthetic workload generator
+ */
+
+#include <vss/types/workload.hpp>
+#include <vss/types/constraints.hpp>
+#include <gtest/gtest.h>
+#include <map>
+
+using namespace vss::types;
+using namespace std::chrono_literals;
+
+namespace {
+
+class WorkloadTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        StructDefinition position("Position");
+        position.add_field(FieldDefinition("Latitude", ValueType::DOUBLE))
+                .add_field(FieldDefinition("Longitude", ValueType::DOUBLE));
+        registry.register_struct(position);
+
+        FieldDefinition location("Location", ValueType::STRUCT);
+        location.struct_type_name = "Position";
+        FieldDefinition stops("Stops", ValueType::STRUCT_ARRAY);
+        stops.struct_type_name = "Position";
+        StructDefinition route("Route");
+        route.add_field(FieldDefinition("Name", ValueType::STRING))
+             .add_field(location)
+             .add_field(stops);
+        registry.register_struct(route);
+
+        speed = *catalog.add_signal("Vehicle.Speed", NodeType::SENSOR, ValueType::FLOAT);
+        ValueConstraints speed_range;
+        speed_range.min = 0.0;
+        speed_range.max = 250.0;
+        catalog.set_constraints(speed, speed_range);
+        catalog.set_priority(speed, PriorityClass::CRITICAL);
+
+        gear = *catalog.add_signal("Vehicle.Powertrain.Gear", NodeType::SENSOR, ValueType::INT8);
+        ValueConstraints gears;
+        gears.allowed = {Value{int8_t(-1)}, Value{int8_t(0)}, Value{int8_t(1)}, Value{int8_t(2)}};
+        catalog.set_constraints(gear, gears);
+
+        mode = *catalog.add_signal("Vehicle.Powertrain.Mode", NodeType::ACTUATOR, ValueType::STRING);
+        ValueConstraints modes;
+        modes.allowed = {Value{std::string("ECO")}, Value{std::string("SPORT")}};
+        catalog.set_constraints(mode, modes);
+
+        pressures = *catalog.add_signal("Vehicle.Chassis.TirePressures", NodeType::SENSOR,
+                                        ValueType::FLOAT_ARRAY);
+        door = *catalog.add_signal("Vehicle.Cabin.Door.IsOpen", NodeType::ACTUATOR, ValueType::BOOL);
+        vin = *catalog.add_signal("Vehicle.VIN", NodeType::ATTRIBUTE, ValueType::STRING);
+        route_id = *catalog.add_signal("Vehicle.Navigation.Route", NodeType::SENSOR, ValueType::STRUCT,
+                                       "Route");
+        unknown = *catalog.add_signal("Vehicle.Navigation.Unknown", NodeType::SENSOR, ValueType::STRUCT,
+                                      "Missing");
+    }
+
+    std::vector<SignalUpdate> take(WorkloadGenerator& generator, size_t count) {
+        std::vector<SignalUpdate> out;
+        generator.pull(out, count);
+        return out;
+    }
+
+    SignalCatalog catalog;
+    StructRegistry registry;
+    SignalId speed, gear, mode, pressures, door, vin, route_id, unknown;
+};
+
+} // namespace
+
+TEST_F(WorkloadTest, SameSeedSameStream) {
+    WorkloadProfile profile;
+    profile.seed = 7;
+    profile.invalid_probability = 0.05;
+    WorkloadGenerator a(catalog, registry, profile);
+    WorkloadGenerator b(catalog, registry, profile);
+
+    auto first = take(a, 5000);
+    auto second = take(b, 5000);
+    ASSERT_EQ(first.size(), 5000u);
+    ASSERT_EQ(second.size(), 5000u);
+    for (size_t i = 0; i < first.size(); ++i) {
+        ASSERT_EQ(first[i].id, second[i].id) << i;
+        ASSERT_EQ(first[i].value.timestamp, second[i].value.timestamp) << i;
+        ASSERT_EQ(first[i].value.quality, second[i].value.quality) << i;
+        ASSERT_TRUE(values_equal(first[i].value.value, second[i].value.value)) << i;
+    }
+
+    // reset() replays the stream, another seed changes it
+    a.reset();
+    EXPECT_EQ(a.generated(), 0u);
+    auto again = take(a, 100);
+    for (size_t i = 0; i < again.size(); ++i) {
+        EXPECT_EQ(again[i].value.timestamp, first[i].value.timestamp);
+    }
+
+    profile.seed = 8;
+    WorkloadGenerator c(catalog, registry, profile);
+    auto other = take(c, 100);
+    size_t same = 0;
+    for (size_t i = 0; i < other.size(); ++i) {
+        same += other[i].value.timestamp == first[i].value.timestamp;
+    }
+    EXPECT_LT(same, 100u);
+}
+
+TEST_F(WorkloadTest, RatesAndOrdering) {
+    WorkloadProfile profile;
+    profile.jitter = 0.0;
+    profile.duration = 10s;
+    profile.start = std::chrono::system_clock::time_point(1000s);
+    profile.rates = {{"Vehicle.Powertrain.**", 20.0}, {"Vehicle.Powertrain.Mode", -1.0},
+                     {"Vehicle.Cabin.**", 0.5}};
+    WorkloadGenerator generator(catalog, registry, profile);
+
+    EXPECT_DOUBLE_EQ(generator.rate_hz(speed), 100.0);      // CRITICAL class default
+    EXPECT_DOUBLE_EQ(generator.rate_hz(gear), 20.0);
+    EXPECT_LT(generator.rate_hz(mode), 0.0);                // excluded by the later rule
+    EXPECT_DOUBLE_EQ(generator.rate_hz(vin), 0.0);          // attribute: once
+    EXPECT_LT(generator.rate_hz(unknown), 0.0);             // struct type not registered
+    EXPECT_LT(generator.rate_hz(*catalog.find("Vehicle")), 0.0);
+    EXPECT_EQ(generator.signals().size(), 6u);
+    EXPECT_DOUBLE_EQ(generator.total_rate_hz(), 100.0 + 20.0 + 10.0 + 0.5 + 10.0);
+
+    std::map<SignalId, size_t> counts;
+    auto previous = profile.start;
+    SignalUpdate update;
+    while (generator.next(update)) {
+        EXPECT_GE(update.value.timestamp, previous);
+        EXPECT_LT(update.value.timestamp, profile.start + profile.duration);
+        previous = update.value.timestamp;
+        ++counts[update.id];
+    }
+    EXPECT_EQ(counts[speed], 1000u);
+    EXPECT_EQ(counts[gear], 200u);
+    EXPECT_EQ(counts[pressures], 100u);
+    EXPECT_EQ(counts[door], 5u);
+    EXPECT_EQ(counts[vin], 1u);
+    EXPECT_EQ(counts[route_id], 100u);
+    EXPECT_EQ(counts.count(mode), 0u);
+    EXPECT_EQ(generator.generated(), 1000u + 200u + 100u + 5u + 1u + 100u);
+}
+
+TEST_F(WorkloadTest, ValuesMatchCatalog) {
+    WorkloadProfile profile;
+    profile.min_array_size = 4;
+    profile.max_array_size = 8;
+    profile.invalid_probability = 0.0;
+    profile.unavailable_probability = 0.0;
+    profile.max_updates = 20000;
+    WorkloadGenerator generator(catalog, registry, profile);
+
+    std::map<SignalId, size_t> array_sizes;
+    SignalUpdate update;
+    size_t updates = 0;
+    while (generator.next(update)) {
+        ++updates;
+        const SignalNode* node = catalog.get(update.id);
+        const Value& value = update.value.value;
+        ASSERT_EQ(update.value.quality, SignalQuality::VALID);
+        ASSERT_EQ(get_value_type(value), node->type) << node->path;
+        EXPECT_FALSE(check_constraints(value, node->constraints).has_value()) << node->path;
+
+        if (update.id == mode) {
+            EXPECT_TRUE(std::holds_alternative<EnumValue>(value));
+        }
+        if (update.id == pressures) {
+            const size_t size = std::get<std::vector<float>>(value).size();
+            EXPECT_GE(size, 4u);
+            EXPECT_LE(size, 8u);
+            auto [it, inserted] = array_sizes.emplace(update.id, size);
+            EXPECT_EQ(it->second, size);    // fixed per signal
+        }
+        if (update.id == route_id) {
+            const auto& route = *std::get<std::shared_ptr<StructValue>>(value);
+            EXPECT_FALSE(validate_struct(route, registry).has_value());
+            const auto& stops = std::get<std::vector<std::shared_ptr<StructValue>>>(*route.get_field("Stops"));
+            EXPECT_GE(stops.size(), 4u);
+            EXPECT_LE(stops.size(), 8u);
+        }
+    }
+    EXPECT_EQ(updates, 20000u);
+    EXPECT_EQ(generator.generated(), 20000u);
+}
+
+TEST_F(WorkloadTest, QualityTransitions) {
+    WorkloadProfile profile;
+    profile.invalid_probability = 0.05;
+    profile.unavailable_probability = 0.05;
+    profile.recovery_probability = 0.5;
+    WorkloadGenerator generator(catalog, registry, profile);
+
+    std::map<SignalQuality, size_t> qualities;
+    size_t recoveries = 0;
+    std::map<SignalId, SignalQuality> last;
+    for (const auto& update : take(generator, 20000)) {
+        const SignalQuality quality = update.value.quality;
+        ++qualities[quality];
+        if (quality == SignalQuality::NOT_AVAILABLE) {
+            EXPECT_TRUE(is_empty(update.value.value));
+        } else {
+            EXPECT_FALSE(is_empty(update.value.value));
+        }
+        auto it = last.find(update.id);
+        if (it != last.end() && it->second != SignalQuality::VALID && quality == SignalQuality::VALID) {
+            ++recoveries;
+        }
+        last[update.id] = quality;
+    }
+    EXPECT_GT(qualities[SignalQuality::VALID], 15000u);
+    EXPECT_GT(qualities[SignalQuality::INVALID], 100u);
+    EXPECT_GT(qualities[SignalQuality::NOT_AVAILABLE], 100u);
+    EXPECT_GT(recoveries, 100u);
+}
@@ -99,7 +99,80 @@ public:
         return std::nullopt;
     }
 
+    /**
+     * @brief Parse VSS JSON file into SignalCatalog
+     *
+     * Adds every branch and leaf signal below "Vehicle". Struct type
+     * definitions (type "struct") are not signals and are skipped.
+     *
+     * @param json_path Path to VSS JSON file
+     * @param catalog Catalog to populate
+     * @return Error message if parsing fails, nullopt on success
+     */
+    static std::optional<std::string> parse_vss_catalog(
+        const std::string& json_path,
+        SignalCatalog& catalog)
+    {
+        try {
+            std::ifstream file(json_path);
+            if (!file.is_open()) {
+                return "Failed to open file: " + json_path;
+            }
+
+            json vss_json;
+            file >> vss_json;
+
+            if (!vss_json.contains("Vehicle")) {
+                return "VSS JSON must contain 'Vehicle' root node";
+            }
+
+            parse_catalog_node(vss_json["Vehicle"], "Vehicle", catalog);
+
+            return std::nullopt;
+        } catch (const std::exception& e) {
+            return std::string("JSON parsing error: ") + e.what();
+        }
+    }
+
 private:
+    /**
+     * @brief Recursively add VSS nodes to a catalog
+     */
+    static void parse_catalog_node(
+        const json& node,
+        const std::string& path,
+        SignalCatalog& catalog)
+    {
+        if (!node.contains("type")) {
+            return;
+        }
+
+        std::string node_type_str = node["type"];
+        auto node_type = node_type_from_string(node_type_str);
+        if (!node_type.has_value()) {
+            return;  // struct definitions, properties
+        }
+
+        std::string description = node.value("description", "");
+
+        if (*node_type == NodeType::BRANCH) {
+            catalog.add_branch(path, description);
+            if (node.contains("children")) {
+                for (auto& [child_name, child_node] : node["children"].items()) {
+                    parse_catalog_node(child_node, path + "." + child_name, catalog);
+                }
+            }
+            return;
+        }
+
+        auto value_type = vss_datatype_to_value_type(node.value("datatype", ""));
+        if (!value_type.has_value()) {
+            return;
+        }
+        catalog.add_signal(path, *node_type, *value_type,
+                           node.value("struct_type", ""), description);
+    }
+
     /**
      * @brief Recursively parse VSS nodes
      */
@@ -198,4 +271,24 @@ inline std::optional<std::string> load_test_vss_config(StructRegistry& registry)
     return "Could not find vss_test.json in any search path";
 }
 
+/**
+ * @brief Helper to load the test VSS tree into a SignalCatalog
+ */
+inline std::optional<std::string> load_test_vss_catalog(SignalCatalog& catalog) {
+    std::vector<std::string> search_paths = {
+        "vss_test.json",
+        "tests/vss_test.json",
+        "../tests/vss_test.json"
+    };
+
+    for (const auto& path : search_paths) {
+        std::ifstream test(path);
+        if (test.good()) {
+            return VSSTestParser::parse_vss_catalog(path, catalog);
+        }
+    }
+
+    return "Could not find vss_test.json in any search path";
+}
+
 } // namespace vss::types::test
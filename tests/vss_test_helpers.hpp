@@ -0,0 +1,49 @@
+/**
+ * @file vss_test_helpers.hpp
+ * @brief Time points, samples and updates shared by the stream and replay tests
+ */
+
+#pragma once
+
+#include <vss/types/update.hpp>
+#include <chrono>
+#include <vector>
+
+namespace vss::types::test {
+
+/**
+ * @brief Time point `ms` after the epoch
+ */
+inline std::chrono::system_clock::time_point at(std::chrono::milliseconds ms) {
+    return std::chrono::system_clock::time_point(ms);
+}
+
+/**
+ * @brief Sample with timestamp at(ms)
+ */
+inline DynamicQualifiedValue sample(Value value, int ms, SignalQuality quality = SignalQuality::VALID) {
+    return DynamicQualifiedValue{std::move(value), quality, at(std::chrono::milliseconds(ms))};
+}
+
+/**
+ * @brief VALID update of `id` with timestamp at(ms)
+ */
+inline SignalUpdate update(SignalId id, int ms, Value value = Value{int32_t(0)}) {
+    return SignalUpdate{id, sample(std::move(value), ms)};
+}
+
+/**
+ * @brief `count` updates `step_ms` apart from `start_ms`
+ *
+ * Ids cycle through 0, 1, 2; update i holds int32_t(i).
+ */
+inline std::vector<SignalUpdate> updates(int count, int step_ms, int start_ms = 0) {
+    std::vector<SignalUpdate> result;
+    result.reserve(static_cast<size_t>(count));
+    for (int i = 0; i < count; ++i) {
+        result.push_back(update(static_cast<SignalId>(i % 3), start_ms + i * step_ms, Value{int32_t(i)}));
+    }
+    return result;
+}
+
+} // namespace vss::types::test